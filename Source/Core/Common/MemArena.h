@@ -115,6 +115,18 @@ public:
   ///
   void UnmapFromMemoryRegion(void* view, size_t size);
 
+  ///
+  /// Restrict access to part of a memory region previously mapped with MapInMemoryRegion(), so
+  /// that accesses to it fault. The restriction lasts until the region is unmapped.
+  ///
+  /// @param address Start of the part to restrict. Must be aligned to the host page size.
+  /// @param size Size of the part to restrict. Must be a multiple of the host page size.
+  /// @param allow_read Whether reads are still allowed, i.e. only writes fault.
+  ///
+  /// @return Whether the access was restricted successfully.
+  ///
+  bool ProtectInMemoryRegion(void* address, size_t size, bool allow_read);
+
 private:
 #ifdef _WIN32
   WindowsMemoryRegion* EnsureSplitRegionForMapping(void* address, size_t size);
@@ -144,6 +144,16 @@ void MemArena::UnmapFromMemoryRegion(void* view, size_t size)
     NOTICE_LOG_FMT(MEMMAP, "mmap failed");
 }
 
+bool MemArena::ProtectInMemoryRegion(void* address, size_t size, bool allow_read)
+{
+  if (mprotect(address, size, allow_read ? PROT_READ : PROT_NONE) != 0)
+  {
+    ERROR_LOG_FMT(MEMMAP, "mprotect failed: {}", LastStrerrorString());
+    return false;
+  }
+  return true;
+}
+
 LazyMemoryRegion::LazyMemoryRegion() = default;
 
 LazyMemoryRegion::~LazyMemoryRegion()
@@ -163,6 +163,19 @@ void MemArena::UnmapFromMemoryRegion(void* view, size_t size)
   }
 }
 
+bool MemArena::ProtectInMemoryRegion(void* address, size_t size, bool allow_read)
+{
+  const kern_return_t retval =
+      vm_protect(mach_task_self(), reinterpret_cast<vm_address_t>(address), size, false,
+                 allow_read ? VM_PROT_READ : VM_PROT_NONE);
+  if (retval != KERN_SUCCESS)
+  {
+    ERROR_LOG_FMT(MEMMAP, "ProtectInMemoryRegion failed: vm_protect returned {0:#x}", retval);
+    return false;
+  }
+  return true;
+}
+
 LazyMemoryRegion::LazyMemoryRegion() = default;
 
 LazyMemoryRegion::~LazyMemoryRegion()
@@ -442,6 +442,17 @@ void MemArena::UnmapFromMemoryRegion(void* view, size_t size)
   UnmapViewOfFile(view);
 }
 
+bool MemArena::ProtectInMemoryRegion(void* address, size_t size, bool allow_read)
+{
+  DWORD old_protect;
+  if (!VirtualProtect(address, size, allow_read ? PAGE_READONLY : PAGE_NOACCESS, &old_protect))
+  {
+    ERROR_LOG_FMT(MEMMAP, "VirtualProtect failed: {}", GetLastErrorString());
+    return false;
+  }
+  return true;
+}
+
 LazyMemoryRegion::LazyMemoryRegion()
 {
   InitWindowsMemoryFunctions(&m_memory_functions);
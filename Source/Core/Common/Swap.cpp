@@ -0,0 +1,131 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/Swap.h"
+
+#include <cstring>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
+
+#ifdef _M_ARM_64
+#include <arm_neon.h>
+#endif
+
+namespace Common
+{
+template <int size>
+static void SwapArrayGeneric(u8* dst, const u8* src, size_t count)
+{
+  for (size_t i = 0; i < count * size; i += size)
+  {
+    u8 value[size];
+    std::memcpy(value, src + i, size);
+    swap<size>(value);
+    std::memcpy(dst + i, value, size);
+  }
+}
+
+#ifdef _M_X86_64
+template <int size>
+static __m128i GetSwapShuffleMask()
+{
+  if constexpr (size == 2)
+    return _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+  else if constexpr (size == 4)
+    return _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+  else
+    return _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+}
+
+template <int size>
+FUNCTION_TARGET_SSSE3 static void SwapArraySSSE3(u8* dst, const u8* src, size_t count)
+{
+  const __m128i mask = GetSwapShuffleMask<size>();
+  const size_t num_bytes = count * size;
+  size_t i = 0;
+  for (; i + 64 <= num_bytes; i += 64)
+  {
+    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 16));
+    const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 32));
+    const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 48));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(a, mask));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 16), _mm_shuffle_epi8(b, mask));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 32), _mm_shuffle_epi8(c, mask));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 48), _mm_shuffle_epi8(d, mask));
+  }
+  for (; i + 16 <= num_bytes; i += 16)
+  {
+    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(a, mask));
+  }
+  SwapArrayGeneric<size>(dst + i, src + i, (num_bytes - i) / size);
+}
+#endif
+
+#ifdef _M_ARM_64
+template <int size>
+static uint8x16_t SwapVector(uint8x16_t value)
+{
+  if constexpr (size == 2)
+    return vrev16q_u8(value);
+  else if constexpr (size == 4)
+    return vrev32q_u8(value);
+  else
+    return vrev64q_u8(value);
+}
+
+template <int size>
+static void SwapArrayNEON(u8* dst, const u8* src, size_t count)
+{
+  const size_t num_bytes = count * size;
+  size_t i = 0;
+  for (; i + 64 <= num_bytes; i += 64)
+  {
+    uint8x16x4_t values = vld1q_u8_x4(src + i);
+    values.val[0] = SwapVector<size>(values.val[0]);
+    values.val[1] = SwapVector<size>(values.val[1]);
+    values.val[2] = SwapVector<size>(values.val[2]);
+    values.val[3] = SwapVector<size>(values.val[3]);
+    vst1q_u8_x4(dst + i, values);
+  }
+  for (; i + 16 <= num_bytes; i += 16)
+    vst1q_u8(dst + i, SwapVector<size>(vld1q_u8(src + i)));
+  SwapArrayGeneric<size>(dst + i, src + i, (num_bytes - i) / size);
+}
+#endif
+
+template <int size>
+static void SwapArrayImpl(void* dst, const void* src, size_t count)
+{
+  u8* dst_bytes = static_cast<u8*>(dst);
+  const u8* src_bytes = static_cast<const u8*>(src);
+#if defined(_M_X86_64)
+  if (cpu_info.bSSSE3)
+    SwapArraySSSE3<size>(dst_bytes, src_bytes, count);
+  else
+    SwapArrayGeneric<size>(dst_bytes, src_bytes, count);
+#elif defined(_M_ARM_64)
+  SwapArrayNEON<size>(dst_bytes, src_bytes, count);
+#else
+  SwapArrayGeneric<size>(dst_bytes, src_bytes, count);
+#endif
+}
+
+void SwapArray16(void* dst, const void* src, size_t count)
+{
+  SwapArrayImpl<2>(dst, src, count);
+}
+
+void SwapArray32(void* dst, const void* src, size_t count)
+{
+  SwapArrayImpl<4>(dst, src, count);
+}
+
+void SwapArray64(void* dst, const void* src, size_t count)
+{
+  SwapArrayImpl<8>(dst, src, count);
+}
+}  // Namespace Common
@@ -168,6 +168,40 @@ inline T FromBigEndian(T data)
   return data;
 }
 
+// Byte-swaps `count` consecutive 16, 32 or 64 bit values from `src` into `dst`,
+// using SIMD where available. `src` and `dst` may be the same, but must not overlap otherwise.
+void SwapArray16(void* dst, const void* src, size_t count);
+void SwapArray32(void* dst, const void* src, size_t count);
+void SwapArray64(void* dst, const void* src, size_t count);
+
+template <int size>
+void SwapArray(void* dst, const void* src, size_t count);
+
+template <>
+inline void SwapArray<1>(void* dst, const void* src, size_t count)
+{
+  if (dst != src)
+    std::memmove(dst, src, count);
+}
+
+template <>
+inline void SwapArray<2>(void* dst, const void* src, size_t count)
+{
+  SwapArray16(dst, src, count);
+}
+
+template <>
+inline void SwapArray<4>(void* dst, const void* src, size_t count)
+{
+  SwapArray32(dst, src, count);
+}
+
+template <>
+inline void SwapArray<8>(void* dst, const void* src, size_t count)
+{
+  SwapArray64(dst, src, count);
+}
+
 template <typename value_type>
 struct BigEndianValue
 {
@@ -14,24 +14,40 @@
 namespace API
 {
 
+void GCManip::ClearOwnedBy(const void* owner)
+{
+  BaseManip::ClearOwnedBy(owner);
+  m_timelines.ClearOwnedBy(owner);
+}
+
 GCPadStatus GCManip::Get(int controller_id)
 {
-  auto iter = m_overrides.find(controller_id);
-  if (iter != m_overrides.end())
-    return iter->second.pad_status;
+  {
+    std::lock_guard lock{m_overrides_mutex};
+    auto iter = m_overrides.find(controller_id);
+    if (iter != m_overrides.end())
+      return iter->second.pad_status;
+  }
+  if (const std::optional<GCPadStatus> input = m_timelines.GetCurrentInput(controller_id))
+    return *input;
   if (Config::Get(Config::GetInfoForSIDevice(controller_id)) == SerialInterface::SIDEVICE_WIIU_ADAPTER)
     return GCAdapter::Input(controller_id);
   else
     return Pad::GetStatus(controller_id);
 }
 
-void GCManip::Set(GCPadStatus pad_status, int controller_id, ClearOn clear_on)
+void GCManip::Set(GCPadStatus pad_status, int controller_id, ClearOn clear_on,
+                  const void* owner)
 {
-  m_overrides[controller_id] = {pad_status, clear_on, /* used: */ false};
+  std::lock_guard lock{m_overrides_mutex};
+  m_overrides[controller_id] = {pad_status, clear_on, /* used: */ false, owner};
 }
 
 void GCManip::PerformInputManip(GCPadStatus* pad_status, int controller_id)
 {
+  if (const std::optional<GCPadStatus> input = m_timelines.GetCurrentInput(controller_id))
+    *pad_status = *input;
+  std::lock_guard lock{m_overrides_mutex};
   auto iter = m_overrides.find(controller_id);
   if (iter == m_overrides.end())
   {
@@ -47,18 +63,30 @@ void GCManip::PerformInputManip(GCPadStatus* pad_status, int controller_id)
   input_override.used = true;
 }
 
+void WiiButtonsManip::ClearOwnedBy(const void* owner)
+{
+  BaseManip::ClearOwnedBy(owner);
+  m_timelines.ClearOwnedBy(owner);
+}
+
 WiimoteCommon::ButtonData WiiButtonsManip::Get(int controller_id)
 {
-  auto iter = m_overrides.find(controller_id);
-  if (iter != m_overrides.end())
-    return iter->second.button_data;
+  {
+    std::lock_guard lock{m_overrides_mutex};
+    auto iter = m_overrides.find(controller_id);
+    if (iter != m_overrides.end())
+      return iter->second.button_data;
+  }
+  if (const auto input = m_timelines.GetCurrentInput(controller_id))
+    return *input;
   return Wiimote::GetButtonData(controller_id);
 }
 
 void WiiButtonsManip::Set(WiimoteCommon::ButtonData button_data, int controller_id,
-                          ClearOn clear_on)
+                          ClearOn clear_on, const void* owner)
 {
-  m_overrides[controller_id] = {button_data, clear_on, /* used: */ false};
+  std::lock_guard lock{m_overrides_mutex};
+  m_overrides[controller_id] = {button_data, clear_on, /* used: */ false, owner};
 }
 
 void WiiButtonsManip::PerformInputManip(WiimoteCommon::DataReportBuilder& rpt, int controller_id)
@@ -67,6 +95,15 @@ void WiiButtonsManip::PerformInputManip(WiimoteCommon::DataReportBuilder& rpt, i
   {
     return;
   }
+  if (const auto input = m_timelines.GetCurrentInput(controller_id))
+  {
+    WiimoteCommon::DataReportBuilder::CoreData core;
+    rpt.GetCoreData(&core);
+    core.hex = (core.hex & ~WiimoteCommon::ButtonData::BUTTON_MASK) |
+               (input->hex & WiimoteCommon::ButtonData::BUTTON_MASK);
+    rpt.SetCoreData(core);
+  }
+  std::lock_guard lock{m_overrides_mutex};
   auto iter = m_overrides.find(controller_id);
   if (iter == m_overrides.end())
   {
@@ -86,9 +123,11 @@ void WiiButtonsManip::PerformInputManip(WiimoteCommon::DataReportBuilder& rpt, i
   input_override.used = true;
 }
 
-void WiiIRManip::Set(IRCameraTransform ircamera_transform, int controller_id, ClearOn clear_on)
+void WiiIRManip::Set(IRCameraTransform ircamera_transform, int controller_id, ClearOn clear_on,
+                     const void* owner)
 {
-  m_overrides[controller_id] = {ircamera_transform, clear_on, /* used: */ false};
+  std::lock_guard lock{m_overrides_mutex};
+  m_overrides[controller_id] = {ircamera_transform, clear_on, /* used: */ false, owner};
 }
 
 void WiiIRManip::PerformInputManip(WiimoteCommon::DataReportBuilder& rpt, int controller_id)
@@ -97,6 +136,7 @@ void WiiIRManip::PerformInputManip(WiimoteCommon::DataReportBuilder& rpt, int co
   {
     return;
   }
+  std::lock_guard lock{m_overrides_mutex};
   const auto iter = m_overrides.find(controller_id);
   if (iter == m_overrides.end())
   {
@@ -126,6 +166,7 @@ void WiiIRManip::PerformInputManip(WiimoteCommon::DataReportBuilder& rpt, int co
 
 WiimoteEmu::Nunchuk::DataFormat NunchuckButtonsManip::Get(int controller_id)
 {
+  std::lock_guard lock{m_overrides_mutex};
   auto iter = m_overrides.find(controller_id);
   if (iter != m_overrides.end())
     return iter->second.button_data;
@@ -133,9 +174,10 @@ WiimoteEmu::Nunchuk::DataFormat NunchuckButtonsManip::Get(int controller_id)
 }
 
 void NunchuckButtonsManip::Set(WiimoteEmu::Nunchuk::DataFormat button_data, int controller_id,
-                               ClearOn clear_on)
+                               ClearOn clear_on, const void* owner)
 {
-  m_overrides[controller_id] = {button_data, clear_on, /* used: */ false};
+  std::lock_guard lock{m_overrides_mutex};
+  m_overrides[controller_id] = {button_data, clear_on, /* used: */ false, owner};
 }
 
 void NunchuckButtonsManip::PerformInputManip(WiimoteCommon::DataReportBuilder& rpt,
@@ -145,6 +187,7 @@ void NunchuckButtonsManip::PerformInputManip(WiimoteCommon::DataReportBuilder& r
   {
     return;
   }
+  std::lock_guard lock{m_overrides_mutex};
   auto iter = m_overrides.find(controller_id);
   if (iter == m_overrides.end())
   {
@@ -166,7 +209,10 @@ void NunchuckButtonsManip::SaveNunchuckState(WiimoteCommon::DataReportBuilder& r
 {
   auto nunchuk = reinterpret_cast<WiimoteEmu::Nunchuk::DataFormat*>(rpt.GetExtDataPtr());
   key.Decrypt((u8*)nunchuk, 0, sizeof(*nunchuk));
-  m_nunchuk_state[controller_id] = *nunchuk;
+  {
+    std::lock_guard lock{m_overrides_mutex};
+    m_nunchuk_state[controller_id] = *nunchuk;
+  }
   key.Encrypt((u8*)nunchuk, 0, sizeof(*nunchuk));
 }
 
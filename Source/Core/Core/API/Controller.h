@@ -4,6 +4,11 @@
 
 #pragma once
 
+#include <map>
+#include <mutex>
+#include <optional>
+#include <vector>
+
 #include "Common/CommonTypes.h"
 #include "Core/API/Events.h"
 #include "Core/HW/WiimoteCommon/DataReport.h"
@@ -30,9 +35,15 @@ public:
       [&](const API::Events::FrameAdvance&) { NotifyFrameAdvanced(); });
   }
   ~BaseManip() { m_event_hub.UnlistenEvent(m_frame_advanced_listener); }
-  void Clear() { m_overrides.clear(); }
+  // Removes the overrides that were set by the given owner, e.g. a script that ended.
+  void ClearOwnedBy(const void* owner)
+  {
+    std::lock_guard lock{m_overrides_mutex};
+    std::erase_if(m_overrides, [owner](const auto& kv) { return kv.second.owner == owner; });
+  }
   void NotifyFrameAdvanced()
   {
+    std::lock_guard lock{m_overrides_mutex};
     // std::erase_if back-ported to C++17
     for (auto i = m_overrides.begin(), last = m_overrides.end(); i != last; )
     {
@@ -45,6 +56,9 @@ public:
   }
 
 protected:
+  // Scripts may set overrides concurrently to each other and to emulation polling them,
+  // since scripts in interpreters with their own GIL aren't serialized by python.
+  std::mutex m_overrides_mutex;
   std::map<int, T> m_overrides;
 
 private:
@@ -52,11 +66,94 @@ private:
   API::ListenerID<API::Events::FrameAdvance> m_frame_advanced_listener;
 };
 
+// Inputs played back one per frame, per controller.
+// Lets scripts replay whole input sequences without being called back every frame.
+// The first input is used until the next frame advance, the second until the one after that,
+// and so on. Timelines are removed once all of their inputs have been played back.
+template <typename TInput>
+class InputTimelines
+{
+public:
+  InputTimelines(API::EventHub& event_hub) : m_event_hub(event_hub)
+  {
+    m_frame_advanced_listener = m_event_hub.ListenEvent<API::Events::FrameAdvance>(
+        [&](const API::Events::FrameAdvance&) { NotifyFrameAdvanced(); });
+  }
+  ~InputTimelines() { m_event_hub.UnlistenEvent(m_frame_advanced_listener); }
+
+  void Set(int controller_id, std::vector<TInput> inputs, const void* owner)
+  {
+    std::lock_guard lock{m_mutex};
+    if (inputs.empty())
+      m_timelines.erase(controller_id);
+    else
+      m_timelines[controller_id] = {std::move(inputs), 0, owner};
+  }
+
+  void Clear(int controller_id)
+  {
+    std::lock_guard lock{m_mutex};
+    m_timelines.erase(controller_id);
+  }
+
+  void ClearOwnedBy(const void* owner)
+  {
+    std::lock_guard lock{m_mutex};
+    std::erase_if(m_timelines, [owner](const auto& kv) { return kv.second.owner == owner; });
+  }
+
+  // Index of the input currently being played back, if the controller has a timeline.
+  std::optional<size_t> GetPosition(int controller_id)
+  {
+    std::lock_guard lock{m_mutex};
+    auto iter = m_timelines.find(controller_id);
+    if (iter == m_timelines.end())
+      return std::nullopt;
+    return iter->second.position;
+  }
+
+  std::optional<TInput> GetCurrentInput(int controller_id)
+  {
+    std::lock_guard lock{m_mutex};
+    auto iter = m_timelines.find(controller_id);
+    if (iter == m_timelines.end())
+      return std::nullopt;
+    return iter->second.inputs[iter->second.position];
+  }
+
+private:
+  struct Timeline
+  {
+    std::vector<TInput> inputs;
+    size_t position;
+    const void* owner;
+  };
+
+  void NotifyFrameAdvanced()
+  {
+    std::lock_guard lock{m_mutex};
+    for (auto i = m_timelines.begin(); i != m_timelines.end();)
+    {
+      if (++i->second.position >= i->second.inputs.size())
+        i = m_timelines.erase(i);
+      else
+        ++i;
+    }
+  }
+
+  std::mutex m_mutex;
+  std::map<int, Timeline> m_timelines;
+  API::EventHub& m_event_hub;
+  API::ListenerID<API::Events::FrameAdvance> m_frame_advanced_listener;
+};
+
 struct GCInputOverride
 {
   GCPadStatus pad_status;
   ClearOn clear_on;
   bool used;
+  // Only used as a key to remove the overrides of one owner. Never dereferenced.
+  const void* owner;
 };
 
 struct WiiInputButtonsOverride
@@ -64,6 +161,7 @@ struct WiiInputButtonsOverride
   WiimoteCommon::ButtonData button_data;
   ClearOn clear_on;
   bool used;
+  const void* owner;
 };
 
 struct IRCameraTransform
@@ -77,6 +175,7 @@ struct WiiInputIROverride
   IRCameraTransform ircamera_transform;
   ClearOn clear_on;
   bool used;
+  const void* owner;
 };
 
 struct NunchuckButtonsOverride
@@ -84,31 +183,46 @@ struct NunchuckButtonsOverride
   WiimoteEmu::Nunchuk::DataFormat button_data;
   ClearOn clear_on;
   bool used;
+  const void* owner;
 };
 
 class GCManip : public BaseManip<GCInputOverride>
 {
 public:
-  using BaseManip::BaseManip;
+  GCManip(API::EventHub& event_hub) : BaseManip(event_hub), m_timelines(event_hub) {}
+  void ClearOwnedBy(const void* owner);
   GCPadStatus Get(int controller_id);
-  void Set(GCPadStatus pad_status, int controller_id, ClearOn clear_on);
+  void Set(GCPadStatus pad_status, int controller_id, ClearOn clear_on, const void* owner);
+  // Overrides set with Set take precedence over the timeline.
+  InputTimelines<GCPadStatus>& GetTimelines() { return m_timelines; }
   void PerformInputManip(GCPadStatus* pad_status, int controller_id);
+
+private:
+  InputTimelines<GCPadStatus> m_timelines;
 };
 
 class WiiButtonsManip : public BaseManip<WiiInputButtonsOverride>
 {
 public:
-  using BaseManip::BaseManip;
+  WiiButtonsManip(API::EventHub& event_hub) : BaseManip(event_hub), m_timelines(event_hub) {}
+  void ClearOwnedBy(const void* owner);
   WiimoteCommon::ButtonData Get(int controller_id);
-  void Set(WiimoteCommon::ButtonData button_data, int controller_id, ClearOn clear_on);
+  void Set(WiimoteCommon::ButtonData button_data, int controller_id, ClearOn clear_on,
+           const void* owner);
+  // Overrides set with Set take precedence over the timeline.
+  InputTimelines<WiimoteCommon::ButtonData>& GetTimelines() { return m_timelines; }
   void PerformInputManip(WiimoteCommon::DataReportBuilder& rpt, int controller_id);
+
+private:
+  InputTimelines<WiimoteCommon::ButtonData> m_timelines;
 };
 
 class WiiIRManip : public BaseManip<WiiInputIROverride>
 {
 public:
   using BaseManip::BaseManip;
-  void Set(IRCameraTransform ircamera_transform, int controller_id, ClearOn clear_on);
+  void Set(IRCameraTransform ircamera_transform, int controller_id, ClearOn clear_on,
+           const void* owner);
   void PerformInputManip(WiimoteCommon::DataReportBuilder& rpt, int controller_id);
 };
 
@@ -117,7 +231,8 @@ class NunchuckButtonsManip : public BaseManip<NunchuckButtonsOverride>
 public:
   using BaseManip::BaseManip;
   WiimoteEmu::Nunchuk::DataFormat Get(int controller_id);
-  void Set(WiimoteEmu::Nunchuk::DataFormat button_data, int controller_id, ClearOn clear_on);
+  void Set(WiimoteEmu::Nunchuk::DataFormat button_data, int controller_id, ClearOn clear_on,
+           const void* owner);
   void PerformInputManip(WiimoteCommon::DataReportBuilder& rpt, int controller_id,
                          WiimoteEmu::EncryptionKey key);
   void SaveNunchuckState(WiimoteCommon::DataReportBuilder& rpt,
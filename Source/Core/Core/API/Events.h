@@ -4,8 +4,14 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
+#include <memory>
 #include <mutex>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -15,61 +21,78 @@ namespace API
 namespace Events
 {
 // events are defined as structs.
-// each event also has to be added to the EventHub type alias.
+// each event also has to be added to the EventHub type alias,
+// and has a name for identifying it to users, e.g. in script statistics.
 struct FrameAdvance
 {
+  static constexpr std::string_view NAME = "frameadvance";
 };
+// Emitted on the video thread, a few frames after the frame was presented.
+// `data` is RGBA8 with rows `stride` bytes apart, and only valid during the event.
 struct FrameDrawn
 {
+  static constexpr std::string_view NAME = "framedrawn";
   int width;
   int height;
+  int stride;
   const u8* data;
 };
 struct MemoryBreakpoint
 {
+  static constexpr std::string_view NAME = "memorybreakpoint";
   bool write;
   u32 addr;
   u64 value;
 };
 struct CodeBreakpoint
 {
+  static constexpr std::string_view NAME = "codebreakpoint";
   u32 addr;
 };
 struct SetInterrupt
 {
+  static constexpr std::string_view NAME = "setinterrupt";
   u32 cause_mask;
 };
 struct ClearInterrupt
 {
+  static constexpr std::string_view NAME = "clearinterrupt";
   u32 cause_mask;
 };
 struct SaveStateSave
 {
+  static constexpr std::string_view NAME = "savestatesave";
   bool toSlot;
   int slot;
 };
 struct SaveStateLoad
 {
+  static constexpr std::string_view NAME = "savestateload";
   bool fromSlot;
   int slot;
 };
 struct BeforeSaveStateLoad
 {
+  static constexpr std::string_view NAME = "beforesavestateload";
   bool fromSlot;
   int slot;
 };
 struct FrameBegin
 {
+  static constexpr std::string_view NAME = "framebegin";
 };
 struct Unpause
 {
+  static constexpr std::string_view NAME = "unpause";
 };
 struct FocusChange
 {
+  static constexpr std::string_view NAME = "focuschange";
   bool has_focus;
 };
 struct RenderGeometryChange
 {
+  static constexpr std::string_view NAME = "rendergeometrychange";
   int x;
   int y;
   int w;
@@ -77,9 +100,11 @@ struct RenderGeometryChange
 };
 struct TimerTick
 {
+  static constexpr std::string_view NAME = "timertick";
 };
 struct ScriptEnd
 {
+  static constexpr std::string_view NAME = "scriptend";
   int id;
 };
 
@@ -98,45 +123,66 @@ struct ListenerID
   u64 value;
 };
 
-// an event container manages a single event type
+// an event container manages a single event type.
+// Events like MemoryBreakpoint or SetInterrupt are emitted from hot emulation paths,
+// so emitting is optimized for the common case of nobody (or the same few) listening:
+// The persistent listeners are kept in an immutable snapshot that gets replaced as a whole
+// whenever a listener is added or removed (copy-on-write), so emitting only has to atomically
+// load the current snapshot instead of copying every listener or taking a lock.
+// Only emissions that have one-time listeners to run take the mutex.
 template <typename T>
 class EventContainer final
 {
 public:
-  bool HasListeners()
-  {
-    return !m_listener_pairs.empty() || !m_one_time_listeners.empty();
-  }
+  bool HasListeners() const { return m_num_listeners.load(std::memory_order_acquire) != 0; }
 
   void EmitEvent(T evt)
   {
-    std::lock_guard lock{m_listeners_iterate_mutex};
-    // avoid concurrent modification issues by iterating over a copy
-    std::vector<std::pair<ListenerID<T>, Listener<T>>> listener_pairs = m_listener_pairs;
-    for (auto& listener_pair : listener_pairs)
-      listener_pair.second(evt);
-    // avoid concurrent modification issues by performing a swap
-    // with an fresh empty vector.
+    if (!HasListeners())
+      return;
+
+    // Counted so that TickListeners can wait for concurrent emissions.
+    // Listeners may add or remove listeners, which only replaces the snapshot being iterated.
+    m_emissions_in_flight.fetch_add(1);
+    const std::shared_ptr<const ListenerPairs> listener_pairs = LoadListenerPairs();
     std::vector<Listener<T>> one_time_listeners;
-    std::swap(one_time_listeners, m_one_time_listeners);
+    if (m_num_one_time_listeners.load(std::memory_order_acquire) != 0)
+    {
+      std::lock_guard modify_lock{m_listeners_modify_mutex};
+      std::swap(one_time_listeners, m_one_time_listeners);
+      m_num_one_time_listeners.store(0, std::memory_order_release);
+      m_num_listeners.fetch_sub(one_time_listeners.size(), std::memory_order_release);
+    }
+    for (auto& listener_pair : *listener_pairs)
+      listener_pair.second(evt);
     for (auto& listener : one_time_listeners)
       listener(evt);
+    m_emissions_in_flight.fetch_sub(1);
   }
 
   ListenerID<T> ListenEvent(Listener<T> listener)
   {
+    std::lock_guard lock{m_listeners_modify_mutex};
     auto id = ListenerID<T>{m_next_listener_id++};
-    m_listener_pairs.emplace_back(std::pair<ListenerID<T>, Listener<T>>(id, std::move(listener)));
+    auto listener_pairs = std::make_shared<ListenerPairs>(*LoadListenerPairs());
+    listener_pairs->emplace_back(id, std::move(listener));
+    StoreListenerPairs(std::move(listener_pairs));
+    m_num_listeners.fetch_add(1, std::memory_order_release);
     return id;
   }
 
   bool UnlistenEvent(ListenerID<T> listener_id)
   {
-    for (auto it = m_listener_pairs.begin(); it != m_listener_pairs.end(); ++it)
+    std::lock_guard lock{m_listeners_modify_mutex};
+    const std::shared_ptr<const ListenerPairs> current = LoadListenerPairs();
+    for (auto it = current->begin(); it != current->end(); ++it)
     {
       if (it->first.value == listener_id.value)
       {
-        m_listener_pairs.erase(it);
+        auto listener_pairs = std::make_shared<ListenerPairs>(*current);
+        listener_pairs->erase(listener_pairs->begin() + (it - current->begin()));
+        StoreListenerPairs(std::move(listener_pairs));
+        m_num_listeners.fetch_sub(1, std::memory_order_release);
         return true;
       }
     }
@@ -145,17 +191,50 @@ public:
 
   void ListenEventOnce(Listener<T> listener)
   {
+    std::lock_guard lock{m_listeners_modify_mutex};
     m_one_time_listeners.emplace_back(std::move(listener));
+    m_num_one_time_listeners.store(m_one_time_listeners.size(), std::memory_order_release);
+    m_num_listeners.fetch_add(1, std::memory_order_release);
   }
 
+  // Waits for all concurrent emissions to finish, e.g. after unlistening, so that the removed
+  // listeners are guaranteed to not run anymore. Must not be called from within a listener.
   void TickListeners()
   {
-    std::lock_guard lock{m_listeners_iterate_mutex};
+    while (m_emissions_in_flight.load() != 0)
+      std::this_thread::yield();
   }
+
 private:
-  std::mutex m_listeners_iterate_mutex{};
-  std::vector<std::pair<ListenerID<T>, Listener<T>>> m_listener_pairs{};
+  using ListenerPairs = std::vector<std::pair<ListenerID<T>, Listener<T>>>;
+
+  // libc++ lacks std::atomic<std::shared_ptr>, so fall back to the older free functions there.
+#ifdef __cpp_lib_atomic_shared_ptr
+  std::shared_ptr<const ListenerPairs> LoadListenerPairs() const { return m_listener_pairs.load(); }
+  void StoreListenerPairs(std::shared_ptr<const ListenerPairs> listener_pairs)
+  {
+    m_listener_pairs.store(std::move(listener_pairs));
+  }
+
+  std::atomic<std::shared_ptr<const ListenerPairs>> m_listener_pairs{
+      std::make_shared<const ListenerPairs>()};
+#else
+  std::shared_ptr<const ListenerPairs> LoadListenerPairs() const
+  {
+    return std::atomic_load(&m_listener_pairs);
+  }
+  void StoreListenerPairs(std::shared_ptr<const ListenerPairs> listener_pairs)
+  {
+    std::atomic_store(&m_listener_pairs, std::move(listener_pairs));
+  }
+
+  std::shared_ptr<const ListenerPairs> m_listener_pairs = std::make_shared<const ListenerPairs>();
+#endif
+  std::mutex m_listeners_modify_mutex{};
   std::vector<Listener<T>> m_one_time_listeners{};
+  std::atomic<size_t> m_num_one_time_listeners = 0;
+  std::atomic<size_t> m_num_listeners = 0;
+  std::atomic<size_t> m_emissions_in_flight = 0;
   u64 m_next_listener_id = 0;
 };
 
@@ -166,7 +245,7 @@ class GenericEventHub final
 {
 public:
   template <typename T>
-  bool HasListeners()
+  bool HasListeners() const
   {
     return GetEventContainer<T>().HasListeners();
   }
@@ -214,6 +293,12 @@ private:
     return std::get<EventContainer<T>>(m_event_containers);
   }
 
+  template <typename T>
+  const EventContainer<T>& GetEventContainer() const
+  {
+    return std::get<EventContainer<T>>(m_event_containers);
+  }
+
   std::tuple<EventContainer<Ts>...> m_event_containers;
 };
 
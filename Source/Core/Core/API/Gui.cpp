@@ -4,12 +4,12 @@
 
 #include "Gui.h"
 
+#include <algorithm>
+#include <tuple>
+
 #include "Core/Config/MainSettings.h"
 #include "VideoCommon/OnScreenDisplay.h"
 
-#define GUI_DRAW_DEFERRED(draw_call) \
-    m_draw_calls.emplace_back([=](ImDrawList* draw_list) { draw_list->draw_call; })
-
 namespace API
 {
 
@@ -18,6 +18,218 @@ constexpr u32 ARGBToABGR(u32 color_abgr)
   return (color_abgr & 0xFF00FF00) | ((color_abgr & 0xFF) << 16) | ((color_abgr >> 16) & 0xFF);
 }
 
+void DrawCommandBuffer::Clear()
+{
+  m_commands.clear();
+  m_points.clear();
+  m_text.clear();
+}
+
+DrawCommandBuffer::DrawCommand& DrawCommandBuffer::AddCommand(DrawCommandType type, u32 color,
+                                                              std::span<const Vec2f> points)
+{
+  DrawCommand& command = m_commands.emplace_back();
+  command.type = type;
+  command.closed = false;
+  command.num_segments = 0;
+  command.color = ARGBToABGR(color);
+  command.thickness = 1.0f;
+  command.size = 0.0f;
+  command.first_point = static_cast<u32>(m_points.size());
+  command.num_points = static_cast<u32>(points.size());
+  command.text_offset = 0;
+  command.text_length = 0;
+  m_points.insert(m_points.end(), points.begin(), points.end());
+  return command;
+}
+
+void DrawCommandBuffer::DrawLine(const Vec2f a, const Vec2f b, u32 color, float thickness)
+{
+  const Vec2f points[] = {a, b};
+  AddCommand(DrawCommandType::Line, color, points).thickness = thickness;
+}
+
+void DrawCommandBuffer::DrawRect(const Vec2f a, const Vec2f b, u32 color, float rounding,
+                                 float thickness)
+{
+  const Vec2f points[] = {a, b};
+  DrawCommand& command = AddCommand(DrawCommandType::Rect, color, points);
+  command.size = rounding;
+  command.thickness = thickness;
+}
+
+void DrawCommandBuffer::DrawRectFilled(const Vec2f a, const Vec2f b, u32 color, float rounding)
+{
+  const Vec2f points[] = {a, b};
+  AddCommand(DrawCommandType::RectFilled, color, points).size = rounding;
+}
+
+void DrawCommandBuffer::DrawQuad(const Vec2f a, const Vec2f b, const Vec2f c, const Vec2f d,
+                                 u32 color, float thickness)
+{
+  const Vec2f points[] = {a, b, c, d};
+  AddCommand(DrawCommandType::Quad, color, points).thickness = thickness;
+}
+
+void DrawCommandBuffer::DrawQuadFilled(const Vec2f a, const Vec2f b, const Vec2f c, const Vec2f d,
+                                       u32 color)
+{
+  const Vec2f points[] = {a, b, c, d};
+  AddCommand(DrawCommandType::QuadFilled, color, points);
+}
+
+void DrawCommandBuffer::DrawTriangle(const Vec2f a, const Vec2f b, const Vec2f c, u32 color,
+                                     float thickness)
+{
+  const Vec2f points[] = {a, b, c};
+  AddCommand(DrawCommandType::Triangle, color, points).thickness = thickness;
+}
+
+void DrawCommandBuffer::DrawTriangleFilled(const Vec2f a, const Vec2f b, const Vec2f c, u32 color)
+{
+  const Vec2f points[] = {a, b, c};
+  AddCommand(DrawCommandType::TriangleFilled, color, points);
+}
+
+void DrawCommandBuffer::DrawCircle(const Vec2f center, float radius, u32 color, int num_segments,
+                                   float thickness)
+{
+  DrawCommand& command = AddCommand(DrawCommandType::Circle, color, {&center, 1});
+  command.size = radius;
+  command.num_segments = num_segments;
+  command.thickness = thickness;
+}
+
+void DrawCommandBuffer::DrawCircleFilled(const Vec2f center, float radius, u32 color,
+                                         int num_segments)
+{
+  DrawCommand& command = AddCommand(DrawCommandType::CircleFilled, color, {&center, 1});
+  command.size = radius;
+  command.num_segments = num_segments;
+}
+
+void DrawCommandBuffer::DrawText(const Vec2f pos, u32 color, std::string_view text)
+{
+  DrawCommand& command = AddCommand(DrawCommandType::Text, color, {&pos, 1});
+  command.text_offset = static_cast<u32>(m_text.size());
+  command.text_length = static_cast<u32>(text.size());
+  m_text.append(text);
+}
+
+void DrawCommandBuffer::DrawPolyline(std::span<const Vec2f> points, u32 color, bool closed,
+                                     float thickness)
+{
+  DrawCommand& command = AddCommand(DrawCommandType::Polyline, color, points);
+  command.closed = closed;
+  command.thickness = thickness;
+}
+
+void DrawCommandBuffer::DrawConvexPolyFilled(std::span<const Vec2f> points, u32 color)
+{
+  AddCommand(DrawCommandType::ConvexPolyFilled, color, points);
+}
+
+void DrawCommandBuffer::Append(const DrawCommandBuffer& other)
+{
+  const u32 point_offset = static_cast<u32>(m_points.size());
+  const u32 text_offset = static_cast<u32>(m_text.size());
+  m_commands.reserve(m_commands.size() + other.m_commands.size());
+  for (DrawCommand command : other.m_commands)
+  {
+    command.first_point += point_offset;
+    command.text_offset += text_offset;
+    m_commands.push_back(command);
+  }
+  m_points.insert(m_points.end(), other.m_points.begin(), other.m_points.end());
+  m_text.append(other.m_text);
+}
+
+static void DrawOutlinedText(ImDrawList* draw_list, const TextStyle& style, const Vec2f pos,
+                             u32 color, const char* text_begin, const char* text_end)
+{
+  static constexpr Vec2f THIN_OFFSETS[] = {{1, 0}, {-1, 0}, {0, -1}, {0, 1}};
+  static constexpr Vec2f THICK_OFFSETS[] = {{1, 1}, {-1, -1}, {1, -1}, {-1, 1}};
+  const bool thin = style.outline == Config::OutlineRes::Thin ||
+                    style.outline == Config::OutlineRes::Full;
+  const bool thick = style.outline == Config::OutlineRes::Thick ||
+                     style.outline == Config::OutlineRes::Full;
+  // Inverts the color, but keeps the alpha.
+  const u32 outline_color = color ^ 0x00FFFFFF;
+  if (thin)
+  {
+    for (const Vec2f& offset : THIN_OFFSETS)
+    {
+      draw_list->AddText(style.font, style.font_size, {pos.x + offset.x, pos.y + offset.y},
+                         outline_color, text_begin, text_end);
+    }
+  }
+  if (thick)
+  {
+    for (const Vec2f& offset : THICK_OFFSETS)
+    {
+      draw_list->AddText(style.font, style.font_size, {pos.x + offset.x, pos.y + offset.y},
+                         outline_color, text_begin, text_end);
+    }
+  }
+  draw_list->AddText(style.font, style.font_size, pos, color, text_begin, text_end);
+}
+
+void DrawCommandBuffer::Execute(ImDrawList* draw_list, const TextStyle& text_style) const
+{
+  for (const DrawCommand& command : m_commands)
+  {
+    const Vec2f* p = m_points.data() + command.first_point;
+    switch (command.type)
+    {
+    case DrawCommandType::Line:
+      draw_list->AddLine(p[0], p[1], command.color, command.thickness);
+      break;
+    case DrawCommandType::Rect:
+      draw_list->AddRect(p[0], p[1], command.color, command.size, ImDrawFlags_RoundCornersAll,
+                         command.thickness);
+      break;
+    case DrawCommandType::RectFilled:
+      draw_list->AddRectFilled(p[0], p[1], command.color, command.size,
+                               ImDrawFlags_RoundCornersAll);
+      break;
+    case DrawCommandType::Quad:
+      draw_list->AddQuad(p[0], p[1], p[2], p[3], command.color, command.thickness);
+      break;
+    case DrawCommandType::QuadFilled:
+      draw_list->AddQuadFilled(p[0], p[1], p[2], p[3], command.color);
+      break;
+    case DrawCommandType::Triangle:
+      draw_list->AddTriangle(p[0], p[1], p[2], command.color, command.thickness);
+      break;
+    case DrawCommandType::TriangleFilled:
+      draw_list->AddTriangleFilled(p[0], p[1], p[2], command.color);
+      break;
+    case DrawCommandType::Circle:
+      draw_list->AddCircle(p[0], command.size, command.color, command.num_segments,
+                           command.thickness);
+      break;
+    case DrawCommandType::CircleFilled:
+      draw_list->AddCircleFilled(p[0], command.size, command.color, command.num_segments);
+      break;
+    case DrawCommandType::Text:
+    {
+      const char* text = m_text.data() + command.text_offset;
+      DrawOutlinedText(draw_list, text_style, p[0], command.color, text,
+                       text + command.text_length);
+      break;
+    }
+    case DrawCommandType::Polyline:
+      draw_list->AddPolyline(p, static_cast<int>(command.num_points), command.color,
+                             command.closed ? ImDrawFlags_Closed : ImDrawFlags_None,
+                             command.thickness);
+      break;
+    case DrawCommandType::ConvexPolyFilled:
+      draw_list->AddConvexPolyFilled(p, static_cast<int>(command.num_points), command.color);
+      break;
+    }
+  }
+}
+
 void Gui::AddOSDMessage(std::string message, u32 duration_ms, u32 color)
 {
   OSD::AddMessage(message, duration_ms, color);
@@ -30,8 +242,14 @@ void Gui::ClearOSDMessages()
 
 void Gui::Render()
 {
-  std::vector<std::function<void(ImDrawList*)>> draw_calls;
-  std::swap(draw_calls, m_draw_calls);
+  std::vector<std::shared_ptr<const DrawCommandBuffer>> layers;
+  {
+    std::lock_guard lock{m_mutex};
+    std::swap(m_render_commands, m_frame_commands);
+    layers = m_sorted_layers;
+  }
+  if (m_render_commands.Empty() && layers.empty())
+    return;
 
   ImGui::SetNextWindowPos(ImVec2{0, 0});
   ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
@@ -40,11 +258,18 @@ void Gui::Render()
                       ImGuiWindowFlags_NoMouseInputs | ImGuiWindowFlags_NoNavInputs |
                       ImGuiWindowFlags_NoNavFocus;
 
+  const TextStyle text_style{g_font, static_cast<float>(Config::Get(Config::MAIN_IMGUI_FONT_SIZE)),
+                             Config::Get(Config::MAIN_IMGUI_OUTLINE_RES)};
+
   ImGui::Begin("gui api", nullptr, flags);
   ImDrawList* draw_list = ImGui::GetWindowDrawList();
-  for (auto call : draw_calls)
-    call(draw_list);
+  for (const auto& layer : layers)
+    layer->Execute(draw_list, text_style);
+  m_render_commands.Execute(draw_list, text_style);
   ImGui::End();
+
+  // Swapped back in on the next frame to collect commands, with the capacity it grew to.
+  m_render_commands.Clear();
 }
 
 Vec2f Gui::GetDisplaySize()
@@ -54,115 +279,115 @@ Vec2f Gui::GetDisplaySize()
 
 void Gui::DrawLine(const Vec2f a, const Vec2f b, u32 color, float thickness)
 {
-  GUI_DRAW_DEFERRED(AddLine(a, b, ARGBToABGR(color), thickness));
+  std::lock_guard lock{m_mutex};
+  m_frame_commands.DrawLine(a, b, color, thickness);
 }
 
 void Gui::DrawRect(const Vec2f a, const Vec2f b, u32 color, float rounding, float thickness)
 {
-  GUI_DRAW_DEFERRED(
-      AddRect(a, b, ARGBToABGR(color), rounding, ImDrawFlags_RoundCornersAll, thickness));
+  std::lock_guard lock{m_mutex};
+  m_frame_commands.DrawRect(a, b, color, rounding, thickness);
 }
 
 void Gui::DrawRectFilled(const Vec2f a, const Vec2f b, u32 color, float rounding)
 {
-  GUI_DRAW_DEFERRED(AddRectFilled(a, b, ARGBToABGR(color), rounding, ImDrawFlags_RoundCornersAll));
+  std::lock_guard lock{m_mutex};
+  m_frame_commands.DrawRectFilled(a, b, color, rounding);
 }
 
 void Gui::DrawQuad(const Vec2f a, const Vec2f b, const Vec2f c, const Vec2f d, u32 color,
                    float thickness)
 {
-  GUI_DRAW_DEFERRED(AddQuad(a, b, c, d, ARGBToABGR(color), thickness));
+  std::lock_guard lock{m_mutex};
+  m_frame_commands.DrawQuad(a, b, c, d, color, thickness);
 }
 
 void Gui::DrawQuadFilled(const Vec2f a, const Vec2f b, const Vec2f c, const Vec2f d, u32 color)
 {
-  GUI_DRAW_DEFERRED(AddQuadFilled(a, b, c, d, ARGBToABGR(color)));
+  std::lock_guard lock{m_mutex};
+  m_frame_commands.DrawQuadFilled(a, b, c, d, color);
 }
 
 void Gui::DrawTriangle(const Vec2f a, const Vec2f b, const Vec2f c, u32 color, float thickness)
 {
-  GUI_DRAW_DEFERRED(AddTriangle(a, b, c, ARGBToABGR(color), thickness));
+  std::lock_guard lock{m_mutex};
+  m_frame_commands.DrawTriangle(a, b, c, color, thickness);
 }
 
 void Gui::DrawTriangleFilled(const Vec2f a, const Vec2f b, const Vec2f c, u32 color)
 {
-  GUI_DRAW_DEFERRED(AddTriangleFilled(a, b, c, ARGBToABGR(color)));
+  std::lock_guard lock{m_mutex};
+  m_frame_commands.DrawTriangleFilled(a, b, c, color);
 }
 
 void Gui::DrawCircle(const Vec2f center, float radius, u32 color, int num_segments, float thickness)
 {
-  GUI_DRAW_DEFERRED(AddCircle(center, radius, ARGBToABGR(color), num_segments, thickness));
+  std::lock_guard lock{m_mutex};
+  m_frame_commands.DrawCircle(center, radius, color, num_segments, thickness);
 }
 
 void Gui::DrawCircleFilled(const Vec2f center, float radius, u32 color, int num_segments)
 {
-  GUI_DRAW_DEFERRED(AddCircleFilled(center, radius, ARGBToABGR(color), num_segments));
+  std::lock_guard lock{m_mutex};
+  m_frame_commands.DrawCircleFilled(center, radius, color, num_segments);
 }
 
-void Gui::CreateThickOutline(const Vec2f& pos, u32 color, std::string& text)
+void Gui::DrawText(const Vec2f pos, u32 color, std::string_view text)
 {
-  GUI_DRAW_DEFERRED(AddText(API::g_font, Config::Get(Config::MAIN_IMGUI_FONT_SIZE),
-                            ImVec2(pos.x + 1, pos.y + 1), ARGBToABGR(color ^ 0x00FFFFFF),
-                            text.c_str()));
-  GUI_DRAW_DEFERRED(AddText(API::g_font, Config::Get(Config::MAIN_IMGUI_FONT_SIZE),
-                            ImVec2(pos.x - 1, pos.y - 1), ARGBToABGR(color ^ 0x00FFFFFF),
-                            text.c_str()));
-  GUI_DRAW_DEFERRED(AddText(API::g_font, Config::Get(Config::MAIN_IMGUI_FONT_SIZE),
-                            ImVec2(pos.x + 1, pos.y - 1), ARGBToABGR(color ^ 0x00FFFFFF),
-                            text.c_str()));
-  GUI_DRAW_DEFERRED(AddText(API::g_font, Config::Get(Config::MAIN_IMGUI_FONT_SIZE),
-                            ImVec2(pos.x - 1, pos.y + 1), ARGBToABGR(color ^ 0x00FFFFFF),
-                            text.c_str()));
+  std::lock_guard lock{m_mutex};
+  m_frame_commands.DrawText(pos, color, text);
 }
 
-void Gui::CreateThinOutline(const Vec2f& pos, u32 color, std::string& text)
+void Gui::DrawPolyline(std::span<const Vec2f> points, u32 color, bool closed, float thickness)
 {
-  GUI_DRAW_DEFERRED(AddText(API::g_font, Config::Get(Config::MAIN_IMGUI_FONT_SIZE),
-                            ImVec2(pos.x + 1, pos.y), ARGBToABGR(color ^ 0x00FFFFFF),
-                            text.c_str()));
-  GUI_DRAW_DEFERRED(AddText(API::g_font, Config::Get(Config::MAIN_IMGUI_FONT_SIZE),
-                            ImVec2(pos.x - 1, pos.y), ARGBToABGR(color ^ 0x00FFFFFF),
-                            text.c_str()));
-  GUI_DRAW_DEFERRED(AddText(API::g_font, Config::Get(Config::MAIN_IMGUI_FONT_SIZE),
-                            ImVec2(pos.x, pos.y - 1), ARGBToABGR(color ^ 0x00FFFFFF),
-                            text.c_str()));
-  GUI_DRAW_DEFERRED(AddText(API::g_font, Config::Get(Config::MAIN_IMGUI_FONT_SIZE),
-                            ImVec2(pos.x, pos.y + 1), ARGBToABGR(color ^ 0x00FFFFFF),
-                            text.c_str()));
+  std::lock_guard lock{m_mutex};
+  m_frame_commands.DrawPolyline(points, color, closed, thickness);
 }
 
-void Gui::DrawText(const Vec2f pos, u32 color, std::string text)
+void Gui::DrawConvexPolyFilled(std::span<const Vec2f> points, u32 color)
 {
-  switch (Config::Get(Config::MAIN_IMGUI_OUTLINE_RES))
-  {
-  case Config::OutlineRes::Full:
-    CreateThinOutline(pos, color, text);
-    CreateThickOutline(pos, color, text);
-    break;
-  case Config::OutlineRes::Thick:
-    CreateThickOutline(pos, color, text);
-    break;
-  case Config::OutlineRes::Thin:
-    CreateThinOutline(pos, color, text);
-    break;
-  }
+  std::lock_guard lock{m_mutex};
+  m_frame_commands.DrawConvexPolyFilled(points, color);
+}
 
-  GUI_DRAW_DEFERRED(AddText(API::g_font, Config::Get(Config::MAIN_IMGUI_FONT_SIZE), pos,
-                            ARGBToABGR(color), text.c_str()));
+void Gui::DrawCommands(const DrawCommandBuffer& commands)
+{
+  std::lock_guard lock{m_mutex};
+  m_frame_commands.Append(commands);
 }
 
-void Gui::DrawPolyline(const std::vector<Vec2f> points, u32 color, bool closed, float thickness)
+void Gui::SetLayer(const void* owner, const std::string& name, int order,
+                   DrawCommandBuffer commands)
 {
-  GUI_DRAW_DEFERRED(
-      AddPolyline(points.data(), (int)points.size(), color, ARGBToABGR(color), thickness));
+  auto shared_commands = std::make_shared<const DrawCommandBuffer>(std::move(commands));
+  std::lock_guard lock{m_mutex};
+  m_layers[LayerKey{owner, name}] = Layer{order, std::move(shared_commands)};
+  UpdateSortedLayers();
 }
 
-void Gui::DrawConvexPolyFilled(const std::vector<Vec2f> points, u32 color)
+void Gui::RemoveLayer(const void* owner, const std::string& name)
 {
-  GUI_DRAW_DEFERRED(AddConvexPolyFilled(points.data(), (int)points.size(), ARGBToABGR(color)));
+  std::lock_guard lock{m_mutex};
+  if (m_layers.erase(LayerKey{owner, name}) != 0)
+    UpdateSortedLayers();
 }
 
-#undef GUI_DRAW_DEFERRED
+void Gui::UpdateSortedLayers()
+{
+  using LayerEntry = std::map<LayerKey, Layer>::value_type;
+  std::vector<const LayerEntry*> layers;
+  layers.reserve(m_layers.size());
+  for (const LayerEntry& entry : m_layers)
+    layers.push_back(&entry);
+  // Layers with the same order are drawn sorted by name. Owners are compared last, because the
+  // order of their addresses isn't stable across runs.
+  std::stable_sort(layers.begin(), layers.end(), [](const LayerEntry* a, const LayerEntry* b) {
+    return std::tie(a->second.order, a->first.second) < std::tie(b->second.order, b->first.second);
+  });
+  m_sorted_layers.clear();
+  for (const LayerEntry* entry : layers)
+    m_sorted_layers.push_back(entry->second.commands);
+}
 
 Gui& GetGui()
 {
@@ -4,19 +4,110 @@
 
 #pragma once
 
-#include <functional>
 #include <imgui.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <span>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
 
 using Vec2f = ImVec2;
 
+namespace Config
+{
+enum class OutlineRes;
+}
+
 namespace API
 {
 
-static ImFont* g_font;
+inline ImFont* g_font = nullptr;
+
+// How text commands are drawn. Read from the config once per frame.
+struct TextStyle
+{
+  ImFont* font;
+  float font_size;
+  Config::OutlineRes outline;
+};
+
+// A list of draw commands that can be recorded anywhere and executed later on the video thread.
+// Commands are stored as plain structs, with their points and text kept in shared arrays,
+// so recording a command only appends to a few vectors.
+// All colors are ARGB.
+class DrawCommandBuffer
+{
+public:
+  void Clear();
+  bool Empty() const { return m_commands.empty(); }
+  size_t Size() const { return m_commands.size(); }
+
+  void DrawLine(const Vec2f a, const Vec2f b, u32 color, float thickness = 1.0f);
+  void DrawRect(const Vec2f a, const Vec2f b, u32 color, float rounding = 0.0f,
+                float thickness = 1.0f);
+  void DrawRectFilled(const Vec2f a, const Vec2f b, u32 color, float rounding = 0.0f);
+  void DrawQuad(const Vec2f a, const Vec2f b, const Vec2f c, const Vec2f d, u32 color,
+                float thickness = 1.0f);
+  void DrawQuadFilled(const Vec2f a, const Vec2f b, const Vec2f c, const Vec2f d, u32 color);
+  void DrawTriangle(const Vec2f a, const Vec2f b, const Vec2f c, u32 color, float thickness = 1.0f);
+  void DrawTriangleFilled(const Vec2f a, const Vec2f b, const Vec2f c, u32 color);
+  void DrawCircle(const Vec2f center, float radius, u32 color, int num_segments = 12,
+                  float thickness = 1.0f);
+  void DrawCircleFilled(const Vec2f center, float radius, u32 color, int num_segments = 12);
+  void DrawText(const Vec2f pos, u32 color, std::string_view text);
+  void DrawPolyline(std::span<const Vec2f> points, u32 color, bool closed, float thickness);
+  void DrawConvexPolyFilled(std::span<const Vec2f> points, u32 color);
+
+  // Appends all commands of another buffer.
+  void Append(const DrawCommandBuffer& other);
+
+  void Execute(ImDrawList* draw_list, const TextStyle& text_style) const;
+
+private:
+  enum class DrawCommandType : u8
+  {
+    Line,
+    Rect,
+    RectFilled,
+    Quad,
+    QuadFilled,
+    Triangle,
+    TriangleFilled,
+    Circle,
+    CircleFilled,
+    Text,
+    Polyline,
+    ConvexPolyFilled,
+  };
+
+  struct DrawCommand
+  {
+    DrawCommandType type;
+    bool closed;
+    int num_segments;
+    // ABGR, as expected by ImGui
+    u32 color;
+    float thickness;
+    // Corner rounding of rects, radius of circles
+    float size;
+    u32 first_point;
+    u32 num_points;
+    u32 text_offset;
+    u32 text_length;
+  };
+
+  DrawCommand& AddCommand(DrawCommandType type, u32 color, std::span<const Vec2f> points);
+
+  std::vector<DrawCommand> m_commands;
+  std::vector<Vec2f> m_points;
+  std::string m_text;
+};
+
 class Gui
 {
 public:
@@ -28,6 +119,8 @@ public:
   void Render();
 
   Vec2f GetDisplaySize();
+
+  // Commands drawn with these are only drawn for the next frame.
   void DrawLine(const Vec2f a, const Vec2f b, u32 color, float thickness = 1.0f);
   void DrawRect(const Vec2f a, const Vec2f b, u32 color, float rounding = 0.0f,
                 float thickness = 1.0f);
@@ -40,19 +133,38 @@ public:
   void DrawCircle(const Vec2f center, float radius, u32 color, int num_segments = 12,
                   float thickness = 1.0f);
   void DrawCircleFilled(const Vec2f center, float radius, u32 color, int num_segments = 12);
-  void DrawText(const Vec2f pos, u32 color, std::string text);
-  void CreateThickOutline(const Vec2f& pos, u32 color, std::string& text);
-  void CreateThinOutline(const Vec2f& pos, u32 color, std::string& text);
-  void DrawPolyline(const std::vector<Vec2f> points, u32 color, bool closed, float thickness);
-  void DrawConvexPolyFilled(const std::vector<Vec2f> points, u32 color);
+  void DrawText(const Vec2f pos, u32 color, std::string_view text);
+  void DrawPolyline(std::span<const Vec2f> points, u32 color, bool closed, float thickness);
+  void DrawConvexPolyFilled(std::span<const Vec2f> points, u32 color);
+  void DrawCommands(const DrawCommandBuffer& commands);
+
+  // Layers are drawn every frame until they are changed or removed,
+  // in ascending order, and below the commands that are only drawn for the next frame.
+  // Each owner (e.g. a script) has its own layer names, so owners can't replace or remove
+  // each other's layers. The owner is only used as a key and never dereferenced.
+  void SetLayer(const void* owner, const std::string& name, int order,
+                DrawCommandBuffer commands);
+  void RemoveLayer(const void* owner, const std::string& name);
 
 private:
-  // Pushing all draw calls onto a vector of functions is probably not
-  // the most efficient thing in the world, but it seems to be negligible.
-  // Since we want script code to be able to draw stuff whenever it wants
-  // without having to worry about when exactly to draw, just deferring the
-  // execution of draw calls like this is an easy solution.
-  std::vector<std::function<void(ImDrawList*)>> m_draw_calls;
+  using LayerKey = std::pair<const void*, std::string>;
+
+  struct Layer
+  {
+    int order;
+    std::shared_ptr<const DrawCommandBuffer> commands;
+  };
+
+  void UpdateSortedLayers();
+
+  // Drawing happens on the video thread, while scripts draw from wherever they run.
+  std::mutex m_mutex;
+  DrawCommandBuffer m_frame_commands;
+  // The commands of the frame being rendered. Only touched by Render on the video thread.
+  DrawCommandBuffer m_render_commands;
+  std::map<LayerKey, Layer> m_layers;
+  // m_layers' commands in drawing order, so rendering doesn't need to sort them every frame.
+  std::vector<std::shared_ptr<const DrawCommandBuffer>> m_sorted_layers;
 };
 
 // global instance
@@ -6,6 +6,7 @@
 
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/PowerPC/BreakPoints.h"
+#include "Core/PowerPC/MMU.h"
 
 namespace API::Memory
 {
@@ -26,4 +27,25 @@ void RemoveMemcheck(u32 addr)
   guard.GetSystem().GetPowerPC().GetMemChecks().Remove(addr);
 }
 
+static bool IsRAMRange(const Core::CPUThreadGuard& guard, u32 addr, u32 size)
+{
+  return PowerPC::MMU::HostIsRAMAddress(guard, addr) &&
+         PowerPC::MMU::HostIsRAMAddress(guard, addr + size - 1);
+}
+
+std::optional<u32> ResolvePointerChain(const Core::CPUThreadGuard& guard, u32 base,
+                                       const std::vector<s32>& offsets, u32 size)
+{
+  u32 addr = base;
+  for (const s32 offset : offsets)
+  {
+    if (!IsRAMRange(guard, addr, sizeof(u32)))
+      return std::nullopt;
+    addr = Read_U32(guard, addr) + static_cast<u32>(offset);
+  }
+  if (!IsRAMRange(guard, addr, size))
+    return std::nullopt;
+  return addr;
+}
+
 }  // namespace API::Memory
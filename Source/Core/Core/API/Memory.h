@@ -4,7 +4,11 @@
 
 #pragma once
 
+#include <optional>
+#include <vector>
+
 #include "Common/CommonTypes.h"
+#include "Common/Swap.h"
 #include "Core/HW/Memmap.h"
 #include "Core/Core.h"
 #include "Core/System.h"
@@ -18,6 +22,14 @@ namespace API::Memory
 void AddMemcheck(u32 addr);
 void RemoveMemcheck(u32 addr);
 
+// pointer chains
+
+// Starting at `base`, for each offset reads a pointer and adds the offset to it.
+// Returns an empty optional if any pointer, or the `size` bytes at the resulting address,
+// are not in RAM.
+std::optional<u32> ResolvePointerChain(const Core::CPUThreadGuard& guard, u32 base,
+                                       const std::vector<s32>& offsets, u32 size);
+
 // memory reading: just directly forward to the MMU
 
 inline u8 Read_U8(const Core::CPUThreadGuard &guard, u32 addr)
@@ -75,6 +87,20 @@ inline char* Read_Bytes(const Core::CPUThreadGuard& guard, u32 addr, u32 size)
   return guard.GetSystem().GetMMU().HostRead_Bytes(guard, addr, size);
 }
 
+inline void Read_Bytes(const Core::CPUThreadGuard& guard, u32 addr, char* out, u32 size)
+{
+  guard.GetSystem().GetMMU().HostRead_Bytes(guard, addr, out, size);
+}
+
+// Reads `count` consecutive values of type T and converts them to host byte order.
+// `out` doesn't need to be aligned.
+template <typename T>
+inline void Read_Array(const Core::CPUThreadGuard& guard, u32 addr, void* out, u32 count)
+{
+  Read_Bytes(guard, addr, static_cast<char*>(out), count * sizeof(T));
+  Common::SwapArray<sizeof(T)>(out, out, count);
+}
+
 // memory writing: arguments of write functions are swapped (address first) to be consistent with other scripting APIs
 
 inline void InvalidateICache(const Core::CPUThreadGuard &guard, u32 addr, u32 size)
@@ -138,4 +164,14 @@ inline void Write_Bytes(const Core::CPUThreadGuard& guard, u32 addr, char* bytes
   guard.GetSystem().GetMMU().HostWrite_Bytes(guard, addr, bytes, size);
 }
 
+// Writes `count` consecutive values of type T given in host byte order.
+// `values` doesn't need to be aligned.
+template <typename T>
+inline void Write_Array(const Core::CPUThreadGuard& guard, u32 addr, const void* values, u32 count)
+{
+  std::vector<char> bytes(count * sizeof(T));
+  Common::SwapArray<sizeof(T)>(bytes.data(), values, count);
+  Write_Bytes(guard, addr, bytes.data(), bytes.size());
+}
+
 }  // namespace API::Memory
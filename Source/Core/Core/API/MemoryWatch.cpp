@@ -0,0 +1,70 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/API/MemoryWatch.h"
+
+#include <utility>
+
+#include "Core/API/Memory.h"
+
+namespace API
+{
+
+static u64 ReadRaw(const Core::CPUThreadGuard& guard, u32 addr, u32 size)
+{
+  switch (size)
+  {
+  case 1:
+    return Memory::Read_U8(guard, addr);
+  case 2:
+    return Memory::Read_U16(guard, addr);
+  case 8:
+    return Memory::Read_U64(guard, addr);
+  default:
+    return Memory::Read_U32(guard, addr);
+  }
+}
+
+size_t MemoryWatchList::Add(Entry entry)
+{
+  m_values.push_back(WatchedValue{std::move(entry)});
+  return m_values.size() - 1;
+}
+
+size_t MemoryWatchList::Size() const
+{
+  return m_values.size();
+}
+
+const MemoryWatchList::Entry& MemoryWatchList::GetEntry(size_t index) const
+{
+  return m_values[index].entry;
+}
+
+std::optional<u64> MemoryWatchList::GetValue(size_t index) const
+{
+  return m_values[index].value;
+}
+
+void MemoryWatchList::Poll(const Core::CPUThreadGuard& guard, std::vector<size_t>* changed)
+{
+  for (size_t i = 0; i < m_values.size(); i++)
+  {
+    WatchedValue& watched = m_values[i];
+    const Entry& entry = watched.entry;
+
+    std::optional<u64> value;
+    const std::optional<u32> addr =
+        Memory::ResolvePointerChain(guard, entry.base, entry.offsets, entry.size);
+    if (addr.has_value())
+      value = ReadRaw(guard, addr.value(), entry.size);
+
+    if (watched.polled && watched.value == value)
+      continue;
+    watched.polled = true;
+    watched.value = value;
+    changed->push_back(i);
+  }
+}
+
+}  // namespace API
@@ -0,0 +1,59 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace Core
+{
+class CPUThreadGuard;
+}
+
+namespace API
+{
+
+// A list of memory locations that gets polled as a whole, typically once per frame.
+// Each poll reports only the entries whose value changed since the previous poll,
+// so consumers don't have to read and compare every location themselves.
+class MemoryWatchList final
+{
+public:
+  struct Entry
+  {
+    // Starting at `base`, for each offset a pointer is read and the offset is added to it.
+    // See API::Memory::ResolvePointerChain.
+    u32 base = 0;
+    std::vector<s32> offsets;
+    // Size of the watched value in bytes: 1, 2, 4 or 8.
+    u32 size = 4;
+  };
+
+  size_t Add(Entry entry);
+  size_t Size() const;
+  const Entry& GetEntry(size_t index) const;
+
+  // The entry's raw value as of the last poll, in host byte order.
+  // Empty if the entry hasn't been polled yet or its pointer chain was invalid.
+  std::optional<u64> GetValue(size_t index) const;
+
+  // Reads all entries and appends the indices of the entries that changed to `changed`.
+  // On the first poll, every entry counts as changed.
+  void Poll(const Core::CPUThreadGuard& guard, std::vector<size_t>* changed);
+
+private:
+  struct WatchedValue
+  {
+    Entry entry;
+    std::optional<u64> value;
+    bool polled = false;
+  };
+
+  std::vector<WatchedValue> m_values;
+};
+
+}  // namespace API
@@ -0,0 +1,156 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/API/ScriptStats.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+
+namespace API
+{
+
+int DurationHistogram::GetBucket(u64 nanoseconds)
+{
+  constexpr u64 sub_buckets = 1 << SUB_BUCKET_BITS;
+  if (nanoseconds < sub_buckets)
+    return static_cast<int>(nanoseconds);
+  // The highest bit selects the power of two, the bits below it select the sub-bucket.
+  const int exponent = std::bit_width(nanoseconds) - 1;
+  const u64 mantissa = (nanoseconds >> (exponent - SUB_BUCKET_BITS)) & (sub_buckets - 1);
+  const int bucket = ((exponent - SUB_BUCKET_BITS + 1) << SUB_BUCKET_BITS) + int(mantissa);
+  return std::min(bucket, NUM_BUCKETS - 1);
+}
+
+u64 DurationHistogram::GetBucketUpperBound(int bucket)
+{
+  constexpr int sub_buckets = 1 << SUB_BUCKET_BITS;
+  if (bucket < sub_buckets)
+    return static_cast<u64>(bucket);
+  const int exponent = (bucket >> SUB_BUCKET_BITS) + SUB_BUCKET_BITS - 1;
+  const u64 mantissa = static_cast<u64>(bucket & (sub_buckets - 1));
+  return ((sub_buckets + mantissa + 1) << (exponent - SUB_BUCKET_BITS)) - 1;
+}
+
+void DurationHistogram::Add(DT duration)
+{
+  const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+  m_buckets[GetBucket(static_cast<u64>(std::max<s64>(nanoseconds, 0)))]++;
+  m_count++;
+}
+
+void DurationHistogram::Reset()
+{
+  m_buckets.fill(0);
+  m_count = 0;
+}
+
+DT DurationHistogram::GetPercentile(double percentile) const
+{
+  if (m_count == 0)
+    return DT::zero();
+  const u64 rank =
+      std::clamp<u64>(static_cast<u64>(std::ceil(percentile * m_count)), 1, m_count);
+  u64 seen = 0;
+  for (int bucket = 0; bucket < NUM_BUCKETS; bucket++)
+  {
+    seen += m_buckets[bucket];
+    if (seen >= rank)
+    {
+      return std::chrono::duration_cast<DT>(
+          std::chrono::nanoseconds(GetBucketUpperBound(bucket)));
+    }
+  }
+  return std::chrono::duration_cast<DT>(
+      std::chrono::nanoseconds(GetBucketUpperBound(NUM_BUCKETS - 1)));
+}
+
+ScriptProfile::ScriptProfile(std::string name, std::vector<std::string_view> event_names)
+    : m_name(std::move(name)), m_event_names(std::move(event_names)),
+      m_stats(m_event_names.size())
+{
+}
+
+void ScriptProfile::RecordCallbacks(size_t event_index, DT gil_wait_time,
+                                    std::span<const DT> callback_times)
+{
+  std::lock_guard lock{m_mutex};
+  EventStats& stats = m_stats[event_index];
+  stats.callbacks += callback_times.size();
+  stats.gil_wait_time += gil_wait_time;
+  for (const DT time : callback_times)
+  {
+    stats.total_time += time;
+    stats.callback_times.Add(time);
+  }
+}
+
+void ScriptProfile::RecordCoroutineResumes(size_t event_index, u64 count)
+{
+  std::lock_guard lock{m_mutex};
+  m_stats[event_index].coroutine_resumes += count;
+}
+
+std::vector<ScriptEventStats> ScriptProfile::GetStats() const
+{
+  std::lock_guard lock{m_mutex};
+  std::vector<ScriptEventStats> result;
+  for (size_t i = 0; i < m_stats.size(); i++)
+  {
+    const EventStats& stats = m_stats[i];
+    if (stats.callbacks == 0 && stats.coroutine_resumes == 0)
+      continue;
+    result.push_back({
+        .event_name = m_event_names[i],
+        .callbacks = stats.callbacks,
+        .coroutine_resumes = stats.coroutine_resumes,
+        .total_time = stats.total_time,
+        .p99_time = stats.callback_times.GetPercentile(0.99),
+        .gil_wait_time = stats.gil_wait_time,
+    });
+  }
+  return result;
+}
+
+void ScriptProfile::Reset()
+{
+  std::lock_guard lock{m_mutex};
+  for (EventStats& stats : m_stats)
+    stats = EventStats{};
+}
+
+std::shared_ptr<ScriptProfile> ScriptProfiler::AddProfile(std::string name,
+                                                          std::vector<std::string_view> event_names)
+{
+  auto profile = std::make_shared<ScriptProfile>(std::move(name), std::move(event_names));
+  std::lock_guard lock{m_mutex};
+  m_profiles.push_back(profile);
+  return profile;
+}
+
+void ScriptProfiler::RemoveProfile(const std::shared_ptr<ScriptProfile>& profile)
+{
+  std::lock_guard lock{m_mutex};
+  std::erase(m_profiles, profile);
+}
+
+std::vector<std::shared_ptr<ScriptProfile>> ScriptProfiler::GetProfiles() const
+{
+  std::lock_guard lock{m_mutex};
+  return m_profiles;
+}
+
+void ScriptProfiler::ResetAll()
+{
+  for (const std::shared_ptr<ScriptProfile>& profile : GetProfiles())
+    profile->Reset();
+}
+
+ScriptProfiler& GetScriptProfiler()
+{
+  static ScriptProfiler profiler;
+  return profiler;
+}
+
+}  // namespace API
@@ -0,0 +1,111 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Statistics about how much time scripts spend handling events,
+// to find out which script is slowing down emulation.
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace API
+{
+
+// Counts durations in buckets growing exponentially (four per power of two nanoseconds),
+// which allows for approximating percentiles with a fixed amount of memory.
+class DurationHistogram
+{
+public:
+  void Add(DT duration);
+  void Reset();
+  u64 GetCount() const { return m_count; }
+  // Returns the upper bound of the bucket containing the given percentile (between 0 and 1),
+  // which overestimates it by at most 25%.
+  DT GetPercentile(double percentile) const;
+
+private:
+  static constexpr int SUB_BUCKET_BITS = 2;
+  // Up to 2^41ns, which is about 36 minutes. Longer durations are counted in the last bucket.
+  static constexpr int NUM_BUCKETS = 40 << SUB_BUCKET_BITS;
+
+  static int GetBucket(u64 nanoseconds);
+  static u64 GetBucketUpperBound(int bucket);
+
+  std::array<u64, NUM_BUCKETS> m_buckets{};
+  u64 m_count = 0;
+};
+
+struct ScriptEventStats
+{
+  std::string_view event_name;
+  // How often python listeners were run for the event.
+  u64 callbacks = 0;
+  // How often coroutines awaiting something were resumed while handling the event.
+  u64 coroutine_resumes = 0;
+  // Wall time spent in python listeners.
+  DT total_time{};
+  DT p99_time{};
+  // Wall time spent waiting to enter the interpreter before running python listeners.
+  DT gil_wait_time{};
+};
+
+// The statistics of one script, or of all scripts sharing one interpreter.
+// Recorded by the threads emitting events, read by scripts and the performance overlay.
+class ScriptProfile
+{
+public:
+  // The event names must outlive the profile, and are indexed by the recording functions.
+  ScriptProfile(std::string name, std::vector<std::string_view> event_names);
+
+  const std::string& GetName() const { return m_name; }
+
+  void RecordCallbacks(size_t event_index, DT gil_wait_time, std::span<const DT> callback_times);
+  void RecordCoroutineResumes(size_t event_index, u64 count);
+
+  // Returns the stats of all events that had python work, in the order of the event names.
+  std::vector<ScriptEventStats> GetStats() const;
+  void Reset();
+
+private:
+  struct EventStats
+  {
+    u64 callbacks = 0;
+    u64 coroutine_resumes = 0;
+    DT total_time{};
+    DT gil_wait_time{};
+    DurationHistogram callback_times;
+  };
+
+  const std::string m_name;
+  const std::vector<std::string_view> m_event_names;
+  mutable std::mutex m_mutex;
+  std::vector<EventStats> m_stats;
+};
+
+// Keeps track of the profiles of all running scripts.
+class ScriptProfiler
+{
+public:
+  std::shared_ptr<ScriptProfile> AddProfile(std::string name,
+                                            std::vector<std::string_view> event_names);
+  void RemoveProfile(const std::shared_ptr<ScriptProfile>& profile);
+  std::vector<std::shared_ptr<ScriptProfile>> GetProfiles() const;
+  void ResetAll();
+
+private:
+  mutable std::mutex m_mutex;
+  std::vector<std::shared_ptr<ScriptProfile>> m_profiles;
+};
+
+// global script profiler
+ScriptProfiler& GetScriptProfiler();
+
+}  // namespace API
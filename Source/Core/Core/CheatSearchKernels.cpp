@@ -0,0 +1,467 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/CheatSearchKernels.h"
+
+#include <bit>
+#include <cstring>
+#include <type_traits>
+
+#include "Common/Assert.h"
+#include "Common/CPUDetect.h"
+#include "Common/Intrinsics.h"
+#include "Common/Swap.h"
+
+#ifdef _M_ARM_64
+#include <arm_neon.h>
+#endif
+
+namespace Cheats
+{
+template <typename T>
+static T LoadBigEndian(const u8* src)
+{
+  T value;
+  std::memcpy(&value, src, sizeof(T));
+  return Common::FromBigEndian(value);
+}
+
+template <typename T>
+static T AddOperand(T value, T operand)
+{
+  if constexpr (std::is_integral_v<T>)
+  {
+    using U = std::make_unsigned_t<T>;
+    return static_cast<T>(static_cast<U>(static_cast<U>(value) + static_cast<U>(operand)));
+  }
+  else
+  {
+    return value + operand;
+  }
+}
+
+template <CompareType Op, typename T>
+static bool Compare(T value, T reference)
+{
+  if constexpr (Op == CompareType::Equal)
+    return value == reference;
+  else if constexpr (Op == CompareType::NotEqual)
+    return value != reference;
+  else if constexpr (Op == CompareType::Less)
+    return value < reference;
+  else if constexpr (Op == CompareType::LessOrEqual)
+    return value <= reference;
+  else if constexpr (Op == CompareType::Greater)
+    return value > reference;
+  else
+    return value >= reference;
+}
+
+template <typename T, CompareType Op, bool AgainstLast, size_t Stride>
+static u64 ScanScalar(const u8* values, const u8* last_values, T operand, size_t count)
+{
+  u64 mask = 0;
+  for (size_t i = 0; i < count; ++i)
+  {
+    const T value = LoadBigEndian<T>(values + i * Stride);
+    T reference = operand;
+    if constexpr (AgainstLast)
+      reference = AddOperand(LoadBigEndian<T>(last_values + i * Stride), operand);
+    mask |= static_cast<u64>(Compare<Op>(value, reference)) << i;
+  }
+  return mask;
+}
+
+#ifdef _M_X86_64
+template <typename T>
+FUNCTION_TARGET_SSSE3 static __m128i LoadVector(const u8* src)
+{
+  const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+  if constexpr (sizeof(T) == 2)
+  {
+    return _mm_shuffle_epi8(
+        value, _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14));
+  }
+  else if constexpr (sizeof(T) == 4)
+  {
+    return _mm_shuffle_epi8(
+        value, _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+  }
+  else
+  {
+    return value;
+  }
+}
+
+template <typename T>
+FUNCTION_TARGET_SSSE3 static __m128i SplatVector(T value)
+{
+  if constexpr (std::is_same_v<T, float>)
+    return _mm_castps_si128(_mm_set1_ps(value));
+  else if constexpr (sizeof(T) == 1)
+    return _mm_set1_epi8(std::bit_cast<s8>(value));
+  else if constexpr (sizeof(T) == 2)
+    return _mm_set1_epi16(std::bit_cast<s16>(value));
+  else
+    return _mm_set1_epi32(std::bit_cast<s32>(value));
+}
+
+template <typename T>
+FUNCTION_TARGET_SSSE3 static __m128i AddVectors(__m128i a, __m128i b)
+{
+  if constexpr (std::is_same_v<T, float>)
+    return _mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+  else if constexpr (sizeof(T) == 1)
+    return _mm_add_epi8(a, b);
+  else if constexpr (sizeof(T) == 2)
+    return _mm_add_epi16(a, b);
+  else
+    return _mm_add_epi32(a, b);
+}
+
+template <typename T>
+FUNCTION_TARGET_SSSE3 static __m128i EqualVectors(__m128i a, __m128i b)
+{
+  if constexpr (sizeof(T) == 1)
+    return _mm_cmpeq_epi8(a, b);
+  else if constexpr (sizeof(T) == 2)
+    return _mm_cmpeq_epi16(a, b);
+  else
+    return _mm_cmpeq_epi32(a, b);
+}
+
+template <typename T>
+FUNCTION_TARGET_SSSE3 static __m128i GreaterVectors(__m128i a, __m128i b)
+{
+  if constexpr (std::is_unsigned_v<T>)
+  {
+    // SSE only has signed comparisons, so flip the sign bits to get the unsigned order.
+    const __m128i bias = SplatVector<T>(static_cast<T>(T(1) << (sizeof(T) * 8 - 1)));
+    a = _mm_xor_si128(a, bias);
+    b = _mm_xor_si128(b, bias);
+  }
+  if constexpr (sizeof(T) == 1)
+    return _mm_cmpgt_epi8(a, b);
+  else if constexpr (sizeof(T) == 2)
+    return _mm_cmpgt_epi16(a, b);
+  else
+    return _mm_cmpgt_epi32(a, b);
+}
+
+template <typename T, CompareType Op>
+FUNCTION_TARGET_SSSE3 static __m128i CompareVectors(__m128i a, __m128i b)
+{
+  if constexpr (std::is_same_v<T, float>)
+  {
+    const __m128 x = _mm_castsi128_ps(a);
+    const __m128 y = _mm_castsi128_ps(b);
+    if constexpr (Op == CompareType::Equal)
+      return _mm_castps_si128(_mm_cmpeq_ps(x, y));
+    else if constexpr (Op == CompareType::NotEqual)
+      return _mm_castps_si128(_mm_cmpneq_ps(x, y));
+    else if constexpr (Op == CompareType::Less)
+      return _mm_castps_si128(_mm_cmplt_ps(x, y));
+    else if constexpr (Op == CompareType::LessOrEqual)
+      return _mm_castps_si128(_mm_cmple_ps(x, y));
+    else if constexpr (Op == CompareType::Greater)
+      return _mm_castps_si128(_mm_cmpgt_ps(x, y));
+    else
+      return _mm_castps_si128(_mm_cmpge_ps(x, y));
+  }
+  else
+  {
+    const __m128i all_ones = _mm_set1_epi32(-1);
+    if constexpr (Op == CompareType::Equal)
+      return EqualVectors<T>(a, b);
+    else if constexpr (Op == CompareType::NotEqual)
+      return _mm_xor_si128(EqualVectors<T>(a, b), all_ones);
+    else if constexpr (Op == CompareType::Less)
+      return GreaterVectors<T>(b, a);
+    else if constexpr (Op == CompareType::LessOrEqual)
+      return _mm_xor_si128(GreaterVectors<T>(a, b), all_ones);
+    else if constexpr (Op == CompareType::Greater)
+      return GreaterVectors<T>(a, b);
+    else
+      return _mm_xor_si128(GreaterVectors<T>(b, a), all_ones);
+  }
+}
+
+// Returns one bit per lane of a comparison result.
+template <typename T>
+FUNCTION_TARGET_SSSE3 static u32 MoveMask(__m128i mask)
+{
+  if constexpr (sizeof(T) == 1)
+    return static_cast<u32>(_mm_movemask_epi8(mask));
+  else if constexpr (sizeof(T) == 2)
+    return static_cast<u32>(_mm_movemask_epi8(_mm_packs_epi16(mask, _mm_setzero_si128())));
+  else
+    return static_cast<u32>(_mm_movemask_ps(_mm_castsi128_ps(mask)));
+}
+
+template <typename T, CompareType Op, bool AgainstLast>
+FUNCTION_TARGET_SSSE3 static u64 ScanSSSE3(const u8* values, const u8* last_values, T operand,
+                                           size_t count)
+{
+  constexpr size_t lanes = 16 / sizeof(T);
+  const __m128i operand_vector = SplatVector<T>(operand);
+  u64 mask = 0;
+  size_t i = 0;
+  for (; i + lanes <= count; i += lanes)
+  {
+    const __m128i value = LoadVector<T>(values + i * sizeof(T));
+    __m128i reference = operand_vector;
+    if constexpr (AgainstLast)
+      reference = AddVectors<T>(LoadVector<T>(last_values + i * sizeof(T)), operand_vector);
+    mask |= static_cast<u64>(MoveMask<T>(CompareVectors<T, Op>(value, reference))) << i;
+  }
+  if (i < count)
+  {
+    mask |= ScanScalar<T, Op, AgainstLast, sizeof(T)>(
+                values + i * sizeof(T), AgainstLast ? last_values + i * sizeof(T) : nullptr,
+                operand, count - i)
+            << i;
+  }
+  return mask;
+}
+#endif
+
+#ifdef _M_ARM_64
+template <typename T>
+static uint8x16_t LoadVector(const u8* src)
+{
+  const uint8x16_t value = vld1q_u8(src);
+  if constexpr (sizeof(T) == 2)
+    return vrev16q_u8(value);
+  else if constexpr (sizeof(T) == 4)
+    return vrev32q_u8(value);
+  else
+    return value;
+}
+
+template <typename T>
+static uint8x16_t SplatVector(T value)
+{
+  if constexpr (std::is_same_v<T, float>)
+    return vreinterpretq_u8_f32(vdupq_n_f32(value));
+  else if constexpr (sizeof(T) == 1)
+    return vdupq_n_u8(std::bit_cast<u8>(value));
+  else if constexpr (sizeof(T) == 2)
+    return vreinterpretq_u8_u16(vdupq_n_u16(std::bit_cast<u16>(value)));
+  else
+    return vreinterpretq_u8_u32(vdupq_n_u32(std::bit_cast<u32>(value)));
+}
+
+template <typename T>
+static uint8x16_t AddVectors(uint8x16_t a, uint8x16_t b)
+{
+  if constexpr (std::is_same_v<T, float>)
+    return vreinterpretq_u8_f32(vaddq_f32(vreinterpretq_f32_u8(a), vreinterpretq_f32_u8(b)));
+  else if constexpr (sizeof(T) == 1)
+    return vaddq_u8(a, b);
+  else if constexpr (sizeof(T) == 2)
+    return vreinterpretq_u8_u16(vaddq_u16(vreinterpretq_u16_u8(a), vreinterpretq_u16_u8(b)));
+  else
+    return vreinterpretq_u8_u32(vaddq_u32(vreinterpretq_u32_u8(a), vreinterpretq_u32_u8(b)));
+}
+
+template <typename T>
+static uint8x16_t EqualVectors(uint8x16_t a, uint8x16_t b)
+{
+  if constexpr (std::is_same_v<T, float>)
+    return vreinterpretq_u8_u32(vceqq_f32(vreinterpretq_f32_u8(a), vreinterpretq_f32_u8(b)));
+  else if constexpr (sizeof(T) == 1)
+    return vceqq_u8(a, b);
+  else if constexpr (sizeof(T) == 2)
+    return vreinterpretq_u8_u16(vceqq_u16(vreinterpretq_u16_u8(a), vreinterpretq_u16_u8(b)));
+  else
+    return vreinterpretq_u8_u32(vceqq_u32(vreinterpretq_u32_u8(a), vreinterpretq_u32_u8(b)));
+}
+
+template <typename T>
+static uint8x16_t GreaterVectors(uint8x16_t a, uint8x16_t b)
+{
+  if constexpr (std::is_same_v<T, float>)
+    return vreinterpretq_u8_u32(vcgtq_f32(vreinterpretq_f32_u8(a), vreinterpretq_f32_u8(b)));
+  else if constexpr (std::is_same_v<T, s8>)
+    return vcgtq_s8(vreinterpretq_s8_u8(a), vreinterpretq_s8_u8(b));
+  else if constexpr (std::is_same_v<T, s16>)
+    return vreinterpretq_u8_u16(vcgtq_s16(vreinterpretq_s16_u8(a), vreinterpretq_s16_u8(b)));
+  else if constexpr (std::is_same_v<T, s32>)
+    return vreinterpretq_u8_u32(vcgtq_s32(vreinterpretq_s32_u8(a), vreinterpretq_s32_u8(b)));
+  else if constexpr (sizeof(T) == 1)
+    return vcgtq_u8(a, b);
+  else if constexpr (sizeof(T) == 2)
+    return vreinterpretq_u8_u16(vcgtq_u16(vreinterpretq_u16_u8(a), vreinterpretq_u16_u8(b)));
+  else
+    return vreinterpretq_u8_u32(vcgtq_u32(vreinterpretq_u32_u8(a), vreinterpretq_u32_u8(b)));
+}
+
+template <typename T>
+static uint8x16_t GreaterOrEqualVectors(uint8x16_t a, uint8x16_t b)
+{
+  if constexpr (std::is_same_v<T, float>)
+    return vreinterpretq_u8_u32(vcgeq_f32(vreinterpretq_f32_u8(a), vreinterpretq_f32_u8(b)));
+  else if constexpr (std::is_same_v<T, s8>)
+    return vcgeq_s8(vreinterpretq_s8_u8(a), vreinterpretq_s8_u8(b));
+  else if constexpr (std::is_same_v<T, s16>)
+    return vreinterpretq_u8_u16(vcgeq_s16(vreinterpretq_s16_u8(a), vreinterpretq_s16_u8(b)));
+  else if constexpr (std::is_same_v<T, s32>)
+    return vreinterpretq_u8_u32(vcgeq_s32(vreinterpretq_s32_u8(a), vreinterpretq_s32_u8(b)));
+  else if constexpr (sizeof(T) == 1)
+    return vcgeq_u8(a, b);
+  else if constexpr (sizeof(T) == 2)
+    return vreinterpretq_u8_u16(vcgeq_u16(vreinterpretq_u16_u8(a), vreinterpretq_u16_u8(b)));
+  else
+    return vreinterpretq_u8_u32(vcgeq_u32(vreinterpretq_u32_u8(a), vreinterpretq_u32_u8(b)));
+}
+
+template <typename T, CompareType Op>
+static uint8x16_t CompareVectors(uint8x16_t a, uint8x16_t b)
+{
+  if constexpr (Op == CompareType::Equal)
+    return EqualVectors<T>(a, b);
+  else if constexpr (Op == CompareType::NotEqual)
+    return vmvnq_u8(EqualVectors<T>(a, b));
+  else if constexpr (Op == CompareType::Less)
+    return GreaterVectors<T>(b, a);
+  else if constexpr (Op == CompareType::LessOrEqual)
+    return GreaterOrEqualVectors<T>(b, a);
+  else if constexpr (Op == CompareType::Greater)
+    return GreaterVectors<T>(a, b);
+  else
+    return GreaterOrEqualVectors<T>(a, b);
+}
+
+// Returns one bit per lane of a comparison result.
+template <typename T>
+static u32 MoveMask(uint8x16_t mask)
+{
+  if constexpr (sizeof(T) == 1)
+  {
+    static constexpr u8 weights[16] = {1, 2, 4, 8, 16, 32, 64, 128,
+                                       1, 2, 4, 8, 16, 32, 64, 128};
+    const uint8x16_t bits = vandq_u8(mask, vld1q_u8(weights));
+    return vaddv_u8(vget_low_u8(bits)) | (static_cast<u32>(vaddv_u8(vget_high_u8(bits))) << 8);
+  }
+  else if constexpr (sizeof(T) == 2)
+  {
+    static constexpr u16 weights[8] = {1, 2, 4, 8, 16, 32, 64, 128};
+    return vaddvq_u16(vandq_u16(vreinterpretq_u16_u8(mask), vld1q_u16(weights)));
+  }
+  else
+  {
+    static constexpr u32 weights[4] = {1, 2, 4, 8};
+    return vaddvq_u32(vandq_u32(vreinterpretq_u32_u8(mask), vld1q_u32(weights)));
+  }
+}
+
+template <typename T, CompareType Op, bool AgainstLast>
+static u64 ScanNEON(const u8* values, const u8* last_values, T operand, size_t count)
+{
+  constexpr size_t lanes = 16 / sizeof(T);
+  const uint8x16_t operand_vector = SplatVector<T>(operand);
+  u64 mask = 0;
+  size_t i = 0;
+  for (; i + lanes <= count; i += lanes)
+  {
+    const uint8x16_t value = LoadVector<T>(values + i * sizeof(T));
+    uint8x16_t reference = operand_vector;
+    if constexpr (AgainstLast)
+      reference = AddVectors<T>(LoadVector<T>(last_values + i * sizeof(T)), operand_vector);
+    mask |= static_cast<u64>(MoveMask<T>(CompareVectors<T, Op>(value, reference))) << i;
+  }
+  if (i < count)
+  {
+    mask |= ScanScalar<T, Op, AgainstLast, sizeof(T)>(
+                values + i * sizeof(T), AgainstLast ? last_values + i * sizeof(T) : nullptr,
+                operand, count - i)
+            << i;
+  }
+  return mask;
+}
+#endif
+
+template <typename T, CompareType Op, bool AgainstLast>
+static ScanKernel<T> SelectKernel(bool aligned, bool allow_simd)
+{
+  if (!aligned)
+    return ScanScalar<T, Op, AgainstLast, 1>;
+  // 64 bit values are left to scalar code, since SSSE3 can't compare them.
+  if constexpr (sizeof(T) <= 4)
+  {
+    if (allow_simd)
+    {
+#if defined(_M_X86_64)
+      if (cpu_info.bSSSE3)
+        return ScanSSSE3<T, Op, AgainstLast>;
+#elif defined(_M_ARM_64)
+      return ScanNEON<T, Op, AgainstLast>;
+#endif
+    }
+  }
+  return ScanScalar<T, Op, AgainstLast, sizeof(T)>;
+}
+
+template <typename T, bool AgainstLast>
+static ScanKernel<T> SelectKernelForCompareType(CompareType compare_type, bool aligned,
+                                                bool allow_simd)
+{
+  switch (compare_type)
+  {
+  case CompareType::Equal:
+    return SelectKernel<T, CompareType::Equal, AgainstLast>(aligned, allow_simd);
+  case CompareType::NotEqual:
+    return SelectKernel<T, CompareType::NotEqual, AgainstLast>(aligned, allow_simd);
+  case CompareType::Less:
+    return SelectKernel<T, CompareType::Less, AgainstLast>(aligned, allow_simd);
+  case CompareType::LessOrEqual:
+    return SelectKernel<T, CompareType::LessOrEqual, AgainstLast>(aligned, allow_simd);
+  case CompareType::Greater:
+    return SelectKernel<T, CompareType::Greater, AgainstLast>(aligned, allow_simd);
+  case CompareType::GreaterOrEqual:
+    return SelectKernel<T, CompareType::GreaterOrEqual, AgainstLast>(aligned, allow_simd);
+  default:
+    DEBUG_ASSERT(false);
+    return nullptr;
+  }
+}
+
+template <typename T>
+ScanKernel<T> GetScanKernel(CompareType compare_type, bool against_last_value, bool aligned)
+{
+  if (against_last_value)
+    return SelectKernelForCompareType<T, true>(compare_type, aligned, true);
+  return SelectKernelForCompareType<T, false>(compare_type, aligned, true);
+}
+
+template <typename T>
+ScanKernel<T> GetScalarScanKernel(CompareType compare_type, bool against_last_value,
+                                  bool aligned)
+{
+  if (against_last_value)
+    return SelectKernelForCompareType<T, true>(compare_type, aligned, false);
+  return SelectKernelForCompareType<T, false>(compare_type, aligned, false);
+}
+
+template ScanKernel<u8> GetScanKernel<u8>(CompareType, bool, bool);
+template ScanKernel<u16> GetScanKernel<u16>(CompareType, bool, bool);
+template ScanKernel<u32> GetScanKernel<u32>(CompareType, bool, bool);
+template ScanKernel<u64> GetScanKernel<u64>(CompareType, bool, bool);
+template ScanKernel<s8> GetScanKernel<s8>(CompareType, bool, bool);
+template ScanKernel<s16> GetScanKernel<s16>(CompareType, bool, bool);
+template ScanKernel<s32> GetScanKernel<s32>(CompareType, bool, bool);
+template ScanKernel<s64> GetScanKernel<s64>(CompareType, bool, bool);
+template ScanKernel<float> GetScanKernel<float>(CompareType, bool, bool);
+template ScanKernel<double> GetScanKernel<double>(CompareType, bool, bool);
+
+template ScanKernel<u8> GetScalarScanKernel<u8>(CompareType, bool, bool);
+template ScanKernel<u16> GetScalarScanKernel<u16>(CompareType, bool, bool);
+template ScanKernel<u32> GetScalarScanKernel<u32>(CompareType, bool, bool);
+template ScanKernel<u64> GetScalarScanKernel<u64>(CompareType, bool, bool);
+template ScanKernel<s8> GetScalarScanKernel<s8>(CompareType, bool, bool);
+template ScanKernel<s16> GetScalarScanKernel<s16>(CompareType, bool, bool);
+template ScanKernel<s32> GetScalarScanKernel<s32>(CompareType, bool, bool);
+template ScanKernel<s64> GetScalarScanKernel<s64>(CompareType, bool, bool);
+template ScanKernel<float> GetScalarScanKernel<float>(CompareType, bool, bool);
+template ScanKernel<double> GetScalarScanKernel<double>(CompareType, bool, bool);
+}  // namespace Cheats
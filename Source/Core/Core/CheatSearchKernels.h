@@ -0,0 +1,37 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Comparison kernels for searching large amounts of memory. Each kernel compares a block of
+// consecutive big endian values straight from emulated memory and returns a bitmask of the
+// matching ones, using SIMD where available.
+
+#pragma once
+
+#include <cstddef>
+
+#include "Common/CommonTypes.h"
+#include "Core/CheatSearch.h"
+
+namespace Cheats
+{
+// The number of values a kernel compares at most, i.e. the number of bits in its result.
+constexpr size_t SCAN_BLOCK_SIZE = 64;
+
+// Compares `count` (at most SCAN_BLOCK_SIZE) values of type T, stored in big endian at
+// `values`, and returns a mask with bit i set if value i matches.
+// Kernels comparing against the last values compare value i against last value i plus
+// `operand`, where `last_values` has the same layout as `values`. Otherwise they compare
+// against `operand` and ignore `last_values`. Additions wrap around for integers.
+template <typename T>
+using ScanKernel = u64 (*)(const u8* values, const u8* last_values, T operand, size_t count);
+
+// Aligned kernels read values that are sizeof(T) bytes apart, unaligned ones values that are
+// one byte apart. Neither requires the pointers themselves to be aligned.
+template <typename T>
+ScanKernel<T> GetScanKernel(CompareType compare_type, bool against_last_value, bool aligned);
+
+// Same as GetScanKernel, but never uses SIMD.
+template <typename T>
+ScanKernel<T> GetScalarScanKernel(CompareType compare_type, bool against_last_value,
+                                  bool aligned);
+}  // namespace Cheats
@@ -0,0 +1,329 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/CompactCheatSearch.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <optional>
+#include <utility>
+
+#include "Common/Align.h"
+#include "Common/Assert.h"
+#include "Common/Swap.h"
+
+#include "Core/AchievementManager.h"
+#include "Core/CheatSearchKernels.h"
+#include "Core/Core.h"
+#include "Core/HW/Memmap.h"
+#include "Core/System.h"
+
+namespace Cheats
+{
+static u32 GetDataTypeSize(DataType data_type)
+{
+  switch (data_type)
+  {
+  case DataType::U8:
+  case DataType::S8:
+    return 1;
+  case DataType::U16:
+  case DataType::S16:
+    return 2;
+  case DataType::U32:
+  case DataType::S32:
+  case DataType::F32:
+    return 4;
+  case DataType::U64:
+  case DataType::S64:
+  case DataType::F64:
+    return 8;
+  default:
+    DEBUG_ASSERT(false);
+    return 1;
+  }
+}
+
+// Returns the host memory backing the given range of MEM1 or MEM2, or nullptr if the range
+// isn't entirely in one of them.
+static const u8* GetRAMPointer(Memory::MemoryManager& memory, u32 address, u64 size)
+{
+  // Same mapping as MemoryManager::GetSpanForAddress, but without panicking.
+  const u32 physical_address = address & 0x3FFFFFFF;
+  const u32 ram_size = memory.GetRamSizeReal();
+  if (physical_address < ram_size)
+    return size <= ram_size - physical_address ? memory.GetRAM() + physical_address : nullptr;
+
+  const u32 exram_offset = physical_address & 0x0FFFFFFF;
+  const u32 exram_size = memory.GetExRamSizeReal();
+  if (memory.GetEXRAM() != nullptr && (physical_address >> 28) == 0x1 &&
+      exram_offset < exram_size && size <= exram_size - exram_offset)
+  {
+    return memory.GetEXRAM() + exram_offset;
+  }
+  return nullptr;
+}
+
+template <typename T>
+static T LoadBigEndian(const u8* src)
+{
+  T value;
+  std::memcpy(&value, src, sizeof(T));
+  return Common::FromBigEndian(value);
+}
+
+CompactSearchSession::CompactSearchSession(std::vector<MemoryRange> memory_ranges,
+                                           DataType data_type, bool aligned)
+    : m_data_type(data_type), m_aligned(aligned)
+{
+  const u32 size = GetDataTypeSize(data_type);
+  for (const MemoryRange& memory_range : memory_ranges)
+  {
+    Range& range = m_ranges.emplace_back();
+    range.stride = aligned ? size : 1;
+    range.first_address =
+        aligned ? Common::AlignUp(memory_range.m_start, size) : memory_range.m_start;
+    const u64 skipped = range.first_address - memory_range.m_start;
+    if (memory_range.m_length >= skipped + size)
+      range.value_count = (memory_range.m_length - skipped - size) / range.stride + 1;
+  }
+}
+
+std::vector<MemoryRange> CompactSearchSession::GetRAMRanges(const Core::CPUThreadGuard& guard)
+{
+  auto& memory = guard.GetSystem().GetMemory();
+  std::vector<MemoryRange> ranges;
+  ranges.emplace_back(0x80000000, memory.GetRamSizeReal());
+  if (memory.GetEXRAM() != nullptr)
+    ranges.emplace_back(0x90000000, memory.GetExRamSizeReal());
+  return ranges;
+}
+
+void CompactSearchSession::SetCompareType(CompareType compare_type)
+{
+  m_compare_type = compare_type;
+}
+
+void CompactSearchSession::SetFilterType(FilterType filter_type)
+{
+  m_filter_type = filter_type;
+}
+
+bool CompactSearchSession::SetValue(const SearchValue& value)
+{
+  if (Cheats::GetDataType(value) != m_data_type)
+    return false;
+  m_value = value;
+  return true;
+}
+
+void CompactSearchSession::ResetResults()
+{
+  for (Range& range : m_ranges)
+  {
+    range.bitmap = {};
+    range.last_values = {};
+  }
+  m_result_count = 0;
+  m_first_search_done = false;
+}
+
+SearchErrorCode CompactSearchSession::RunSearch(const Core::CPUThreadGuard& guard)
+{
+  if (AchievementManager::GetInstance().IsHardcoreModeActive())
+    return SearchErrorCode::DisabledInHardcoreMode;
+  auto& system = guard.GetSystem();
+  const Core::State core_state = Core::GetState(system);
+  if (core_state != Core::State::Running && core_state != Core::State::Paused)
+    return SearchErrorCode::NoEmulationActive;
+
+  // Resolve all ranges up front, so a bad range doesn't leave the results half updated.
+  auto& memory = system.GetMemory();
+  const u32 value_size = GetDataTypeSize(m_data_type);
+  std::vector<const u8*> range_memory;
+  range_memory.reserve(m_ranges.size());
+  for (const Range& range : m_ranges)
+  {
+    const u64 size =
+        range.value_count == 0 ? 0 : (range.value_count - 1) * range.stride + value_size;
+    const u8* pointer = GetRAMPointer(memory, range.first_address, size);
+    if (pointer == nullptr && size != 0)
+      return SearchErrorCode::InvalidParameters;
+    range_memory.push_back(pointer);
+  }
+  return RunSearch(range_memory);
+}
+
+SearchErrorCode CompactSearchSession::RunSearch(std::span<const u8* const> range_memory)
+{
+  if (range_memory.size() != m_ranges.size())
+    return SearchErrorCode::InvalidParameters;
+
+  switch (m_data_type)
+  {
+  case DataType::U8:
+    return RunSearchTyped<u8>(range_memory);
+  case DataType::U16:
+    return RunSearchTyped<u16>(range_memory);
+  case DataType::U32:
+    return RunSearchTyped<u32>(range_memory);
+  case DataType::U64:
+    return RunSearchTyped<u64>(range_memory);
+  case DataType::S8:
+    return RunSearchTyped<s8>(range_memory);
+  case DataType::S16:
+    return RunSearchTyped<s16>(range_memory);
+  case DataType::S32:
+    return RunSearchTyped<s32>(range_memory);
+  case DataType::S64:
+    return RunSearchTyped<s64>(range_memory);
+  case DataType::F32:
+    return RunSearchTyped<float>(range_memory);
+  case DataType::F64:
+    return RunSearchTyped<double>(range_memory);
+  default:
+    DEBUG_ASSERT(false);
+    return SearchErrorCode::InvalidParameters;
+  }
+}
+
+template <typename T>
+SearchErrorCode CompactSearchSession::RunSearchTyped(std::span<const u8* const> range_memory)
+{
+  if (m_filter_type == FilterType::CompareAgainstSpecificValue && !m_value)
+    return SearchErrorCode::InvalidParameters;
+  if (m_filter_type == FilterType::CompareAgainstLastValue && !m_first_search_done)
+    return SearchErrorCode::InvalidParameters;
+
+  const T operand = m_value ? std::get<T>(m_value->m_value) : T(0);
+  const ScanKernel<T> kernel =
+      m_filter_type == FilterType::DoNotFilter ?
+          nullptr :
+          GetScanKernel<T>(m_compare_type,
+                           m_filter_type == FilterType::CompareAgainstLastValue, m_aligned);
+
+  size_t result_count = 0;
+  for (size_t range_index = 0; range_index < m_ranges.size(); ++range_index)
+  {
+    Range& range = m_ranges[range_index];
+    const u8* values = range_memory[range_index];
+    const size_t block_count = Common::AlignUp(range.value_count, SCAN_BLOCK_SIZE) /
+                               SCAN_BLOCK_SIZE;
+    if (!m_first_search_done)
+    {
+      range.bitmap.assign(block_count, 0);
+      range.last_values.resize(
+          range.value_count == 0 ? 0 : (range.value_count - 1) * range.stride + sizeof(T));
+    }
+
+    // Unaligned values of a block overlap the first values of the next block, so a block's last
+    // values are only updated once the next block has been compared against them.
+    const auto update_last_values = [&](size_t block) {
+      const size_t first_value = block * SCAN_BLOCK_SIZE;
+      const size_t count = std::min(SCAN_BLOCK_SIZE, range.value_count - first_value);
+      const size_t offset = first_value * range.stride;
+      std::memcpy(range.last_values.data() + offset, values + offset,
+                  (count - 1) * range.stride + sizeof(T));
+    };
+    std::optional<size_t> pending_block;
+
+    for (size_t block = 0; block < block_count; ++block)
+    {
+      const size_t first_value = block * SCAN_BLOCK_SIZE;
+      const size_t count = std::min(SCAN_BLOCK_SIZE, range.value_count - first_value);
+      u64 results = range.bitmap[block];
+      if (!m_first_search_done)
+        results = count == SCAN_BLOCK_SIZE ? ~u64(0) : (u64(1) << count) - 1;
+      if (results == 0)
+        continue;
+
+      const size_t offset = first_value * range.stride;
+      if (kernel != nullptr)
+        results &= kernel(values + offset, range.last_values.data() + offset, operand, count);
+      range.bitmap[block] = results;
+
+      if (pending_block.has_value())
+        update_last_values(*pending_block);
+      pending_block.reset();
+      if (results == 0)
+        continue;
+
+      pending_block = block;
+      result_count += std::popcount(results);
+    }
+    if (pending_block.has_value())
+      update_last_values(*pending_block);
+  }
+
+  m_result_count = result_count;
+  m_first_search_done = true;
+  return SearchErrorCode::Success;
+}
+
+void CompactSearchSession::GetResults(size_t skip, size_t max_count, std::vector<u32>* addresses,
+                                      std::vector<SearchValue>* values) const
+{
+  switch (m_data_type)
+  {
+  case DataType::U8:
+    return AppendResults<u8>(skip, max_count, addresses, values);
+  case DataType::U16:
+    return AppendResults<u16>(skip, max_count, addresses, values);
+  case DataType::U32:
+    return AppendResults<u32>(skip, max_count, addresses, values);
+  case DataType::U64:
+    return AppendResults<u64>(skip, max_count, addresses, values);
+  case DataType::S8:
+    return AppendResults<s8>(skip, max_count, addresses, values);
+  case DataType::S16:
+    return AppendResults<s16>(skip, max_count, addresses, values);
+  case DataType::S32:
+    return AppendResults<s32>(skip, max_count, addresses, values);
+  case DataType::S64:
+    return AppendResults<s64>(skip, max_count, addresses, values);
+  case DataType::F32:
+    return AppendResults<float>(skip, max_count, addresses, values);
+  case DataType::F64:
+    return AppendResults<double>(skip, max_count, addresses, values);
+  default:
+    DEBUG_ASSERT(false);
+    return;
+  }
+}
+
+template <typename T>
+void CompactSearchSession::AppendResults(size_t skip, size_t max_count,
+                                         std::vector<u32>* addresses,
+                                         std::vector<SearchValue>* values) const
+{
+  for (const Range& range : m_ranges)
+  {
+    for (size_t block = 0; block < range.bitmap.size(); ++block)
+    {
+      u64 results = range.bitmap[block];
+      const size_t block_result_count = std::popcount(results);
+      if (skip >= block_result_count)
+      {
+        skip -= block_result_count;
+        continue;
+      }
+      for (; results != 0; results &= results - 1)
+      {
+        if (skip != 0)
+        {
+          --skip;
+          continue;
+        }
+        if (max_count == 0)
+          return;
+        const size_t index = block * SCAN_BLOCK_SIZE + std::countr_zero(results);
+        addresses->push_back(range.first_address + static_cast<u32>(index * range.stride));
+        values->push_back(
+            SearchValue{LoadBigEndian<T>(range.last_values.data() + index * range.stride)});
+        --max_count;
+      }
+    }
+  }
+}
+}  // namespace Cheats
@@ -0,0 +1,90 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// A cheat search for scanning all of emulated RAM many times, e.g. from scripts.
+// Instead of a list of results, every memory range keeps a bitmap with one bit per candidate
+// address and a copy of its memory as of the last search. Searches compare emulated memory
+// directly against either of them with the kernels from CheatSearchKernels.h, and only look at
+// blocks of addresses that still have results.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Core/CheatSearch.h"
+
+namespace Core
+{
+class CPUThreadGuard;
+}
+
+namespace Cheats
+{
+class CompactSearchSession
+{
+public:
+  // Ranges are given in effective addresses and must lie in MEM1 or MEM2, which are
+  // accessed as mapped by the default BATs, i.e. 0x80000000 and 0x90000000 with or without
+  // the uncached bit. Searching ranges outside of RAM fails with InvalidParameters.
+  CompactSearchSession(std::vector<MemoryRange> memory_ranges, DataType data_type, bool aligned);
+
+  // The ranges of MEM1 and, in Wii mode, MEM2.
+  static std::vector<MemoryRange> GetRAMRanges(const Core::CPUThreadGuard& guard);
+
+  void SetCompareType(CompareType compare_type);
+  void SetFilterType(FilterType filter_type);
+  // For CompareAgainstSpecificValue, the value to compare against. For CompareAgainstLastValue,
+  // the difference to the last value, e.g. Equal with a difference of 1 keeps the values that
+  // increased by exactly 1. Returns false if the value isn't of the session's data type.
+  bool SetValue(const SearchValue& value);
+
+  void ResetResults();
+  SearchErrorCode RunSearch(const Core::CPUThreadGuard& guard);
+  // Searches host memory instead of emulated RAM, with one pointer to the memory of each range
+  // given to the constructor. Used by RunSearch after resolving the ranges, and by tests.
+  SearchErrorCode RunSearch(std::span<const u8* const> range_memory);
+
+  DataType GetDataType() const { return m_data_type; }
+  bool GetAligned() const { return m_aligned; }
+  bool WasFirstSearchDone() const { return m_first_search_done; }
+  size_t GetResultCount() const { return m_result_count; }
+
+  // Appends the addresses and the values as of the last search of up to `max_count` results,
+  // skipping the first `skip` results, in ascending address order.
+  void GetResults(size_t skip, size_t max_count, std::vector<u32>* addresses,
+                  std::vector<SearchValue>* values) const;
+
+private:
+  struct Range
+  {
+    // The address of the first value and the distance between values.
+    u32 first_address = 0;
+    u32 stride = 0;
+    size_t value_count = 0;
+    // One bit per value, set for values that are results.
+    std::vector<u64> bitmap;
+    // The range's memory as of the last search, in big endian. Only blocks of values with
+    // results are kept up to date.
+    std::vector<u8> last_values;
+  };
+
+  template <typename T>
+  SearchErrorCode RunSearchTyped(std::span<const u8* const> range_memory);
+  template <typename T>
+  void AppendResults(size_t skip, size_t max_count, std::vector<u32>* addresses,
+                     std::vector<SearchValue>* values) const;
+
+  std::vector<Range> m_ranges;
+  DataType m_data_type;
+  CompareType m_compare_type = CompareType::Equal;
+  FilterType m_filter_type = FilterType::DoNotFilter;
+  std::optional<SearchValue> m_value;
+  size_t m_result_count = 0;
+  bool m_aligned;
+  bool m_first_search_done = false;
+};
+}  // namespace Cheats
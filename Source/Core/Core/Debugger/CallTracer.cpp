@@ -0,0 +1,170 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/Debugger/CallTracer.h"
+
+#include <algorithm>
+#include <bit>
+#include <iterator>
+
+#include <fmt/format.h>
+
+#include "Common/IOFile.h"
+#include "Common/SymbolDB.h"
+#include "Core/Core.h"
+#include "Core/CoreTiming.h"
+#include "Core/HW/SystemTimers.h"
+#include "Core/PowerPC/PPCSymbolDB.h"
+#include "Core/System.h"
+
+namespace Core
+{
+CallTracer::CallTracer(CoreTiming::CoreTimingManager& core_timing) : m_core_timing(core_timing)
+{
+}
+
+void CallTracer::Start(const CPUThreadGuard& guard, std::size_t capacity)
+{
+  m_events.assign(std::bit_ceil(std::clamp<std::size_t>(capacity, 1, MAX_CAPACITY)), {});
+  m_write_index = 0;
+  m_active = true;
+}
+
+void CallTracer::Clear(const CPUThreadGuard& guard)
+{
+  m_write_index = 0;
+}
+
+u64 CallTracer::GetDroppedCount(const CPUThreadGuard& guard) const
+{
+  return m_write_index - std::min<u64>(m_write_index, m_events.size());
+}
+
+std::vector<CallTraceEvent> CallTracer::GetEvents(const CPUThreadGuard& guard) const
+{
+  const u64 count = std::min<u64>(m_write_index, m_events.size());
+  std::vector<CallTraceEvent> events;
+  events.reserve(count);
+  for (u64 i = m_write_index - count; i < m_write_index; ++i)
+    events.push_back(m_events[i & (m_events.size() - 1)]);
+  return events;
+}
+
+void CallTracer::Record(CallTraceEventType type, u32 origin, u32 destination)
+{
+  m_events[m_write_index & (m_events.size() - 1)] = {m_core_timing.GetTicks(), origin,
+                                                     destination, type};
+  ++m_write_index;
+}
+
+CallTraceSnapshot CallTracer::TakeSnapshot(const CPUThreadGuard& guard,
+                                           PPCSymbolDB& symbol_db) const
+{
+  CallTraceSnapshot snapshot;
+  snapshot.events = GetEvents(guard);
+  snapshot.ticks_per_second = guard.GetSystem().GetSystemTimers().GetTicksPerSecond();
+  for (const CallTraceEvent& event : snapshot.events)
+  {
+    if (event.type != CallTraceEventType::Call ||
+        snapshot.function_names.contains(event.destination))
+    {
+      continue;
+    }
+    if (const Common::Symbol* symbol = symbol_db.GetSymbolFromAddr(event.destination))
+      snapshot.function_names.emplace(event.destination, symbol->name);
+  }
+  return snapshot;
+}
+
+bool CallTracer::ExportChromeTrace(const CallTraceSnapshot& snapshot, const std::string& path)
+{
+  const std::string trace =
+      FormatChromeTrace(snapshot.events, snapshot.ticks_per_second, snapshot.function_names);
+  File::IOFile file(path, "wb");
+  return file.WriteString(trace);
+}
+
+static void AppendJsonString(std::string* out, std::string_view str)
+{
+  out->push_back('"');
+  for (const char c : str)
+  {
+    if (c == '"' || c == '\\')
+    {
+      out->push_back('\\');
+      out->push_back(c);
+    }
+    else if (static_cast<unsigned char>(c) < 0x20)
+    {
+      fmt::format_to(std::back_inserter(*out), "\\u{:04x}", static_cast<int>(c));
+    }
+    else
+    {
+      out->push_back(c);
+    }
+  }
+  out->push_back('"');
+}
+
+std::string
+CallTracer::FormatChromeTrace(std::span<const CallTraceEvent> events, u32 ticks_per_second,
+                              const std::unordered_map<u32, std::string>& function_names)
+{
+  struct Frame
+  {
+    u32 function;
+    u32 return_address;
+  };
+
+  std::string out = "{\"traceEvents\":[";
+  bool first = true;
+  const auto append_event = [&](char phase, u64 ticks, u32 function) {
+    if (!first)
+      out.push_back(',');
+    first = false;
+
+    const auto name = function_names.find(function);
+    out += "\n{\"name\":";
+    AppendJsonString(&out, name != function_names.end() ? name->second :
+                                                          fmt::format("{:08x}", function));
+    fmt::format_to(std::back_inserter(out),
+                   ",\"ph\":\"{}\",\"ts\":{:.3f},\"pid\":1,\"tid\":1,"
+                   "\"args\":{{\"address\":\"{:08x}\"}}}}",
+                   phase, ticks * 1e6 / ticks_per_second, function);
+  };
+
+  std::vector<Frame> stack;
+  for (const CallTraceEvent& event : events)
+  {
+    if (event.type == CallTraceEventType::Call)
+    {
+      append_event('B', event.ticks, event.destination);
+      stack.push_back({event.destination, event.origin + 4});
+      continue;
+    }
+
+    // Functions that were left without a return (e.g. by longjmp or a tail call) end together with
+    // the first caller that does return.
+    const auto iter =
+        std::ranges::find(stack.rbegin(), stack.rend(), event.destination, &Frame::return_address);
+    if (iter == stack.rend())
+      continue;
+    const std::size_t depth = stack.rend() - iter - 1;
+    while (stack.size() > depth)
+    {
+      append_event('E', event.ticks, stack.back().function);
+      stack.pop_back();
+    }
+  }
+
+  const u64 end_ticks = events.empty() ? 0 : events.back().ticks;
+  while (!stack.empty())
+  {
+    append_event('E', end_ticks, stack.back().function);
+    stack.pop_back();
+  }
+
+  out += "\n]}\n";
+  return out;
+}
+}  // namespace Core
@@ -0,0 +1,159 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Core/PowerPC/Gekko.h"
+
+class PPCSymbolDB;
+
+namespace CoreTiming
+{
+class CoreTimingManager;
+}
+
+namespace Core
+{
+class CPUThreadGuard;
+
+enum class CallTraceEventType : u8
+{
+  Call,
+  Return,
+};
+
+struct CallTraceEvent
+{
+  u64 ticks;
+  u32 origin;
+  u32 destination;
+  CallTraceEventType type;
+};
+
+// Everything needed to export a trace, copied so that it can be formatted and written without
+// holding up the emulation.
+struct CallTraceSnapshot
+{
+  std::vector<CallTraceEvent> events;
+  u32 ticks_per_second = 0;
+  // Symbol names of the called functions that have one.
+  std::unordered_map<u32, std::string> function_names;
+};
+
+// Records guest function calls (branches that set LR) and returns (blr) with their CoreTiming
+// timestamp. The JITs only emit the recording code when debugging is enabled, like for
+// BranchWatch. Timestamps are only as precise as CoreTiming's view of the current time, which the
+// JITs don't update within a block.
+//
+// Events are written to a fixed-size ring buffer by the CPU thread only, so recording needs
+// neither locks nor atomics. Once the buffer is full, the oldest events are overwritten. Everything
+// else must hold a CPUThreadGuard.
+class CallTracer final  // Class is final to enforce the safety of GetOffsetOfActive().
+{
+public:
+  static constexpr std::size_t DEFAULT_CAPACITY = std::size_t{1} << 20;
+  // 6 GiB worth of events.
+  static constexpr std::size_t MAX_CAPACITY = std::size_t{1} << 28;
+
+  explicit CallTracer(CoreTiming::CoreTimingManager& core_timing);
+
+  // Clears previously recorded events. The capacity is clamped to MAX_CAPACITY and rounded up to a
+  // power of two. Throws std::bad_alloc if the buffer can't be allocated.
+  void Start(const CPUThreadGuard& guard, std::size_t capacity = DEFAULT_CAPACITY);
+  void Stop(const CPUThreadGuard& guard) { m_active = false; }
+  void Clear(const CPUThreadGuard& guard);
+
+  bool IsActive() const { return m_active; }
+  // Number of events lost because the ring buffer was full.
+  u64 GetDroppedCount(const CPUThreadGuard& guard) const;
+  // Oldest event first.
+  std::vector<CallTraceEvent> GetEvents(const CPUThreadGuard& guard) const;
+
+  CallTraceSnapshot TakeSnapshot(const CPUThreadGuard& guard, PPCSymbolDB& symbol_db) const;
+
+  // Writes the events in the Chrome trace event format, which can be opened with
+  // chrome://tracing, Perfetto or speedscope. Returns false if the file couldn't be written.
+  static bool ExportChromeTrace(const CallTraceSnapshot& snapshot, const std::string& path);
+  // Pairs calls with returns by their return address. Returns of calls that happened before the
+  // first event are dropped, and calls that haven't returned yet end with the last event.
+  // Functions without a name are named after their address.
+  static std::string
+  FormatChromeTrace(std::span<const CallTraceEvent> events, u32 ticks_per_second,
+                    const std::unordered_map<u32, std::string>& function_names);
+
+  static constexpr bool IsCall(UGeckoInstruction inst)
+  {
+    switch (inst.OPCD)
+    {
+    case 16:  // bcx
+    case 18:  // bx
+      return inst.LK;
+    case 19:  // bcctrx, bclrx
+      return (inst.SUBOP10 == 16 || inst.SUBOP10 == 528) && inst.LK_3;
+    default:
+      return false;
+    }
+  }
+
+  static constexpr bool IsReturn(UGeckoInstruction inst)
+  {
+    return inst.OPCD == 19 && inst.SUBOP10 == 16 && !inst.LK_3;
+  }
+
+  // All Hit functions are for the CPU thread only. The static ones are static to remain compatible
+  // with the JITs' ABI_CallFunction function, which doesn't support non-static member functions.
+  static void HitCall(CallTracer* call_tracer, u32 origin, u32 destination)
+  {
+    call_tracer->Record(CallTraceEventType::Call, origin, destination);
+  }
+
+  static void HitReturn(CallTracer* call_tracer, u32 origin, u32 destination)
+  {
+    // With the BLR optimization, Jit64 passes LR without clearing its low bits.
+    call_tracer->Record(CallTraceEventType::Return, origin, destination & ~3u);
+  }
+
+  // For taken branches of any kind. Branches that are neither calls nor returns are ignored.
+  void HitTrue(u32 origin, u32 destination, UGeckoInstruction inst)
+  {
+    if (IsCall(inst))
+      HitCall(this, origin, destination);
+    else if (IsReturn(inst))
+      HitReturn(this, origin, destination);
+  }
+
+  // The JIT needs this value, but doesn't need to be a full-on friend.
+  static constexpr int GetOffsetOfActive()
+  {
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+    return offsetof(CallTracer, m_active);
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
+  }
+
+private:
+  void Record(CallTraceEventType type, u32 origin, u32 destination);
+
+  bool m_active = false;
+  // Total number of events recorded since the last Start or Clear. The event at index i is stored
+  // at m_events[i & (m_events.size() - 1)].
+  u64 m_write_index = 0;
+  std::vector<CallTraceEvent> m_events;
+  CoreTiming::CoreTimingManager& m_core_timing;
+};
+
+#if _M_X86_64
+static_assert(CallTracer::GetOffsetOfActive() < 0x80);  // Makes JIT code smaller.
+#endif
+}  // namespace Core
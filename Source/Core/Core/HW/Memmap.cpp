@@ -15,11 +15,14 @@
 #include <span>
 #include <tuple>
 
+#include "Common/Align.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemArena.h"
+#include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
+#include "Common/Random.h"
 #include "Common/Swap.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
@@ -233,6 +236,65 @@ bool MemoryManager::InitFastmemArena()
   return true;
 }
 
+// Makes the host pages in [base, base + size) that overlap a memcheck fault on the accesses the
+// memcheck is interested in: reads and writes for read memchecks, only writes for write-only
+// ones. `logical_address` is the effective address `base` is mapped at.
+void MemoryManager::ProtectMemcheckedPages(u8* base, u32 logical_address, u32 size)
+{
+  enum class Protection : u8
+  {
+    None,
+    ReadOnly,
+    NoAccess,
+  };
+
+  const size_t page_size = Common::GetPageSize();
+  const u32 page_count = static_cast<u32>(Common::AlignUp(size, page_size) / page_size);
+  std::vector<Protection> protections(page_count, Protection::None);
+
+  const u64 logical_end = u64(logical_address) + size;
+  for (const TMemCheck& mc : m_system.GetPowerPC().GetMemChecks().GetMemChecks())
+  {
+    if (!mc.is_break_on_read && !mc.is_break_on_write)
+      continue;
+    const u64 start = std::max<u64>(mc.start_address, logical_address);
+    const u64 end = std::min<u64>(u64(mc.end_address) + 1, logical_end);
+    if (start >= end)
+      continue;
+
+    const Protection protection = mc.is_break_on_read ? Protection::NoAccess : Protection::ReadOnly;
+    const u32 first_page = static_cast<u32>((start - logical_address) / page_size);
+    const u32 last_page = static_cast<u32>((end - 1 - logical_address) / page_size);
+    for (u32 page = first_page; page <= last_page; ++page)
+      protections[page] = std::max(protections[page], protection);
+  }
+
+  // Protect runs of pages with the same protection together to keep the number of host
+  // mappings down.
+  u32 page = 0;
+  while (page < page_count)
+  {
+    const Protection protection = protections[page];
+    u32 run_end = page + 1;
+    while (run_end < page_count && protections[run_end] == protection)
+      ++run_end;
+
+    if (protection != Protection::None)
+    {
+      const size_t offset = page * page_size;
+      const size_t run_size = std::min<size_t>(run_end * page_size, size) - offset;
+      if (!m_arena.ProtectInMemoryRegion(base + offset, run_size,
+                                         protection == Protection::ReadOnly))
+      {
+        PanicAlertFmt("Memory::UpdateLogicalMemory(): Failed to protect memchecked memory at "
+                      "0x{:08X} (size 0x{:08X}).",
+                      logical_address + offset, run_size);
+      }
+    }
+    page = run_end;
+  }
+}
+
 void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
 {
   for (auto& entry : m_logical_mapped_entries)
@@ -243,9 +305,15 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
 
   m_logical_page_mappings.fill(nullptr);
 
+  // Pages overlapping memchecks can't be accessed directly, but when the JIT's fastmem accesses
+  // can be backpatched, it's enough to protect the parts of them that are actually memchecked.
+  const bool protect_memchecks =
+      m_is_fastmem_arena_initialized && Config::Get(Config::MAIN_MEMCHECK_PAGE_PROTECTION);
+
   for (u32 i = 0; i < dbat_table.size(); ++i)
   {
-    if (dbat_table[i] & PowerPC::BAT_PHYSICAL_BIT)
+    const bool memchecked = (dbat_table[i] & PowerPC::BAT_MEMCHECK_BIT) != 0;
+    if ((dbat_table[i] & PowerPC::BAT_PHYSICAL_BIT) || (memchecked && protect_memchecks))
     {
       u32 logical_address = i << PowerPC::BAT_INDEX_SHIFT;
       // TODO: Merge adjacent mappings to make this faster.
@@ -280,10 +348,21 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
               exit(0);
             }
             m_logical_mapped_entries.push_back({mapped_pointer, mapped_size});
+
+            if (memchecked)
+            {
+              ProtectMemcheckedPages(
+                  base, logical_address + intersection_start - translated_address, mapped_size);
+            }
           }
 
-          m_logical_page_mappings[i] =
-              *physical_region.out_pointer + intersection_start - mapping_address;
+          // The page table is used for accesses that skip the fault handler, so memchecked pages
+          // must stay out of it.
+          if (!memchecked)
+          {
+            m_logical_page_mappings[i] =
+                *physical_region.out_pointer + intersection_start - mapping_address;
+          }
         }
       }
     }
@@ -313,6 +392,11 @@ void MemoryManager::DoState(PointerWrap& p)
   p.Do(state_have_exram);
   p.Do(state_exram_size);
 
+  // 0 for full states.
+  const u64 current_delta_base_id = m_state_delta_base ? m_state_delta_base->id : 0;
+  u64 state_delta_base_id = current_delta_base_id;
+  p.Do(state_delta_base_id);
+
   // If we're loading a savestate and any of the above differs between the savestate and the current
   // state, cancel the load. This is technically possible to support but would require a bunch of
   // reinitialization of things that depend on these.
@@ -328,17 +412,119 @@ void MemoryManager::DoState(PointerWrap& p)
     return;
   }
 
-  p.DoArray(m_ram, current_ram_size);
+  if (state_delta_base_id != current_delta_base_id)
+  {
+    Core::DisplayMessage(state_delta_base_id == 0 ?
+                             "State is not a delta state. Aborting load state." :
+                         current_delta_base_id == 0 ?
+                             "State is a delta state and needs its base. Aborting load state." :
+                             "State is a delta state of a different base. Aborting load state.",
+                         3000);
+    p.SetVerifyMode();
+    return;
+  }
+
+  if (m_state_delta_base != nullptr && (m_state_delta_base->ram.size() != current_ram_size ||
+                                        m_state_delta_base->exram.size() != current_exram_size))
+  {
+    Core::DisplayMessage("Delta state base doesn't match the current memory sizes. "
+                         "Aborting delta state.",
+                         3000);
+    p.SetVerifyMode();
+    return;
+  }
+
+  if (m_state_delta_base != nullptr)
+    DoRAMDelta(p, m_ram, current_ram_size, m_state_delta_base->ram);
+  else
+    p.DoArray(m_ram, current_ram_size);
   p.DoArray(m_l1_cache, current_l1_cache_size);
   p.DoMarker("Memory RAM");
   if (current_have_fake_vmem)
     p.DoArray(m_fake_vmem, current_fake_vmem_size);
   p.DoMarker("Memory FakeVMEM");
   if (current_have_exram)
-    p.DoArray(m_exram, current_exram_size);
+  {
+    if (m_state_delta_base != nullptr)
+      DoRAMDelta(p, m_exram, current_exram_size, m_state_delta_base->exram);
+    else
+      p.DoArray(m_exram, current_exram_size);
+  }
   p.DoMarker("Memory EXRAM");
 }
 
+void MemoryManager::DoRAMDelta(PointerWrap& p, u8* ram, u32 size, const std::vector<u8>& base)
+{
+  constexpr u32 page_size = STATE_DELTA_PAGE_SIZE;
+  const u32 num_pages = size / page_size;
+
+  // There is no cheap way to track which pages got written to: Fastmem stores bypass any
+  // bookkeeping, and write-protecting the arena would make the JIT backpatch the faulting
+  // stores to slow accesses for good. Comparing against the base is bandwidth-bound instead.
+  std::vector<u32>& pages = m_state_delta_pages;
+  if (!p.IsReadMode())
+  {
+    pages.clear();
+    for (u32 i = 0; i < num_pages; i++)
+    {
+      if (std::memcmp(ram + i * page_size, base.data() + i * page_size, page_size) != 0)
+        pages.push_back(i);
+    }
+  }
+  p.Do(pages);
+
+  if (p.IsReadMode())
+  {
+    for (size_t i = 0; i < pages.size(); i++)
+    {
+      if (pages[i] >= num_pages || (i > 0 && pages[i] <= pages[i - 1]))
+      {
+        p.SetVerifyMode();
+        return;
+      }
+    }
+  }
+
+  for (const u32 page : pages)
+    p.DoArray(ram + page * page_size, page_size);
+
+  if (p.IsReadMode())
+  {
+    // Pages not stored in the state are the same as in the base,
+    // so only the ones that changed since then need to be restored.
+    size_t next_stored = 0;
+    for (u32 i = 0; i < num_pages; i++)
+    {
+      if (next_stored < pages.size() && pages[next_stored] == i)
+      {
+        next_stored++;
+        continue;
+      }
+      u8* page = ram + i * page_size;
+      const u8* base_page = base.data() + i * page_size;
+      if (std::memcmp(page, base_page, page_size) != 0)
+        std::memcpy(page, base_page, page_size);
+    }
+  }
+}
+
+void MemoryManager::TakeRAMSnapshot(RAMSnapshot* snapshot) const
+{
+  if (m_ram)
+    snapshot->ram.assign(m_ram, m_ram + GetRamSize());
+  else
+    snapshot->ram.clear();
+  if (m_exram)
+    snapshot->exram.assign(m_exram, m_exram + GetExRamSize());
+  else
+    snapshot->exram.clear();
+
+  do
+  {
+    snapshot->id = Common::Random::GenerateValue<u64>();
+  } while (snapshot->id == 0);
+}
+
 void MemoryManager::Shutdown()
 {
   ShutdownFastmemArena();
@@ -387,6 +573,31 @@ void MemoryManager::ShutdownFastmemArena()
   m_is_fastmem_arena_initialized = false;
 }
 
+u8* MemoryManager::CreatePhysicalRegionView(u32 physical_address, u32* mapped_size)
+{
+  if (!m_is_initialized)
+    return nullptr;
+
+  for (const PhysicalMemoryRegion& region : m_physical_regions)
+  {
+    if (!region.active || region.physical_address != physical_address)
+      continue;
+
+    // An mmap'd view keeps the underlying memory segment alive on its own,
+    // so this view survives ReleaseSHMSegment() in Shutdown().
+    u8* view = static_cast<u8*>(m_arena.CreateView(region.shm_position, region.size));
+    if (view != nullptr)
+      *mapped_size = region.size;
+    return view;
+  }
+  return nullptr;
+}
+
+void MemoryManager::ReleasePhysicalRegionView(u8* view, u32 mapped_size)
+{
+  m_arena.ReleaseView(view, mapped_size);
+}
+
 void MemoryManager::Clear()
 {
   if (m_ram)
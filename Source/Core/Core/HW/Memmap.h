@@ -56,6 +56,19 @@ struct LogicalMemoryView
   u32 mapped_size;
 };
 
+// A copy of MEM1 and MEM2 that delta savestates store emulated RAM relative to.
+struct RAMSnapshot
+{
+  std::vector<u8> ram;
+  std::vector<u8> exram;
+  // Random and never 0. Delta savestates record the id of their base so that they can't be
+  // loaded with a different one.
+  u64 id = 0;
+};
+
+// Granularity at which delta savestates compare and store emulated RAM.
+constexpr u32 STATE_DELTA_PAGE_SIZE = 0x1000;
+
 class MemoryManager
 {
 public:
@@ -99,6 +112,20 @@ public:
   void ShutdownFastmemArena();
   void DoState(PointerWrap& p);
 
+  void TakeRAMSnapshot(RAMSnapshot* snapshot) const;
+  // While a base is set, DoState only stores the pages of MEM1 and MEM2 that differ from it,
+  // and loading only writes the pages that differ from the current contents.
+  // Loading such a state requires the same base to be set again, and loading a full state
+  // requires that no base is set.
+  void SetStateDeltaBase(const RAMSnapshot* base) { m_state_delta_base = base; }
+
+  // Creates an additional host mapping of the active physical memory region that starts at the
+  // given physical address (e.g. 0 for MEM1), or returns nullptr if there is no such region.
+  // Unlike GetRAM() and friends, the mapping is not tied to the lifetime of the emulated system:
+  // it stays valid after Shutdown() until it gets released with ReleasePhysicalRegionView().
+  u8* CreatePhysicalRegionView(u32 physical_address, u32* mapped_size);
+  void ReleasePhysicalRegionView(u8* view, u32 mapped_size);
+
   void UpdateLogicalMemory(const PowerPC::BatTable& dbat_table);
 
   void Clear();
@@ -254,6 +281,13 @@ private:
 
   Core::System& m_system;
 
+  // Delta savestates, see SetStateDeltaBase
+  const RAMSnapshot* m_state_delta_base = nullptr;
+  // Page indices of the current delta savestate, kept around to avoid reallocating them
+  std::vector<u32> m_state_delta_pages;
+
   void InitMMIO(bool is_wii);
+  void ProtectMemcheckedPages(u8* base, u32 logical_address, u32 size);
+  void DoRAMDelta(PointerWrap& p, u8* ram, u32 size, const std::vector<u8>& base);
 };
 }  // namespace Memory
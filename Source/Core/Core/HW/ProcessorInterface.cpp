@@ -204,14 +204,16 @@ void ProcessorInterfaceManager::SetInterrupt(u32 cause_mask, bool set)
 
   if (set && !(m_interrupt_cause & cause_mask))
   {
-    API::GetEventHub().EmitEvent(API::Events::SetInterrupt{cause_mask});
+    if (API::GetEventHub().HasListeners<API::Events::SetInterrupt>())
+      API::GetEventHub().EmitEvent(API::Events::SetInterrupt{cause_mask});
     DEBUG_LOG_FMT(PROCESSORINTERFACE, "Setting Interrupt {} (set)",
                   Debug_GetInterruptName(cause_mask));
   }
 
   if (!set && (m_interrupt_cause & cause_mask))
   {
-    API::GetEventHub().EmitEvent(API::Events::ClearInterrupt{cause_mask});
+    if (API::GetEventHub().HasListeners<API::Events::ClearInterrupt>())
+      API::GetEventHub().EmitEvent(API::Events::ClearInterrupt{cause_mask});
     DEBUG_LOG_FMT(PROCESSORINTERFACE, "Setting Interrupt {} (clear)",
                   Debug_GetInterruptName(cause_mask));
   }
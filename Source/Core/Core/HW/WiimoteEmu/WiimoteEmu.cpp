@@ -615,6 +615,7 @@ void Wiimote::SendDataReport(const DesiredWiimoteState& target_state)
   if (rpt_builder.HasCore())
   {
     rpt_builder.SetCoreData(m_status.buttons);
+    API::GetWiiButtonsManip().PerformInputManip(rpt_builder, m_index);
   }
 
   // Acceleration:
@@ -0,0 +1,105 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/AddressIntervalIndex.h"
+
+#include <algorithm>
+
+constexpr u32 PAGE_COUNT = u32(1) << (32 - AddressIntervalIndex::PAGE_SHIFT);
+
+void AddressIntervalIndex::Rebuild(const std::vector<Interval>& intervals)
+{
+  m_entries.clear();
+  if (intervals.empty())
+  {
+    m_page_bitmap.clear();
+    return;
+  }
+
+  m_entries.reserve(intervals.size());
+  for (size_t i = 0; i < intervals.size(); ++i)
+  {
+    const Interval& interval = intervals[i];
+    const u32 position = static_cast<u32>(i);
+    m_entries.push_back({interval.start, interval.end, position, interval.end, position});
+  }
+  std::ranges::sort(m_entries, {}, &Entry::start);
+  BuildTree(m_entries);
+
+  m_page_bitmap.assign(PAGE_COUNT / 64, 0);
+  for (const Entry& entry : m_entries)
+  {
+    const u32 last_page = entry.end >> PAGE_SHIFT;
+    for (u32 page = entry.start >> PAGE_SHIFT; page <= last_page; ++page)
+      m_page_bitmap[page / 64] |= u64(1) << (page % 64);
+  }
+}
+
+void AddressIntervalIndex::BuildTree(std::span<Entry> entries)
+{
+  if (entries.empty())
+    return;
+
+  const size_t middle = entries.size() / 2;
+  Entry& root = entries[middle];
+  root.max_end = root.end;
+  root.min_position = root.position;
+  for (const std::span<Entry> subtree : {entries.first(middle), entries.subspan(middle + 1)})
+  {
+    if (subtree.empty())
+      continue;
+    BuildTree(subtree);
+    const Entry& child = subtree[subtree.size() / 2];
+    root.max_end = std::max(root.max_end, child.max_end);
+    root.min_position = std::min(root.min_position, child.min_position);
+  }
+}
+
+void AddressIntervalIndex::Clear()
+{
+  m_entries.clear();
+  m_page_bitmap.clear();
+}
+
+std::optional<size_t> AddressIntervalIndex::FindFirstOverlap(u32 start, u32 end) const
+{
+  if (m_entries.empty())
+    return std::nullopt;
+
+  const u32 last_page = end >> PAGE_SHIFT;
+  u32 page = start >> PAGE_SHIFT;
+  while (!IsPageCovered(page))
+  {
+    if (page == last_page)
+      return std::nullopt;
+    ++page;
+  }
+
+  std::optional<size_t> result;
+  FindFirstOverlap(m_entries, start, end, &result);
+  return result;
+}
+
+void AddressIntervalIndex::FindFirstOverlap(std::span<const Entry> entries, u32 start, u32 end,
+                                            std::optional<size_t>* result)
+{
+  if (entries.empty())
+    return;
+
+  // Skip subtrees that end before the query or can't improve on the result found so far.
+  const size_t middle = entries.size() / 2;
+  const Entry& root = entries[middle];
+  if (root.max_end < start || (*result && root.min_position >= **result))
+    return;
+
+  FindFirstOverlap(entries.first(middle), start, end, result);
+
+  // The root and everything after it start after the query.
+  if (root.start > end)
+    return;
+
+  if (root.end >= start && (!*result || root.position < **result))
+    *result = root.position;
+
+  FindFirstOverlap(entries.subspan(middle + 1), start, end, result);
+}
@@ -0,0 +1,66 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+// A lookup structure for the address ranges of breakpoints and memchecks, which are checked on
+// every instruction or memory access while any of them exist.
+// A bitmap with one bit per page that is covered by any range answers the common case of an
+// address not being watched with a single bit test. The remaining lookups go through an interval
+// tree, so a single wide range doesn't make them walk every other range.
+class AddressIntervalIndex
+{
+public:
+  static constexpr u32 PAGE_SHIFT = 12;
+
+  // An inclusive range of addresses.
+  struct Interval
+  {
+    u32 start = 0;
+    u32 end = 0;
+  };
+
+  // Replaces the indexed ranges. Lookups identify a range by its position in `intervals`.
+  void Rebuild(const std::vector<Interval>& intervals);
+  void Clear();
+
+  bool IsEmpty() const { return m_entries.empty(); }
+
+  // Returns the lowest position of a range overlapping the inclusive range [start, end], or
+  // nullopt if there is none.
+  std::optional<size_t> FindFirstOverlap(u32 start, u32 end) const;
+  bool Overlaps(u32 start, u32 end) const { return FindFirstOverlap(start, end).has_value(); }
+
+private:
+  // A node of an implicit interval tree over the entries sorted by start address: the root of a
+  // span of entries is its middle entry, and the halves before and after it are its subtrees.
+  struct Entry
+  {
+    u32 start;
+    u32 end;
+    u32 position;
+    // The highest end and lowest position in the subtree rooted at this entry.
+    u32 max_end;
+    u32 min_position;
+  };
+
+  static void BuildTree(std::span<Entry> entries);
+  static void FindFirstOverlap(std::span<const Entry> entries, u32 start, u32 end,
+                               std::optional<size_t>* result);
+
+  bool IsPageCovered(u32 page) const
+  {
+    return (m_page_bitmap[page / 64] >> (page % 64)) & 1;
+  }
+
+  // Sorted by start address.
+  std::vector<Entry> m_entries;
+  std::vector<u64> m_page_bitmap;
+};
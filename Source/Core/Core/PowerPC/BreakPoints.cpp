@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <limits>
 #include <optional>
 #include <sstream>
 #include <string>
@@ -51,13 +52,20 @@ const TBreakPoint* BreakPoints::GetBreakpoint(u32 address) const
 const TBreakPoint* BreakPoints::GetRegularBreakpoint(u32 address) const
 {
   //API::GetEventHub().EmitEvent(API::Events::CodeBreakpoint{address});
-  auto bp = std::find_if(m_breakpoints.begin(), m_breakpoints.end(),
-                         [address](const auto& bp_) { return bp_.address == address; });
-
-  if (bp == m_breakpoints.end())
+  const std::optional<size_t> index = m_index.FindFirstOverlap(address, address);
+  if (!index)
     return nullptr;
 
-  return &*bp;
+  return &m_breakpoints[*index];
+}
+
+void BreakPoints::UpdateIndex()
+{
+  std::vector<AddressIntervalIndex::Interval> intervals;
+  intervals.reserve(m_breakpoints.size());
+  for (const TBreakPoint& bp : m_breakpoints)
+    intervals.push_back({bp.address, bp.address});
+  m_index.Rebuild(intervals);
 }
 
 BreakPoints::TBreakPointsStr BreakPoints::GetStrings() const
@@ -105,8 +113,17 @@ void BreakPoints::AddFromStrings(const TBreakPointsStr& bp_strings)
       std::getline(iss, condition);
       bp.condition = Expression::TryParse(condition);
     }
-    Add(std::move(bp));
+
+    // Like Add(TBreakPoint), but the index is only rebuilt once at the end.
+    if (std::ranges::any_of(m_breakpoints,
+                            [&bp](const TBreakPoint& other) { return other.address == bp.address; }))
+    {
+      continue;
+    }
+    m_system.GetJitInterface().InvalidateICache(bp.address, 4, true);
+    m_breakpoints.emplace_back(std::move(bp));
   }
+  UpdateIndex();
 }
 
 void BreakPoints::Add(TBreakPoint bp)
@@ -117,6 +134,7 @@ void BreakPoints::Add(TBreakPoint bp)
   m_system.GetJitInterface().InvalidateICache(bp.address, 4, true);
 
   m_breakpoints.emplace_back(std::move(bp));
+  UpdateIndex();
 }
 
 void BreakPoints::Add(u32 address)
@@ -147,6 +165,7 @@ void BreakPoints::Add(u32 address, bool break_on_hit, bool log_on_hit,
   else
   {
     m_breakpoints.emplace_back(std::move(bp));
+    UpdateIndex();
   }
 
   m_system.GetJitInterface().InvalidateICache(address, 4, true);
@@ -197,6 +216,7 @@ bool BreakPoints::Remove(u32 address)
     return false;
 
   m_breakpoints.erase(iter);
+  UpdateIndex();
   m_system.GetJitInterface().InvalidateICache(address, 4, true);
 
   return true;
@@ -210,6 +230,7 @@ void BreakPoints::Clear()
   }
 
   m_breakpoints.clear();
+  m_index.Clear();
   ClearTemporary();
 }
 
@@ -311,6 +332,7 @@ void MemChecks::Add(TMemCheck memory_check, bool update)
   {
     m_mem_checks.emplace_back(std::move(memory_check));
   }
+  m_index_outdated = true;
 
   if (update)
     Update();
@@ -339,6 +361,7 @@ bool MemChecks::Remove(u32 address, bool update)
 
   const Core::CPUThreadGuard guard(m_system);
   m_mem_checks.erase(iter);
+  m_index_outdated = true;
 
   if (update)
     Update();
@@ -350,6 +373,8 @@ void MemChecks::Clear()
 {
   const Core::CPUThreadGuard guard(m_system);
   m_mem_checks.clear();
+  m_index.Clear();
+  m_index_outdated = false;
   Update();
 }
 
@@ -357,6 +382,9 @@ void MemChecks::Update()
 {
   const Core::CPUThreadGuard guard(m_system);
 
+  if (m_index_outdated)
+    UpdateIndex();
+
   // Clear the JIT cache so it can switch the watchpoint-compatible mode.
   if (m_mem_breakpoints_set != HasAny())
   {
@@ -367,33 +395,50 @@ void MemChecks::Update()
   m_system.GetMMU().DBATUpdated();
 }
 
+void MemChecks::UpdateIndex()
+{
+  std::vector<AddressIntervalIndex::Interval> intervals;
+  intervals.reserve(m_mem_checks.size());
+  for (const TMemCheck& mc : m_mem_checks)
+    intervals.push_back({mc.start_address, mc.end_address});
+  m_index.Rebuild(intervals);
+  m_index_outdated = false;
+}
+
 TMemCheck* MemChecks::GetMemCheck(u32 address, size_t size)
 {
-  const auto iter = std::ranges::find_if(m_mem_checks, [address, size](const auto& mc) {
-    return mc.end_address >= address && address + size - 1 >= mc.start_address;
-  });
+  const u32 end_address =
+      static_cast<u32>(std::min<u64>(u64{address} + size - 1, std::numeric_limits<u32>::max()));
+  if (m_index_outdated)
+  {
+    const auto iter = std::ranges::find_if(m_mem_checks, [&](const TMemCheck& mc) {
+      return mc.start_address <= end_address && mc.end_address >= address;
+    });
+    return iter != m_mem_checks.end() ? &*iter : nullptr;
+  }
+  const std::optional<size_t> index = m_index.FindFirstOverlap(address, end_address);
 
   // None found
-  if (iter == m_mem_checks.cend())
+  if (!index)
     return nullptr;
 
-  return &*iter;
+  return &m_mem_checks[*index];
 }
 
 bool MemChecks::OverlapsMemcheck(u32 address, u32 length) const
 {
-  if (!HasAny())
-    return false;
-
+  // Checks whether any memcheck touches the naturally aligned page of `length` bytes that
+  // contains `address`.
   const u32 page_end_suffix = length - 1;
-  const u32 page_end_address = address | page_end_suffix;
-
-  return std::ranges::any_of(m_mem_checks, [&](const auto& mc) {
-    return ((mc.start_address | page_end_suffix) == page_end_address ||
-            (mc.end_address | page_end_suffix) == page_end_address) ||
-           ((mc.start_address | page_end_suffix) < page_end_address &&
-            (mc.end_address | page_end_suffix) > page_end_address);
-  });
+  const u32 page_start = address & ~page_end_suffix;
+  const u32 page_end = address | page_end_suffix;
+  if (m_index_outdated)
+  {
+    return std::ranges::any_of(m_mem_checks, [&](const TMemCheck& mc) {
+      return mc.start_address <= page_end && mc.end_address >= page_start;
+    });
+  }
+  return m_index.Overlaps(page_start, page_end);
 }
 
 bool TMemCheck::Action(Core::System& system, u64 value, u32 addr, bool write, size_t size, u32 pc)
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Core/PowerPC/AddressIntervalIndex.h"
 #include "Core/PowerPC/Expression.h"
 
 namespace Core
@@ -92,7 +93,10 @@ public:
   void ClearTemporary();
 
 private:
+  void UpdateIndex();
+
   TBreakPoints m_breakpoints;
+  AddressIntervalIndex m_index;
   std::optional<TBreakPoint> m_temp_breakpoint;
   Core::System& m_system;
 };
@@ -128,7 +132,13 @@ public:
   bool HasAny() const { return !m_mem_checks.empty(); }
 
 private:
+  void UpdateIndex();
+
   TMemChecks m_mem_checks;
+  AddressIntervalIndex m_index;
+  // Adding or removing memchecks without updating leaves the index to be rebuilt by the next
+  // Update(), so that batches only rebuild it once. Lookups fall back to a linear search until then.
+  bool m_index_outdated = false;
   Core::System& m_system;
   bool m_mem_breakpoints_set = false;
 };
@@ -206,6 +206,14 @@ s32 CachedInterpreter::CheckIdle(PowerPC::PowerPCState& ppc_state,
   return sizeof(AnyCallback) + sizeof(operands);
 }
 
+s32 CachedInterpreter::RunCodeHooks(PowerPC::PowerPCState& ppc_state,
+                                    const RunCodeHooksOperands& operands)
+{
+  const auto& [code_hooks, current_pc] = operands;
+  code_hooks.Run(current_pc);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
 bool CachedInterpreter::HandleFunctionHooking(u32 address)
 {
   // CachedInterpreter inherits from JitBase and is considered a JIT by relevant code.
@@ -366,6 +374,8 @@ bool CachedInterpreter::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
       {
         Write(CheckBreakpoint, {power_pc, js.compilerPC, js.downcountAmount});
       }
+      if (power_pc.GetCodeHooks().HasHook(js.compilerPC))
+        Write(RunCodeHooks, {power_pc.GetCodeHooks(), js.compilerPC});
       if (!js.firstFPInstructionFound && (op.opinfo->flags & FL_USE_FPU) != 0)
       {
         Write(CheckFPU, {power_pc, js.compilerPC, js.downcountAmount});
@@ -13,6 +13,7 @@
 #include "Core/PowerPC/JitCommon/JitBase.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 
+class CodeHooks;
 namespace CoreTiming
 {
 class CoreTimingManager;
@@ -82,6 +83,7 @@ private:
   struct WriteBrokenBlockNPCOperands;
   struct CheckHaltOperands;
   struct CheckIdleOperands;
+  struct RunCodeHooksOperands;
 
   static s32 StartProfiledBlock(PowerPC::PowerPCState& ppc_state,
                                 const StartProfiledBlockOperands& operands);
@@ -111,6 +113,8 @@ private:
   static s32 CheckBreakpoint(std::ostream& stream, const CheckHaltOperands& operands);
   static s32 CheckIdle(PowerPC::PowerPCState& ppc_state, const CheckIdleOperands& operands);
   static s32 CheckIdle(std::ostream& stream, const CheckIdleOperands& operands);
+  static s32 RunCodeHooks(PowerPC::PowerPCState& ppc_state, const RunCodeHooksOperands& operands);
+  static s32 RunCodeHooks(std::ostream& stream, const RunCodeHooksOperands& operands);
 
   HyoutaUtilities::RangeSizeSet<u8*> m_free_ranges;
   CachedInterpreterBlockCache m_block_cache;
@@ -175,3 +179,9 @@ struct CachedInterpreter::CheckIdleOperands
   CoreTiming::CoreTimingManager& core_timing;
   u32 idle_pc;
 };
+
+struct CachedInterpreter::RunCodeHooksOperands
+{
+  CodeHooks& code_hooks;
+  u32 current_pc;
+};
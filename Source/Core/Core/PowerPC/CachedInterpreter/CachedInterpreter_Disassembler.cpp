@@ -90,6 +90,13 @@ s32 CachedInterpreter::CheckIdle(std::ostream& stream, const CheckIdleOperands&
   return sizeof(AnyCallback) + sizeof(operands);
 }
 
+s32 CachedInterpreter::RunCodeHooks(std::ostream& stream, const RunCodeHooksOperands& operands)
+{
+  const auto& [code_hooks, current_pc] = operands;
+  fmt::println(stream, "RunCodeHooks(current_pc=0x{:08x})", current_pc);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
 static std::once_flag s_sorted_lookup_flag;
 
 std::size_t CachedInterpreter::Disassemble(const JitBlock& block, std::ostream& stream)
@@ -115,6 +122,7 @@ std::size_t CachedInterpreter::Disassemble(const JitBlock& block, std::ostream&
       LOOKUP_KV(CachedInterpreter::CheckFPU),
       LOOKUP_KV(CachedInterpreter::CheckBreakpoint),
       LOOKUP_KV(CachedInterpreter::CheckIdle),
+      LOOKUP_KV(CachedInterpreter::RunCodeHooks),
   });
 
 #undef LOOKUP_KV
@@ -0,0 +1,89 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/CodeHooks.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "Common/Assert.h"
+#include "Core/Core.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+CodeHooks::CodeHooks(Core::System& system) : m_system(system)
+{
+}
+
+CodeHooks::~CodeHooks() = default;
+
+CodeHooks::HookID CodeHooks::Add(u32 address, Callback callback)
+{
+  const Core::CPUThreadGuard guard(m_system);
+
+  const HookID id = m_next_id++;
+  // IDs only grow, so the new hook goes after all existing ones at the same address.
+  const auto iter = std::ranges::upper_bound(m_hooks, address, {}, &Hook::address);
+  m_hooks.insert(iter, {address, id, std::make_shared<Callback>(std::move(callback))});
+
+  m_system.GetJitInterface().InvalidateICache(address, 4, true);
+  return id;
+}
+
+bool CodeHooks::Remove(HookID id)
+{
+  const Core::CPUThreadGuard guard(m_system);
+
+  const auto iter = std::ranges::find(m_hooks, id, &Hook::id);
+  if (iter == m_hooks.end())
+    return false;
+
+  const u32 address = iter->address;
+  m_hooks.erase(iter);
+  m_system.GetJitInterface().InvalidateICache(address, 4, true);
+  return true;
+}
+
+void CodeHooks::Clear()
+{
+  const Core::CPUThreadGuard guard(m_system);
+
+  for (const Hook& hook : m_hooks)
+    m_system.GetJitInterface().InvalidateICache(hook.address, 4, true);
+  m_hooks.clear();
+}
+
+bool CodeHooks::HasHook(u32 address) const
+{
+  return std::ranges::binary_search(m_hooks, address, {}, &Hook::address);
+}
+
+void CodeHooks::Run(u32 address)
+{
+  ASSERT(Core::IsCPUThread());
+  auto& ppc_state = m_system.GetPPCState();
+
+  // Hooks may add or remove hooks, so look up the next one by ID after each call instead of
+  // holding on to an iterator.
+  HookID next_id = 0;
+  while (true)
+  {
+    const auto iter = std::ranges::lower_bound(
+        m_hooks, std::pair{address, next_id}, {},
+        [](const Hook& hook) { return std::pair{hook.address, hook.id}; });
+    if (iter == m_hooks.end() || iter->address != address)
+      break;
+
+    next_id = iter->id + 1;
+    const std::shared_ptr<Callback> callback = iter->callback;
+    ppc_state.pc = address;
+    (*callback)(ppc_state);
+  }
+  ppc_state.pc = address;
+}
+
+void CodeHooks::RunFromJIT(CodeHooks& code_hooks, u32 address)
+{
+  code_hooks.Run(address);
+}
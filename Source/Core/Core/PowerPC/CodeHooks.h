@@ -0,0 +1,66 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace Core
+{
+class System;
+}
+namespace PowerPC
+{
+struct PowerPCState;
+}
+
+// Native callbacks that run right before the instruction at a given address executes.
+// Unlike breakpoints, hooks never pause emulation or end JIT blocks: the JITs flush their
+// register caches and call them inline, so all of PowerPCState is up to date and changes to it
+// are picked up by the following instructions. pc holds the hooked address during the call.
+// Changing pc or npc doesn't redirect execution.
+class CodeHooks
+{
+public:
+  using Callback = std::function<void(PowerPC::PowerPCState& ppc_state)>;
+  using HookID = u32;
+
+  explicit CodeHooks(Core::System& system);
+  CodeHooks(const CodeHooks& other) = delete;
+  CodeHooks(CodeHooks&& other) = delete;
+  CodeHooks& operator=(const CodeHooks& other) = delete;
+  CodeHooks& operator=(CodeHooks&& other) = delete;
+  ~CodeHooks();
+
+  // Hooks can be added and removed from any thread, including from within a hook.
+  // Several hooks at the same address run in the order they were added.
+  HookID Add(u32 address, Callback callback);
+  // Returns whether the hook existed.
+  bool Remove(HookID id);
+  void Clear();
+
+  bool HasAny() const { return !m_hooks.empty(); }
+  bool HasHook(u32 address) const;
+
+  // Runs the hooks at the given address. Must be called on the CPU thread.
+  void Run(u32 address);
+  static void RunFromJIT(CodeHooks& code_hooks, u32 address);
+
+private:
+  struct Hook
+  {
+    u32 address;
+    HookID id;
+    // Shared so that a hook removing itself while running stays alive until it returns.
+    std::shared_ptr<Callback> callback;
+  };
+
+  // Sorted by address, then by ID.
+  std::vector<Hook> m_hooks;
+  HookID m_next_id = 1;
+  Core::System& m_system;
+};
@@ -5,7 +5,10 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
+#include <cmath>
 #include <cstdlib>
+#include <cstring>
 #include <fmt/format.h>
 #include <optional>
 #include <string>
@@ -21,9 +24,20 @@
 // if <cmath> puts its functions in the global namespace, or if the functions
 // are actually macros that expand inline, both of which are common.
 // NetBSD 10.0 i386 is an exception, and we need `using` there.
-using std::isinf;
+//
+// expr.h's to_int also relies on C's isinf returning -1 for negative infinity, while std::isinf
+// returns a bool, which would turn both infinities into INT64_MAX. <math.h> is included first so
+// that the macro below can't affect it.
+#include <math.h>
+static int ExprIsInf(double value)
+{
+  return std::isinf(value) ? (value < 0 ? -1 : 1) : 0;
+}
 using std::isnan;
+#undef isinf
+#define isinf ExprIsInf
 #include <expr.h>
+#undef isinf
 
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
@@ -87,15 +101,27 @@ void HostWrite(const Core::CPUThreadGuard& guard, u64 var, u32 address)
   PowerPC::MMU::HostWrite_U64(guard, var, address);
 }
 
+template <typename T, typename U = T>
+static double HostReadAs(const Core::CPUThreadGuard& guard, double address)
+{
+  return std::bit_cast<T>(HostRead<U>(guard, static_cast<u32>(address)));
+}
+
+template <typename T, typename U = T>
+static double CastAs(double value)
+{
+  return std::bit_cast<T>(static_cast<U>(value));
+}
+
 template <typename T, typename U = T>
 static double HostReadFunc(expr_func* f, vec_expr_t* args, void* c)
 {
   if (vec_len(args) != 1)
     return 0;
-  const u32 address = static_cast<u32>(expr_eval(&vec_nth(args, 0)));
+  const double address = expr_eval(&vec_nth(args, 0));
 
   Core::CPUThreadGuard guard(Core::System::GetInstance());
-  return std::bit_cast<T>(HostRead<U>(guard, address));
+  return HostReadAs<T, U>(guard, address);
 }
 
 template <typename T, typename U = T>
@@ -116,7 +142,7 @@ static double CastFunc(expr_func* f, vec_expr_t* args, void* c)
 {
   if (vec_len(args) != 1)
     return 0;
-  return std::bit_cast<T>(static_cast<U>(expr_eval(&vec_nth(args, 0))));
+  return CastAs<T, U>(expr_eval(&vec_nth(args, 0)));
 }
 
 static double CallstackFunc(expr_func* f, vec_expr_t* args, void* c)
@@ -398,6 +424,368 @@ Expression::Expression(std::string_view text, ExprPointer ex, ExprVarListPointer
     else
       m_binds.emplace_back();
   }
+
+  Compile();
+}
+
+// Same as expr.h's to_int, see ExprIsInf.
+static s64 ToInt(double value)
+{
+  if (std::isnan(value))
+    return 0;
+  if (std::isinf(value))
+    return value < 0 ? -INT64_MAX : INT64_MAX;
+  return static_cast<s64>(value);
+}
+
+void Expression::Compile()
+{
+  // Compiles the expression tree, or gives up on anything with side effects (assignments,
+  // writes) or that needs more than numbers (strings, callstack()), which keep using expr_eval.
+  struct Compiler
+  {
+    const Expression& expression;
+    std::vector<Instruction> program;
+    size_t depth = 0;
+
+    const VarBinding* FindBinding(const double* value) const
+    {
+      auto bind = expression.m_binds.begin();
+      for (auto* v = expression.m_vars->head; v != nullptr; v = v->next, ++bind)
+      {
+        if (&v->value == value)
+          return &*bind;
+      }
+      return nullptr;
+    }
+
+    bool Push(Instruction instruction)
+    {
+      if (++depth > MAX_STACK_DEPTH)
+        return false;
+      program.push_back(instruction);
+      return true;
+    }
+
+    void Emit(OpCode op, size_t popped)
+    {
+      depth -= popped;
+      program.push_back({op});
+    }
+
+    bool CompileVar(const expr* e)
+    {
+      const VarBinding* bind = FindBinding(e->param.var.value);
+      if (bind == nullptr)
+        return false;
+      switch (bind->type)
+      {
+      case VarBindingType::Zero:
+        return Push({OpCode::PushConstant});
+      case VarBindingType::GPR:
+        return Push({OpCode::PushGPR, static_cast<u32>(bind->index)});
+      case VarBindingType::FPR:
+        return Push({OpCode::PushFPR, static_cast<u32>(bind->index)});
+      case VarBindingType::SPR:
+        return Push({OpCode::PushSPR, static_cast<u32>(bind->index)});
+      case VarBindingType::PCtr:
+        return Push({OpCode::PushPC});
+      case VarBindingType::MSR:
+        return Push({OpCode::PushMSR});
+      }
+      return false;
+    }
+
+    bool CompileFunc(const expr* e)
+    {
+      using FuncOp = std::pair<std::string_view, OpCode>;
+      static constexpr auto funcs = std::to_array<FuncOp>({
+          {"read_u8", OpCode::ReadU8},   {"read_s8", OpCode::ReadS8},
+          {"read_u16", OpCode::ReadU16}, {"read_s16", OpCode::ReadS16},
+          {"read_u32", OpCode::ReadU32}, {"read_s32", OpCode::ReadS32},
+          {"read_f32", OpCode::ReadF32}, {"read_f64", OpCode::ReadF64},
+          {"u8", OpCode::CastU8},        {"s8", OpCode::CastS8},
+          {"u16", OpCode::CastU16},      {"s16", OpCode::CastS16},
+          {"u32", OpCode::CastU32},      {"s32", OpCode::CastS32},
+      });
+      const auto iter = std::ranges::find(funcs, std::string_view(e->param.func.f->name),
+                                          &FuncOp::first);
+      if (iter == funcs.end())
+        return false;
+      // Like the functions themselves, return 0 for the wrong number of arguments.
+      const auto* args = &e->param.func.args;
+      if (args->len != 1)
+        return Push({OpCode::PushConstant});
+      if (!CompileExpr(&args->buf[0]))
+        return false;
+      Emit(iter->second, 1);
+      ++depth;
+      return true;
+    }
+
+    bool CompileUnary(const expr* e, OpCode op)
+    {
+      if (!CompileExpr(&e->param.op.args.buf[0]))
+        return false;
+      Emit(op, 1);
+      ++depth;
+      return true;
+    }
+
+    bool CompileBinary(const expr* e, OpCode op)
+    {
+      if (!CompileExpr(&e->param.op.args.buf[0]) || !CompileExpr(&e->param.op.args.buf[1]))
+        return false;
+      Emit(op, 2);
+      ++depth;
+      return true;
+    }
+
+    bool CompileLogical(const expr* e, OpCode jump)
+    {
+      if (!CompileExpr(&e->param.op.args.buf[0]))
+        return false;
+      const size_t jump_index = program.size();
+      Emit(jump, 1);
+      if (!CompileExpr(&e->param.op.args.buf[1]))
+        return false;
+      Emit(OpCode::NormalizeZero, 1);
+      ++depth;
+      program[jump_index].index = static_cast<u32>(program.size());
+      return true;
+    }
+
+    bool CompileExpr(const expr* e)
+    {
+      switch (e->type)
+      {
+      case OP_CONST:
+        return Push({OpCode::PushConstant, 0, e->param.num.value});
+      case OP_VAR:
+        return CompileVar(e);
+      case OP_FUNC:
+        return CompileFunc(e);
+      case OP_UNARY_MINUS:
+        return CompileUnary(e, OpCode::Negate);
+      case OP_UNARY_LOGICAL_NOT:
+        return CompileUnary(e, OpCode::LogicalNot);
+      case OP_UNARY_BITWISE_NOT:
+        return CompileUnary(e, OpCode::BitwiseNot);
+      case OP_POWER:
+        return CompileBinary(e, OpCode::Power);
+      case OP_MULTIPLY:
+        return CompileBinary(e, OpCode::Multiply);
+      case OP_DIVIDE:
+        return CompileBinary(e, OpCode::Divide);
+      case OP_REMAINDER:
+        return CompileBinary(e, OpCode::Remainder);
+      case OP_PLUS:
+        return CompileBinary(e, OpCode::Add);
+      case OP_MINUS:
+        return CompileBinary(e, OpCode::Subtract);
+      case OP_SHL:
+        return CompileBinary(e, OpCode::ShiftLeft);
+      case OP_SHR:
+        return CompileBinary(e, OpCode::ShiftRight);
+      case OP_LT:
+        return CompileBinary(e, OpCode::Less);
+      case OP_LE:
+        return CompileBinary(e, OpCode::LessOrEqual);
+      case OP_GT:
+        return CompileBinary(e, OpCode::Greater);
+      case OP_GE:
+        return CompileBinary(e, OpCode::GreaterOrEqual);
+      case OP_EQ:
+        return CompileBinary(e, OpCode::Equal);
+      case OP_NE:
+        return CompileBinary(e, OpCode::NotEqual);
+      case OP_BITWISE_AND:
+        return CompileBinary(e, OpCode::BitwiseAnd);
+      case OP_BITWISE_OR:
+        return CompileBinary(e, OpCode::BitwiseOr);
+      case OP_BITWISE_XOR:
+        return CompileBinary(e, OpCode::BitwiseXor);
+      case OP_LOGICAL_AND:
+        return CompileLogical(e, OpCode::JumpIfFalse);
+      case OP_LOGICAL_OR:
+        return CompileLogical(e, OpCode::JumpIfTrue);
+      case OP_COMMA:
+        if (!CompileExpr(&e->param.op.args.buf[0]))
+          return false;
+        Emit(OpCode::Pop, 1);
+        return CompileExpr(&e->param.op.args.buf[1]);
+      default:
+        return false;
+      }
+    }
+  };
+
+  Compiler compiler{*this};
+  if (compiler.CompileExpr(m_expr.get()))
+    m_program = std::move(compiler.program);
+
+  // Only bother looking for an inline condition if the JITs wouldn't have to fall back to
+  // Evaluate anyway.
+  if (!m_program.empty())
+    m_inline_condition = BuildInlineCondition();
+}
+
+// Turns the expression into clauses of unsigned comparisons, see InlineCondition. Negated
+// subexpressions are pushed down to the comparisons.
+std::optional<Expression::InlineCondition> Expression::BuildInlineCondition() const
+{
+  using Clauses = std::vector<std::vector<InlineCondition::Comparison>>;
+  using Compare = InlineCondition::Compare;
+  static constexpr size_t MAX_CLAUSES = 8;
+  static constexpr size_t MAX_COMPARISONS = 8;
+
+  struct Builder
+  {
+    const Expression& expression;
+
+    std::optional<InlineCondition::Operand> GetOperand(const expr* e) const
+    {
+      using OperandType = InlineCondition::OperandType;
+      if (e->type == OP_CONST)
+      {
+        const double value = e->param.num.value;
+        if (!(value >= 0 && value <= 0xFFFFFFFF) || value != std::floor(value))
+          return std::nullopt;
+        return InlineCondition::Operand{OperandType::Immediate, static_cast<u32>(value)};
+      }
+      if (e->type != OP_VAR)
+        return std::nullopt;
+
+      auto bind = expression.m_binds.begin();
+      for (auto* v = expression.m_vars->head; v != nullptr; v = v->next, ++bind)
+      {
+        if (&v->value != e->param.var.value)
+          continue;
+        switch (bind->type)
+        {
+        case VarBindingType::Zero:
+          return InlineCondition::Operand{OperandType::Immediate, 0};
+        case VarBindingType::GPR:
+          return InlineCondition::Operand{OperandType::GPR, static_cast<u32>(bind->index)};
+        case VarBindingType::SPR:
+          return InlineCondition::Operand{OperandType::SPR, static_cast<u32>(bind->index)};
+        case VarBindingType::PCtr:
+          return InlineCondition::Operand{OperandType::PC};
+        case VarBindingType::MSR:
+          return InlineCondition::Operand{OperandType::MSR};
+        default:
+          return std::nullopt;
+        }
+      }
+      return std::nullopt;
+    }
+
+    static Compare Negate(Compare compare)
+    {
+      switch (compare)
+      {
+      case Compare::Equal:
+        return Compare::NotEqual;
+      case Compare::NotEqual:
+        return Compare::Equal;
+      case Compare::Less:
+        return Compare::GreaterOrEqual;
+      case Compare::LessOrEqual:
+        return Compare::Greater;
+      case Compare::Greater:
+        return Compare::LessOrEqual;
+      case Compare::GreaterOrEqual:
+      default:
+        return Compare::Less;
+      }
+    }
+
+    std::optional<Clauses> Comparison(const expr* lhs, Compare compare, const expr* rhs,
+                                      bool negate) const
+    {
+      const auto lhs_operand = GetOperand(lhs);
+      const auto rhs_operand = GetOperand(rhs);
+      if (!lhs_operand || !rhs_operand ||
+          (lhs_operand->type == InlineCondition::OperandType::Immediate &&
+           rhs_operand->type == InlineCondition::OperandType::Immediate))
+      {
+        return std::nullopt;
+      }
+      return Clauses{{{*lhs_operand, negate ? Negate(compare) : compare, *rhs_operand}}};
+    }
+
+    static std::optional<Clauses> Any(Clauses a, const Clauses& b)
+    {
+      if (a.size() + b.size() > MAX_CLAUSES)
+        return std::nullopt;
+      a.insert(a.end(), b.begin(), b.end());
+      return a;
+    }
+
+    static std::optional<Clauses> All(const Clauses& a, const Clauses& b)
+    {
+      if (a.size() * b.size() > MAX_CLAUSES)
+        return std::nullopt;
+      Clauses result;
+      for (const auto& a_clause : a)
+      {
+        for (const auto& b_clause : b)
+        {
+          if (a_clause.size() + b_clause.size() > MAX_COMPARISONS)
+            return std::nullopt;
+          auto& clause = result.emplace_back(a_clause);
+          clause.insert(clause.end(), b_clause.begin(), b_clause.end());
+        }
+      }
+      return result;
+    }
+
+    std::optional<Clauses> Build(const expr* e, bool negate) const
+    {
+      const auto* args = e->type == OP_VAR || e->type == OP_CONST ? nullptr : &e->param.op.args;
+      switch (e->type)
+      {
+      case OP_UNARY_LOGICAL_NOT:
+        return Build(&args->buf[0], !negate);
+      case OP_LOGICAL_AND:
+      case OP_LOGICAL_OR:
+      {
+        const auto a = Build(&args->buf[0], negate);
+        const auto b = Build(&args->buf[1], negate);
+        if (!a || !b)
+          return std::nullopt;
+        // De Morgan: negated, && turns into || and vice versa.
+        return (e->type == OP_LOGICAL_AND) != negate ? All(*a, *b) : Any(*a, *b);
+      }
+      case OP_LT:
+        return Comparison(&args->buf[0], Compare::Less, &args->buf[1], negate);
+      case OP_LE:
+        return Comparison(&args->buf[0], Compare::LessOrEqual, &args->buf[1], negate);
+      case OP_GT:
+        return Comparison(&args->buf[0], Compare::Greater, &args->buf[1], negate);
+      case OP_GE:
+        return Comparison(&args->buf[0], Compare::GreaterOrEqual, &args->buf[1], negate);
+      case OP_EQ:
+        return Comparison(&args->buf[0], Compare::Equal, &args->buf[1], negate);
+      case OP_NE:
+        return Comparison(&args->buf[0], Compare::NotEqual, &args->buf[1], negate);
+      case OP_VAR:
+      {
+        // A register on its own is true if it's not zero.
+        expr zero{OP_CONST};
+        zero.param.num.value = 0;
+        return Comparison(e, Compare::NotEqual, &zero, negate);
+      }
+      default:
+        return std::nullopt;
+      }
+    }
+  };
+
+  std::optional<Clauses> clauses = Builder{*this}.Build(m_expr.get(), false);
+  if (!clauses)
+    return std::nullopt;
+  return InlineCondition{std::move(*clauses)};
 }
 
 std::optional<Expression> Expression::TryParse(std::string_view text)
@@ -412,6 +800,18 @@ std::optional<Expression> Expression::TryParse(std::string_view text)
 
 double Expression::Evaluate(Core::System& system) const
 {
+  if (!m_program.empty())
+  {
+    const double result = Run(system);
+    // The variables are only needed for reporting, and compiled programs never assign them.
+    if (result != 0.0 || std::isnan(result) || HasNaNVariable(system))
+    {
+      SynchronizeBindings(system, SynchronizeDirection::From);
+      Reporting(result);
+    }
+    return result;
+  }
+
   SynchronizeBindings(system, SynchronizeDirection::From);
 
   double result = expr_eval(m_expr.get());
@@ -423,6 +823,239 @@ double Expression::Evaluate(Core::System& system) const
   return result;
 }
 
+bool Expression::HasNaNVariable(const Core::System& system) const
+{
+  const auto& ppc_state = system.GetPPCState();
+  return std::ranges::any_of(m_binds, [&](const VarBinding& bind) {
+    return bind.type == VarBindingType::FPR && std::isnan(ppc_state.ps[bind.index].PS0AsDouble());
+  });
+}
+
+double Expression::Run(Core::System& system) const
+{
+  const auto& ppc_state = system.GetPPCState();
+  // Only synchronize with the CPU thread if the condition actually reads memory.
+  std::optional<Core::CPUThreadGuard> cpu_guard;
+  const auto guard = [&]() -> const Core::CPUThreadGuard& {
+    if (!cpu_guard)
+      cpu_guard.emplace(system);
+    return *cpu_guard;
+  };
+
+  std::array<double, MAX_STACK_DEPTH> stack;
+  size_t sp = 0;
+  for (size_t pc = 0; pc < m_program.size(); ++pc)
+  {
+    const Instruction& instruction = m_program[pc];
+    const auto top = [&]() -> double& { return stack[sp - 1]; };
+    // Binary operations pop their right operand and replace their left one.
+    const auto binary = [&]() -> std::pair<double&, double> {
+      --sp;
+      return {stack[sp - 1], stack[sp]};
+    };
+    switch (instruction.op)
+    {
+    case OpCode::PushConstant:
+      stack[sp++] = instruction.value;
+      break;
+    case OpCode::PushGPR:
+      stack[sp++] = static_cast<double>(ppc_state.gpr[instruction.index]);
+      break;
+    case OpCode::PushFPR:
+      stack[sp++] = ppc_state.ps[instruction.index].PS0AsDouble();
+      break;
+    case OpCode::PushSPR:
+      stack[sp++] = static_cast<double>(ppc_state.spr[instruction.index]);
+      break;
+    case OpCode::PushPC:
+      stack[sp++] = static_cast<double>(ppc_state.pc);
+      break;
+    case OpCode::PushMSR:
+      stack[sp++] = static_cast<double>(ppc_state.msr.Hex);
+      break;
+    case OpCode::Negate:
+      top() = -top();
+      break;
+    case OpCode::LogicalNot:
+      top() = !top();
+      break;
+    case OpCode::BitwiseNot:
+      top() = static_cast<double>(~ToInt(top()));
+      break;
+    case OpCode::Power:
+    {
+      auto [a, b] = binary();
+      a = std::pow(a, b);
+      break;
+    }
+    case OpCode::Multiply:
+    {
+      auto [a, b] = binary();
+      a = a * b;
+      break;
+    }
+    case OpCode::Divide:
+    {
+      auto [a, b] = binary();
+      a = a / b;
+      break;
+    }
+    case OpCode::Remainder:
+    {
+      auto [a, b] = binary();
+      a = std::fmod(a, b);
+      break;
+    }
+    case OpCode::Add:
+    {
+      auto [a, b] = binary();
+      a = a + b;
+      break;
+    }
+    case OpCode::Subtract:
+    {
+      auto [a, b] = binary();
+      a = a - b;
+      break;
+    }
+    case OpCode::ShiftLeft:
+    {
+      auto [a, b] = binary();
+      a = static_cast<double>(ToInt(a) << ToInt(b));
+      break;
+    }
+    case OpCode::ShiftRight:
+    {
+      auto [a, b] = binary();
+      a = static_cast<double>(ToInt(a) >> ToInt(b));
+      break;
+    }
+    case OpCode::Less:
+    {
+      auto [a, b] = binary();
+      a = a < b;
+      break;
+    }
+    case OpCode::LessOrEqual:
+    {
+      auto [a, b] = binary();
+      a = a <= b;
+      break;
+    }
+    case OpCode::Greater:
+    {
+      auto [a, b] = binary();
+      a = a > b;
+      break;
+    }
+    case OpCode::GreaterOrEqual:
+    {
+      auto [a, b] = binary();
+      a = a >= b;
+      break;
+    }
+    case OpCode::Equal:
+    {
+      auto [a, b] = binary();
+      a = a == b;
+      break;
+    }
+    case OpCode::NotEqual:
+    {
+      auto [a, b] = binary();
+      a = a != b;
+      break;
+    }
+    case OpCode::BitwiseAnd:
+    {
+      auto [a, b] = binary();
+      a = static_cast<double>(ToInt(a) & ToInt(b));
+      break;
+    }
+    case OpCode::BitwiseOr:
+    {
+      auto [a, b] = binary();
+      a = static_cast<double>(ToInt(a) | ToInt(b));
+      break;
+    }
+    case OpCode::BitwiseXor:
+    {
+      auto [a, b] = binary();
+      a = static_cast<double>(ToInt(a) ^ ToInt(b));
+      break;
+    }
+    case OpCode::JumpIfFalse:
+      if (top() == 0)
+      {
+        top() = 0;
+        pc = instruction.index - 1;
+      }
+      else
+      {
+        --sp;
+      }
+      break;
+    case OpCode::JumpIfTrue:
+      // Like expr.h, || doesn't consider NaN to be true.
+      if (top() != 0 && !std::isnan(top()))
+        pc = instruction.index - 1;
+      else
+        --sp;
+      break;
+    case OpCode::NormalizeZero:
+      if (top() == 0)
+        top() = 0;
+      break;
+    case OpCode::Pop:
+      --sp;
+      break;
+    case OpCode::ReadU8:
+      top() = HostReadAs<u8>(guard(), top());
+      break;
+    case OpCode::ReadS8:
+      top() = HostReadAs<s8, u8>(guard(), top());
+      break;
+    case OpCode::ReadU16:
+      top() = HostReadAs<u16>(guard(), top());
+      break;
+    case OpCode::ReadS16:
+      top() = HostReadAs<s16, u16>(guard(), top());
+      break;
+    case OpCode::ReadU32:
+      top() = HostReadAs<u32>(guard(), top());
+      break;
+    case OpCode::ReadS32:
+      top() = HostReadAs<s32, u32>(guard(), top());
+      break;
+    case OpCode::ReadF32:
+      top() = HostReadAs<float, u32>(guard(), top());
+      break;
+    case OpCode::ReadF64:
+      top() = HostReadAs<double, u64>(guard(), top());
+      break;
+    case OpCode::CastU8:
+      top() = CastAs<u8>(top());
+      break;
+    case OpCode::CastS8:
+      top() = CastAs<s8, u8>(top());
+      break;
+    case OpCode::CastU16:
+      top() = CastAs<u16>(top());
+      break;
+    case OpCode::CastS16:
+      top() = CastAs<s16, u16>(top());
+      break;
+    case OpCode::CastU32:
+      top() = CastAs<u32>(top());
+      break;
+    case OpCode::CastS32:
+      top() = CastAs<s32, u32>(top());
+      break;
+    }
+  }
+  return stack[0];
+}
+
 void Expression::SynchronizeBindings(Core::System& system, SynchronizeDirection dir) const
 {
   auto& ppc_state = system.GetPPCState();
@@ -470,15 +1103,16 @@ void Expression::SynchronizeBindings(Core::System& system, SynchronizeDirection
 void Expression::Reporting(const double result) const
 {
   bool is_nan = std::isnan(result);
-  std::string message;
-
   for (auto* v = m_vars->head; v != nullptr; v = v->next)
-  {
-    if (std::isnan(v->value))
-      is_nan = true;
+    is_nan |= std::isnan(v->value);
+
+  // Conditions are evaluated on every hit, so don't format anything unless it's reported.
+  if (result == 0.0 && !is_nan)
+    return;
 
+  std::string message;
+  for (auto* v = m_vars->head; v != nullptr; v = v->next)
     fmt::format_to(std::back_inserter(message), "  {}={}", v->name, v->value);
-  }
 
   if (is_nan)
   {
@@ -9,6 +9,8 @@
 #include <string_view>
 #include <vector>
 
+#include "Common/CommonTypes.h"
+
 struct expr;
 struct expr_var_list;
 
@@ -35,12 +37,59 @@ using ExprVarListPointer = std::unique_ptr<expr_var_list, ExprVarListDeleter>;
 class Expression
 {
 public:
+  // A condition made only of unsigned 32-bit comparisons between registers and constants, which
+  // the JITs can check inline without calling Evaluate. It holds if any of its clauses holds, and
+  // a clause holds if all of its comparisons hold.
+  struct InlineCondition
+  {
+    enum class OperandType
+    {
+      Immediate,
+      GPR,
+      SPR,
+      PC,
+      MSR,
+    };
+
+    struct Operand
+    {
+      OperandType type = OperandType::Immediate;
+      // The immediate, or the index of the GPR or SPR.
+      u32 value = 0;
+    };
+
+    enum class Compare
+    {
+      Equal,
+      NotEqual,
+      Less,
+      LessOrEqual,
+      Greater,
+      GreaterOrEqual,
+    };
+
+    struct Comparison
+    {
+      Operand lhs;
+      Compare compare = Compare::Equal;
+      Operand rhs;
+    };
+
+    std::vector<std::vector<Comparison>> clauses;
+  };
+
   static std::optional<Expression> TryParse(std::string_view text);
 
   double Evaluate(Core::System& system) const;
 
+  // Whether any FPR variable of the expression currently holds a NaN. Evaluate reports these even
+  // if && or || skipped over the variable, like expr_eval.
+  bool HasNaNVariable(const Core::System& system) const;
+
   std::string GetText() const;
 
+  const std::optional<InlineCondition>& GetInlineCondition() const { return m_inline_condition; }
+
 private:
   enum class SynchronizeDirection
   {
@@ -64,8 +113,74 @@ private:
     int index = -1;
   };
 
+  // Conditions without side effects are compiled into a flat program for a small stack machine,
+  // which reads registers straight from PowerPCState instead of going through the variables.
+  enum class OpCode : u8
+  {
+    PushConstant,
+    PushGPR,
+    PushFPR,
+    PushSPR,
+    PushPC,
+    PushMSR,
+    Negate,
+    LogicalNot,
+    BitwiseNot,
+    Power,
+    Multiply,
+    Divide,
+    Remainder,
+    Add,
+    Subtract,
+    ShiftLeft,
+    ShiftRight,
+    Less,
+    LessOrEqual,
+    Greater,
+    GreaterOrEqual,
+    Equal,
+    NotEqual,
+    BitwiseAnd,
+    BitwiseOr,
+    BitwiseXor,
+    // Jump to `index` if the top of the stack is false (for &&) or true (for ||), keeping it.
+    // Otherwise pop it.
+    JumpIfFalse,
+    JumpIfTrue,
+    // Replaces the top of the stack by 0 if it compares equal to 0, like && and || do.
+    NormalizeZero,
+    Pop,
+    ReadU8,
+    ReadS8,
+    ReadU16,
+    ReadS16,
+    ReadU32,
+    ReadS32,
+    ReadF32,
+    ReadF64,
+    CastU8,
+    CastS8,
+    CastU16,
+    CastS16,
+    CastU32,
+    CastS32,
+  };
+
+  struct Instruction
+  {
+    OpCode op;
+    // The register index, or the jump target.
+    u32 index = 0;
+    double value = 0;
+  };
+
+  static constexpr size_t MAX_STACK_DEPTH = 16;
+
   Expression(std::string_view text, ExprPointer ex, ExprVarListPointer vars);
 
+  void Compile();
+  std::optional<InlineCondition> BuildInlineCondition() const;
+  double Run(Core::System& system) const;
   void SynchronizeBindings(Core::System& system, SynchronizeDirection dir) const;
   void Reporting(const double result) const;
 
@@ -73,6 +188,9 @@ private:
   ExprPointer m_expr;
   ExprVarListPointer m_vars;
   std::vector<VarBinding> m_binds;
+  // Empty if the condition couldn't be compiled, e.g. because it writes to memory.
+  std::vector<Instruction> m_program;
+  std::optional<InlineCondition> m_inline_condition;
 };
 
 inline bool EvaluateCondition(Core::System& system, const std::optional<Expression>& condition)
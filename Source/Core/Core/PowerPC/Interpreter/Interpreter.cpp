@@ -65,9 +65,10 @@ void Interpreter::UpdatePC()
 }
 
 Interpreter::Interpreter(Core::System& system, PowerPC::PowerPCState& ppc_state, PowerPC::MMU& mmu,
-                         Core::BranchWatch& branch_watch, PPCSymbolDB& ppc_symbol_db)
+                         Core::BranchWatch& branch_watch, Core::CallTracer& call_tracer,
+                         PPCSymbolDB& ppc_symbol_db)
     : m_system(system), m_ppc_state(ppc_state), m_mmu(mmu), m_branch_watch(branch_watch),
-      m_ppc_symbol_db(ppc_symbol_db)
+      m_call_tracer(call_tracer), m_ppc_symbol_db(ppc_symbol_db)
 {
 }
 
@@ -129,6 +130,9 @@ int Interpreter::SingleStepInner()
     return PPCTables::GetOpInfo(m_prev_inst, m_ppc_state.pc)->num_cycles;
   }
 
+  if (CodeHooks& code_hooks = m_system.GetPowerPC().GetCodeHooks(); code_hooks.HasAny())
+    code_hooks.Run(m_ppc_state.pc);
+
   m_ppc_state.npc = m_ppc_state.pc + sizeof(UGeckoInstruction);
   m_prev_inst.hex = m_mmu.Read_Opcode(m_ppc_state.pc);
 
@@ -12,6 +12,7 @@
 namespace Core
 {
 class BranchWatch;
+class CallTracer;
 class System;
 }  // namespace Core
 namespace PowerPC
@@ -25,7 +26,8 @@ class Interpreter : public CPUCoreBase
 {
 public:
   Interpreter(Core::System& system, PowerPC::PowerPCState& ppc_state, PowerPC::MMU& mmu,
-              Core::BranchWatch& branch_watch, PPCSymbolDB& ppc_symbol_db);
+              Core::BranchWatch& branch_watch, Core::CallTracer& call_tracer,
+              PPCSymbolDB& ppc_symbol_db);
   Interpreter(const Interpreter&) = delete;
   Interpreter(Interpreter&&) = delete;
   Interpreter& operator=(const Interpreter&) = delete;
@@ -318,6 +320,7 @@ private:
   PowerPC::PowerPCState& m_ppc_state;
   PowerPC::MMU& m_mmu;
   Core::BranchWatch& m_branch_watch;
+  Core::CallTracer& m_call_tracer;
   PPCSymbolDB& m_ppc_symbol_db;
 
   UGeckoInstruction m_prev_inst{};
@@ -8,6 +8,7 @@
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/Debugger/BranchWatch.h"
+#include "Core/Debugger/CallTracer.h"
 #include "Core/HLE/HLE.h"
 #include "Core/PowerPC/Interpreter/ExceptionUtils.h"
 #include "Core/PowerPC/PowerPC.h"
@@ -27,6 +28,8 @@ void Interpreter::bx(Interpreter& interpreter, UGeckoInstruction inst)
 
   if (auto& branch_watch = interpreter.m_branch_watch; branch_watch.GetRecordingActive())
     branch_watch.HitTrue(ppc_state.pc, destination_addr, inst, ppc_state.msr.IR);
+  if (auto& call_tracer = interpreter.m_call_tracer; call_tracer.IsActive())
+    call_tracer.HitTrue(ppc_state.pc, destination_addr, inst);
 
   interpreter.m_end_block = true;
 }
@@ -59,6 +62,8 @@ void Interpreter::bcx(Interpreter& interpreter, UGeckoInstruction inst)
 
     if (branch_watch.GetRecordingActive())
       branch_watch.HitTrue(ppc_state.pc, destination_addr, inst, ppc_state.msr.IR);
+    if (auto& call_tracer = interpreter.m_call_tracer; call_tracer.IsActive())
+      call_tracer.HitTrue(ppc_state.pc, destination_addr, inst);
   }
   else if (branch_watch.GetRecordingActive())
   {
@@ -88,6 +93,8 @@ void Interpreter::bcctrx(Interpreter& interpreter, UGeckoInstruction inst)
 
     if (branch_watch.GetRecordingActive())
       branch_watch.HitTrue(ppc_state.pc, destination_addr, inst, ppc_state.msr.IR);
+    if (auto& call_tracer = interpreter.m_call_tracer; call_tracer.IsActive())
+      call_tracer.HitTrue(ppc_state.pc, destination_addr, inst);
   }
   else if (branch_watch.GetRecordingActive())
   {
@@ -118,6 +125,8 @@ void Interpreter::bclrx(Interpreter& interpreter, UGeckoInstruction inst)
 
     if (branch_watch.GetRecordingActive())
       branch_watch.HitTrue(ppc_state.pc, destination_addr, inst, ppc_state.msr.IR);
+    if (auto& call_tracer = interpreter.m_call_tracer; call_tracer.IsActive())
+      call_tracer.HitTrue(ppc_state.pc, destination_addr, inst);
   }
   else if (branch_watch.GetRecordingActive())
   {
@@ -4,9 +4,11 @@
 #include "Core/PowerPC/Jit64/Jit.h"
 
 #include <map>
+#include <optional>
 #include <span>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
@@ -879,6 +881,68 @@ bool Jit64::SetEmitterStateToFreeCodeRegion()
   return true;
 }
 
+FixupBranch Jit64::WriteInlineBreakPointCondition(const Expression::InlineCondition& condition,
+                                                  u32 address)
+{
+  using Compare = Expression::InlineCondition::Compare;
+  using OperandType = Expression::InlineCondition::OperandType;
+  const auto get_operand = [address](const Expression::InlineCondition::Operand& operand) {
+    switch (operand.type)
+    {
+    case OperandType::GPR:
+      return PPCSTATE_GPR(operand.value);
+    case OperandType::SPR:
+      return PPCSTATE_SPR(operand.value);
+    case OperandType::PC:
+      // PPCSTATE(pc) isn't kept up to date inside of blocks.
+      return Imm32(address);
+    case OperandType::MSR:
+      return PPCSTATE(msr);
+    case OperandType::Immediate:
+    default:
+      return Imm32(operand.value);
+    }
+  };
+  // The conditions for the comparison *not* holding, all unsigned.
+  const auto get_inverted_cc = [](Compare compare) {
+    switch (compare)
+    {
+    case Compare::Equal:
+      return CC_NE;
+    case Compare::NotEqual:
+      return CC_E;
+    case Compare::Less:
+      return CC_AE;
+    case Compare::LessOrEqual:
+      return CC_A;
+    case Compare::Greater:
+      return CC_BE;
+    case Compare::GreaterOrEqual:
+    default:
+      return CC_B;
+    }
+  };
+
+  std::vector<FixupBranch> holds;
+  for (const auto& clause : condition.clauses)
+  {
+    std::vector<FixupBranch> clause_fails;
+    for (const auto& comparison : clause)
+    {
+      MOV(32, R(RSCRATCH), get_operand(comparison.lhs));
+      CMP(32, R(RSCRATCH), get_operand(comparison.rhs));
+      clause_fails.push_back(J_CC(get_inverted_cc(comparison.compare), Jump::Near));
+    }
+    holds.push_back(J(Jump::Near));
+    for (const FixupBranch& branch : clause_fails)
+      SetJumpTarget(branch);
+  }
+  FixupBranch fails = J(Jump::Near);
+  for (const FixupBranch& branch : holds)
+    SetJumpTarget(branch);
+  return fails;
+}
+
 bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
 {
   js.firstFPInstructionFound = false;
@@ -1053,6 +1117,16 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
         gpr.Flush();
         fpr.Flush();
 
+        // Simple conditions are checked right here, so hits that don't match stay in the block.
+        std::optional<FixupBranch> condition_fails;
+        const TBreakPoint* breakpoint = power_pc.GetBreakPoints().GetBreakpoint(op.address);
+        if (breakpoint != nullptr && breakpoint->condition &&
+            breakpoint->condition->GetInlineCondition())
+        {
+          condition_fails = WriteInlineBreakPointCondition(
+              *breakpoint->condition->GetInlineCondition(), op.address);
+        }
+
         MOV(32, PPCSTATE(pc), Imm32(op.address));
         ABI_PushRegistersAndAdjustStack({}, 0);
         ABI_CallFunctionP(PowerPC::CheckAndHandleBreakPointsFromJIT, &power_pc);
@@ -1067,6 +1141,19 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
         JMP(asm_routines.dispatcher_exit, Jump::Near);
 
         SetJumpTarget(noBreakpoint);
+        if (condition_fails)
+          SetJumpTarget(*condition_fails);
+      }
+
+      if (power_pc.GetCodeHooks().HasHook(op.address))
+      {
+        gpr.Flush();
+        fpr.Flush();
+
+        MOV(32, PPCSTATE(pc), Imm32(op.address));
+        ABI_PushRegistersAndAdjustStack({}, 0);
+        ABI_CallFunctionPC(CodeHooks::RunFromJIT, &power_pc.GetCodeHooks(), op.address);
+        ABI_PopRegistersAndAdjustStack({}, 0);
       }
 
       if ((opinfo->flags & FL_USE_FPU) && !js.firstFPInstructionFound)
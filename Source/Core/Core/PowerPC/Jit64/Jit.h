@@ -24,6 +24,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/x64ABI.h"
 #include "Common/x64Emitter.h"
+#include "Core/PowerPC/Expression.h"
 #include "Core/PowerPC/Jit64/JitAsm.h"
 #include "Core/PowerPC/Jit64/RegCache/FPURegCache.h"
 #include "Core/PowerPC/Jit64/RegCache/GPRRegCache.h"
@@ -110,6 +111,13 @@ public:
                         Gen::X64Reg reg_b, BitSet32 caller_save);
   void WriteBranchWatchDestInRSCRATCH(u32 origin, UGeckoInstruction inst, Gen::X64Reg reg_a,
                                       Gen::X64Reg reg_b, BitSet32 caller_save);
+  // Emits nothing unless inst is a call or a return.
+  void WriteCallTrace(u32 origin, const Gen::OpArg& destination, UGeckoInstruction inst,
+                      Gen::X64Reg reg_a, Gen::X64Reg reg_b, BitSet32 caller_save);
+  // Checks a breakpoint condition without leaving the block. Registers must be flushed. The
+  // returned branch is taken if the condition doesn't hold.
+  Gen::FixupBranch WriteInlineBreakPointCondition(const Expression::InlineCondition& condition,
+                                                  u32 address);
 
   bool Cleanup();
 
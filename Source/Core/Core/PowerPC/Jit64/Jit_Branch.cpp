@@ -8,6 +8,7 @@
 #include "Common/x64Emitter.h"
 #include "Core/CoreTiming.h"
 #include "Core/Debugger/BranchWatch.h"
+#include "Core/Debugger/CallTracer.h"
 #include "Core/PowerPC/Gekko.h"
 #include "Core/PowerPC/Jit64/RegCache/JitRegCache.h"
 #include "Core/PowerPC/Jit64Common/Jit64PowerPCState.h"
@@ -71,6 +72,9 @@ template <bool condition>
 void Jit64::WriteBranchWatch(u32 origin, u32 destination, UGeckoInstruction inst, X64Reg reg_a,
                              X64Reg reg_b, BitSet32 caller_save)
 {
+  if constexpr (condition)
+    WriteCallTrace(origin, Imm32(destination), inst, reg_a, reg_b, caller_save);
+
   MOV(64, R(reg_a), ImmPtr(&m_branch_watch));
   MOVZX(32, 8, reg_b, MDisp(reg_a, Core::BranchWatch::GetOffsetOfRecordingActive()));
   TEST(32, R(reg_b), R(reg_b));
@@ -102,6 +106,8 @@ template void Jit64::WriteBranchWatch<false>(u32, u32, UGeckoInstruction, X64Reg
 void Jit64::WriteBranchWatchDestInRSCRATCH(u32 origin, UGeckoInstruction inst, X64Reg reg_a,
                                            X64Reg reg_b, BitSet32 caller_save)
 {
+  WriteCallTrace(origin, R(RSCRATCH), inst, reg_a, reg_b, caller_save | BitSet32{RSCRATCH});
+
   MOV(64, R(reg_a), ImmPtr(&m_branch_watch));
   MOVZX(32, 8, reg_b, MDisp(reg_a, Core::BranchWatch::GetOffsetOfRecordingActive()));
   TEST(32, R(reg_b), R(reg_b));
@@ -129,6 +135,38 @@ void Jit64::WriteBranchWatchDestInRSCRATCH(u32 origin, UGeckoInstruction inst, X
   SetJumpTarget(branch_out);
 }
 
+void Jit64::WriteCallTrace(u32 origin, const OpArg& destination, UGeckoInstruction inst,
+                           X64Reg reg_a, X64Reg reg_b, BitSet32 caller_save)
+{
+  const bool is_call = Core::CallTracer::IsCall(inst);
+  if (!is_call && !Core::CallTracer::IsReturn(inst))
+    return;
+
+  MOV(64, R(reg_a), ImmPtr(&m_call_tracer));
+  MOVZX(32, 8, reg_b, MDisp(reg_a, Core::CallTracer::GetOffsetOfActive()));
+  TEST(32, R(reg_b), R(reg_b));
+
+  FixupBranch branch_in = J_CC(CC_NZ, Jump::Near);
+  SwitchToFarCode();
+  SetJumpTarget(branch_in);
+
+  // Assert the destination won't be clobbered before it is moved from.
+  ASSERT(!destination.IsSimpleReg(ABI_PARAM1) && !destination.IsSimpleReg(ABI_PARAM2));
+
+  ABI_PushRegistersAndAdjustStack(caller_save, 0);
+  MOV(32, R(ABI_PARAM3), destination);
+  // Some call sites have an optimization to use ABI_PARAM1 as a scratch register.
+  if (reg_a != ABI_PARAM1)
+    MOV(64, R(ABI_PARAM1), R(reg_a));
+  MOV(32, R(ABI_PARAM2), Imm32(origin));
+  ABI_CallFunction(is_call ? &Core::CallTracer::HitCall : &Core::CallTracer::HitReturn);
+  ABI_PopRegistersAndAdjustStack(caller_save, 0);
+
+  FixupBranch branch_out = J(Jump::Near);
+  SwitchToNearCode();
+  SetJumpTarget(branch_out);
+}
+
 void Jit64::bx(UGeckoInstruction inst)
 {
   INSTRUCTION_START
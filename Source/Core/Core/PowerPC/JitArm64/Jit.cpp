@@ -7,6 +7,7 @@
 #include <optional>
 #include <span>
 #include <sstream>
+#include <vector>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
@@ -1119,6 +1120,75 @@ std::optional<size_t> JitArm64::SetEmitterStateToFreeCodeRegion()
   }
 }
 
+FixupBranch JitArm64::WriteInlineBreakPointCondition(
+    const Expression::InlineCondition& condition, u32 address)
+{
+  using Compare = Expression::InlineCondition::Compare;
+  using OperandType = Expression::InlineCondition::OperandType;
+  const auto load_operand = [this, address](ARM64Reg reg,
+                                            const Expression::InlineCondition::Operand& operand) {
+    switch (operand.type)
+    {
+    case OperandType::GPR:
+      LDR(IndexType::Unsigned, reg, PPC_REG, PPCSTATE_OFF_GPR(operand.value));
+      break;
+    case OperandType::SPR:
+      LDR(IndexType::Unsigned, reg, PPC_REG, PPCSTATE_OFF_SPR(operand.value));
+      break;
+    case OperandType::PC:
+      // PPCSTATE(pc) isn't kept up to date inside of blocks.
+      MOVI2R(reg, address);
+      break;
+    case OperandType::MSR:
+      LDR(IndexType::Unsigned, reg, PPC_REG, PPCSTATE_OFF(msr));
+      break;
+    case OperandType::Immediate:
+    default:
+      MOVI2R(reg, operand.value);
+      break;
+    }
+  };
+  // The conditions for the comparison *not* holding, all unsigned.
+  const auto get_inverted_cc = [](Compare compare) {
+    switch (compare)
+    {
+    case Compare::Equal:
+      return CC_NEQ;
+    case Compare::NotEqual:
+      return CC_EQ;
+    case Compare::Less:
+      return CC_HS;
+    case Compare::LessOrEqual:
+      return CC_HI;
+    case Compare::Greater:
+      return CC_LS;
+    case Compare::GreaterOrEqual:
+    default:
+      return CC_LO;
+    }
+  };
+
+  std::vector<FixupBranch> holds;
+  for (const auto& clause : condition.clauses)
+  {
+    std::vector<FixupBranch> clause_fails;
+    for (const auto& comparison : clause)
+    {
+      load_operand(ARM64Reg::W0, comparison.lhs);
+      load_operand(ARM64Reg::W1, comparison.rhs);
+      CMP(ARM64Reg::W0, ARM64Reg::W1);
+      clause_fails.push_back(B(get_inverted_cc(comparison.compare)));
+    }
+    holds.push_back(B());
+    for (const FixupBranch& branch : clause_fails)
+      SetJumpTarget(branch);
+  }
+  FixupBranch fails = B();
+  for (const FixupBranch& branch : holds)
+    SetJumpTarget(branch);
+  return fails;
+}
+
 bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
 {
   auto& cpu = m_system.GetCPU();
@@ -1279,6 +1349,17 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
         gpr.Flush(FlushMode::All, ARM64Reg::INVALID_REG);
         fpr.Flush(FlushMode::All, ARM64Reg::INVALID_REG);
 
+        // Simple conditions are checked right here, so hits that don't match stay in the block.
+        std::optional<FixupBranch> condition_fails;
+        const TBreakPoint* breakpoint =
+            m_system.GetPowerPC().GetBreakPoints().GetBreakpoint(op.address);
+        if (breakpoint != nullptr && breakpoint->condition &&
+            breakpoint->condition->GetInlineCondition())
+        {
+          condition_fails = WriteInlineBreakPointCondition(
+              *breakpoint->condition->GetInlineCondition(), op.address);
+        }
+
         static_assert(PPCSTATE_OFF(pc) <= 252);
         static_assert(PPCSTATE_OFF(pc) + 4 == PPCSTATE_OFF(npc));
 
@@ -1301,6 +1382,20 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
         B(dispatcher_exit);
 
         SetJumpTarget(no_breakpoint);
+        if (condition_fails)
+          SetJumpTarget(*condition_fails);
+      }
+
+      if (m_system.GetPowerPC().GetCodeHooks().HasHook(op.address))
+      {
+        FlushCarry();
+        gpr.Flush(FlushMode::All, ARM64Reg::INVALID_REG);
+        fpr.Flush(FlushMode::All, ARM64Reg::INVALID_REG);
+
+        MOVI2R(DISPATCHER_PC, op.address);
+        STR(IndexType::Unsigned, DISPATCHER_PC, PPC_REG, PPCSTATE_OFF(pc));
+        ABI_CallFunction(&CodeHooks::RunFromJIT, &m_system.GetPowerPC().GetCodeHooks(),
+                         op.address);
       }
 
       if ((opinfo->flags & FL_USE_FPU) && !js.firstFPInstructionFound)
@@ -13,6 +13,7 @@
 #include "Common/Arm64Emitter.h"
 
 #include "Core/PowerPC/CPUCoreBase.h"
+#include "Core/PowerPC/Expression.h"
 #include "Core/PowerPC/JitArm64/JitArm64Cache.h"
 #include "Core/PowerPC/JitArm64/JitArm64_RegCache.h"
 #include "Core/PowerPC/JitArmCommon/BackPatch.h"
@@ -334,6 +335,16 @@ protected:
                                       UGeckoInstruction inst, Arm64Gen::ARM64Reg reg_a,
                                       Arm64Gen::ARM64Reg reg_b, BitSet32 gpr_caller_save,
                                       BitSet32 fpr_caller_save);
+  // Emits nothing unless inst is a call or a return. Destination is a u32 or an ARM64Reg.
+  template <typename Destination>
+  void WriteCallTrace(u32 origin, Destination destination, UGeckoInstruction inst,
+                      Arm64Gen::ARM64Reg reg_a, Arm64Gen::ARM64Reg reg_b, BitSet32 gpr_caller_save,
+                      BitSet32 fpr_caller_save);
+
+  // Checks a breakpoint condition without leaving the block. Registers must be flushed. The
+  // returned branch is taken if the condition doesn't hold.
+  Arm64Gen::FixupBranch
+  WriteInlineBreakPointCondition(const Expression::InlineCondition& condition, u32 address);
 
   void EmitUpdateMembase();
   void EmitStoreMembase(const Arm64Gen::ARM64Reg& msr);
@@ -9,6 +9,7 @@
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/Debugger/BranchWatch.h"
+#include "Core/Debugger/CallTracer.h"
 #include "Core/PowerPC/JitArm64/JitArm64_RegCache.h"
 #include "Core/PowerPC/PPCTables.h"
 #include "Core/PowerPC/PowerPC.h"
@@ -74,10 +75,47 @@ void JitArm64::rfi(UGeckoInstruction inst)
   WriteExceptionExit(WA);
 }
 
+template <typename Destination>
+void JitArm64::WriteCallTrace(u32 origin, Destination destination, UGeckoInstruction inst,
+                              ARM64Reg reg_a, ARM64Reg reg_b, BitSet32 gpr_caller_save,
+                              BitSet32 fpr_caller_save)
+{
+  const bool is_call = Core::CallTracer::IsCall(inst);
+  if (!is_call && !Core::CallTracer::IsReturn(inst))
+    return;
+
+  const ARM64Reg call_tracer = EncodeRegTo64(reg_a);
+  MOVP2R(call_tracer, &m_call_tracer);
+  LDRB(IndexType::Unsigned, reg_b, call_tracer, Core::CallTracer::GetOffsetOfActive());
+  FixupBranch branch_over = CBZ(reg_b);
+
+  FixupBranch branch_in = B();
+  SwitchToFarCode();
+  SetJumpTarget(branch_in);
+
+  const ARM64Reg float_emit_tmp = EncodeRegTo64(reg_b);
+  ABI_PushRegisters(gpr_caller_save);
+  m_float_emit.ABI_PushRegisters(fpr_caller_save, float_emit_tmp);
+  ABI_CallFunction(is_call ? &Core::CallTracer::HitCall : &Core::CallTracer::HitReturn,
+                   call_tracer, origin, destination);
+  m_float_emit.ABI_PopRegisters(fpr_caller_save, float_emit_tmp);
+  ABI_PopRegisters(gpr_caller_save);
+
+  FixupBranch branch_out = B();
+  SwitchToNearCode();
+  SetJumpTarget(branch_out);
+  SetJumpTarget(branch_over);
+}
+
 template <bool condition>
 void JitArm64::WriteBranchWatch(u32 origin, u32 destination, UGeckoInstruction inst, ARM64Reg reg_a,
                                 ARM64Reg reg_b, BitSet32 gpr_caller_save, BitSet32 fpr_caller_save)
 {
+  if constexpr (condition)
+  {
+    WriteCallTrace(origin, destination, inst, reg_a, reg_b, gpr_caller_save, fpr_caller_save);
+  }
+
   const ARM64Reg branch_watch = EncodeRegTo64(reg_a);
   MOVP2R(branch_watch, &m_branch_watch);
   LDRB(IndexType::Unsigned, reg_b, branch_watch, Core::BranchWatch::GetOffsetOfRecordingActive());
@@ -114,6 +152,11 @@ void JitArm64::WriteBranchWatchDestInRegister(u32 origin, ARM64Reg destination,
                                               ARM64Reg reg_b, BitSet32 gpr_caller_save,
                                               BitSet32 fpr_caller_save)
 {
+  // Unlike the branch watch call below, the destination is still needed after the call.
+  WriteCallTrace(origin, destination, inst, reg_a, reg_b,
+                 gpr_caller_save | (BitSet32{DecodeReg(destination)} & CALLER_SAVED_GPRS),
+                 fpr_caller_save);
+
   const ARM64Reg branch_watch = EncodeRegTo64(reg_a);
   MOVP2R(branch_watch, &m_branch_watch);
   LDRB(IndexType::Unsigned, reg_b, branch_watch, Core::BranchWatch::GetOffsetOfRecordingActive());
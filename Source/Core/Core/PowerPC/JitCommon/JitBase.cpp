@@ -96,7 +96,7 @@ void JitTrampoline(JitBase& jit, u32 em_address)
 JitBase::JitBase(Core::System& system)
     : m_code_buffer(code_buffer_size), m_system(system), m_ppc_state(system.GetPPCState()),
       m_mmu(system.GetMMU()), m_branch_watch(system.GetPowerPC().GetBranchWatch()),
-      m_ppc_symbol_db(system.GetPPCSymbolDB())
+      m_call_tracer(system.GetPowerPC().GetCallTracer()), m_ppc_symbol_db(system.GetPPCSymbolDB())
 {
   m_registered_config_callback_id = CPUThreadConfigCallback::AddConfigChangedCallback([this] {
     if (DoesConfigNeedRefresh())
@@ -264,14 +264,15 @@ bool JitBase::CanMergeNextInstructions(int count) const
 {
   if (m_system.GetCPU().IsStepping() || js.instructionsLeft < count)
     return false;
-  // Be careful: a breakpoint kills flags in between instructions
+  // Be careful: a breakpoint or a code hook kills flags in between instructions, and merged
+  // instructions are skipped before their code hooks would be emitted.
+  const auto& power_pc = m_system.GetPowerPC();
   for (int i = 1; i <= count; i++)
   {
-    if (IsDebuggingEnabled() &&
-        m_system.GetPowerPC().GetBreakPoints().IsAddressBreakPoint(js.op[i].address))
-    {
+    if (IsDebuggingEnabled() && power_pc.GetBreakPoints().IsAddressBreakPoint(js.op[i].address))
+      return false;
+    if (power_pc.GetCodeHooks().HasHook(js.op[i].address))
       return false;
-    }
   }
   return true;
 }
@@ -27,6 +27,7 @@
 namespace Core
 {
 class BranchWatch;
+class CallTracer;
 class System;
 }  // namespace Core
 namespace PowerPC
@@ -229,6 +230,7 @@ public:
   PowerPC::PowerPCState& m_ppc_state;
   PowerPC::MMU& m_mmu;
   Core::BranchWatch& m_branch_watch;
+  Core::CallTracer& m_call_tracer;
   PPCSymbolDB& m_ppc_symbol_db;
 };
 
@@ -25,6 +25,7 @@
 
 #include "Core/PowerPC/MMU.h"
 
+#include <algorithm>
 #include <bit>
 #include <cstddef>
 #include <cstring>
@@ -576,7 +577,8 @@ void MMU::Memcheck(u32 address, u64 var, bool write, size_t size)
   // It doesn't matter if ReadFromHardware triggers its own DSI because
   // we'll take it after resuming.
   m_ppc_state.Exceptions |= EXCEPTION_DSI | EXCEPTION_FAKE_MEMCHECK_HIT;
-  API::GetEventHub().EmitEvent(API::Events::MemoryBreakpoint{write, address, var});
+  if (API::GetEventHub().HasListeners<API::Events::MemoryBreakpoint>())
+    API::GetEventHub().EmitEvent(API::Events::MemoryBreakpoint{write, address, var});
 }
 
 u8 MMU::Read_U8(const u32 address)
@@ -790,21 +792,74 @@ size_t MMU::ReadAndCopyBytes(const Core::CPUThreadGuard& guard, char* buff, u32
 char* MMU::HostRead_Bytes(const Core::CPUThreadGuard& guard, u32 address, u32 size)
 {
   char* buff = new char[size];
+  HostRead_Bytes(guard, address, buff, size);
+  return buff;
+}
 
-  for (size_t bytes_read = 0; bytes_read < size;)
+// Copies a range that lies within a single page straight from RAM. Returns false without copying
+// anything if the page doesn't translate to RAM or if reads have to go through the data cache.
+bool MMU::HostCopyPageFromRAM(u32 address, char* buff, u32 size)
+{
+  if (m_ppc_state.m_enable_dcache)
+    return false;
+
+  if (m_ppc_state.msr.DR)
   {
-    size_t bytes_remaining = size - bytes_read;
-    if (bytes_remaining >= sizeof(u64))
-      bytes_read += ReadAndCopyBytes<u64>(guard, buff + bytes_read, address + (u32)bytes_read);
-    else if (bytes_remaining >= sizeof(u32))
-      bytes_read += ReadAndCopyBytes<u32>(guard, buff + bytes_read, address + (u32)bytes_read);
-    else if (bytes_remaining >= sizeof(u16))
-      bytes_read += ReadAndCopyBytes<u16>(guard, buff + bytes_read, address + (u32)bytes_read);
-    else
-      bytes_read += ReadAndCopyBytes<u8>(guard, buff + bytes_read, address + (u32)bytes_read);
+    auto translated_addr = TranslateAddress<XCheckTLBFlag::NoException>(address);
+    if (!translated_addr.Success())
+      return false;
+    address = translated_addr.address;
   }
 
-  return buff;
+  if (m_memory.GetRAM() && (address & 0xF8000000) == 0x00000000)
+  {
+    // Same mirroring as in ReadFromHardware. RAM is at least a page large,
+    // so the masked range can't wrap around within a page.
+    std::memcpy(buff, &m_memory.GetRAM()[address & m_memory.GetRamMask()], size);
+    return true;
+  }
+
+  if (m_memory.GetEXRAM() && (address >> 28) == 0x1 &&
+      (address & 0x0FFFFFFF) + size <= m_memory.GetExRamSizeReal())
+  {
+    std::memcpy(buff, &m_memory.GetEXRAM()[address & 0x0FFFFFFF], size);
+    return true;
+  }
+
+  return false;
+}
+
+void MMU::HostRead_Bytes(const Core::CPUThreadGuard& guard, u32 address, char* buff, u32 size)
+{
+  auto& mmu = guard.GetSystem().GetMMU();
+
+  for (u32 bytes_read = 0; bytes_read < size;)
+  {
+    // Work page by page, so that plain RAM can be copied in one go
+    // and only everything else (e.g. MMIO) has to go through ReadFromHardware.
+    const u32 page_address = address + bytes_read;
+    const u32 page_bytes = std::min<u32>(size - bytes_read, static_cast<u32>(
+                                             HW_PAGE_SIZE - (page_address & HW_PAGE_MASK)));
+    char* page_buff = buff + bytes_read;
+    bytes_read += page_bytes;
+    if (mmu.HostCopyPageFromRAM(page_address, page_buff, page_bytes))
+      continue;
+
+    for (u32 page_bytes_read = 0; page_bytes_read < page_bytes;)
+    {
+      const u32 bytes_remaining = page_bytes - page_bytes_read;
+      char* value_buff = page_buff + page_bytes_read;
+      const u32 value_address = page_address + page_bytes_read;
+      if (bytes_remaining >= sizeof(u64))
+        page_bytes_read += ReadAndCopyBytes<u64>(guard, value_buff, value_address);
+      else if (bytes_remaining >= sizeof(u32))
+        page_bytes_read += ReadAndCopyBytes<u32>(guard, value_buff, value_address);
+      else if (bytes_remaining >= sizeof(u16))
+        page_bytes_read += ReadAndCopyBytes<u16>(guard, value_buff, value_address);
+      else
+        page_bytes_read += ReadAndCopyBytes<u8>(guard, value_buff, value_address);
+    }
+  }
 }
 
 void MMU::HostWrite_U8(const Core::CPUThreadGuard& guard, const u32 var, const u32 address)
@@ -1670,6 +1725,8 @@ void MMU::UpdateBATs(BatTable& bat_table, u32 base_spr)
         // BAT_MAPPED_BIT is whether the translation is valid
         // BAT_PHYSICAL_BIT is whether we can use the fastmem arena
         // BAT_WI_BIT is whether either W or I (of WIMG) is set
+        // BAT_MEMCHECK_BIT is whether the page is backed by the fastmem arena but overlaps a
+        // memcheck
         u32 valid_bit = BAT_MAPPED_BIT;
 
         const bool wi = (batl.WIMG & 0b1100) != 0;
@@ -1702,9 +1759,14 @@ void MMU::UpdateBATs(BatTable& bat_table, u32 base_spr)
         }
 
         // Fast accesses don't support memchecks, so force slow accesses by removing fastmem
-        // mappings for all overlapping virtual pages.
-        if (m_power_pc.GetMemChecks().OverlapsMemcheck(virtual_address, BAT_PAGE_SIZE))
-          valid_bit &= ~BAT_PHYSICAL_BIT;
+        // mappings for all overlapping virtual pages. MemoryManager::UpdateLogicalMemory may
+        // still map these pages with the memchecked parts protected, so that only accesses to
+        // those parts fault and get backpatched to slow accesses.
+        if ((valid_bit & BAT_PHYSICAL_BIT) != 0 &&
+            m_power_pc.GetMemChecks().OverlapsMemcheck(virtual_address, BAT_PAGE_SIZE))
+        {
+          valid_bit = (valid_bit & ~BAT_PHYSICAL_BIT) | BAT_MEMCHECK_BIT;
+        }
 
         // (BEPI | j) == (BEPI & ~BL) | (j & BL).
         bat_table[virtual_address >> BAT_INDEX_SHIFT] = physical_address | valid_bit;
@@ -1724,7 +1786,7 @@ void MMU::UpdateFakeMMUBat(BatTable& bat_table, u32 start_addr)
     u32 flags = BAT_MAPPED_BIT | BAT_PHYSICAL_BIT;
 
     if (m_power_pc.GetMemChecks().OverlapsMemcheck(e_address << BAT_INDEX_SHIFT, BAT_PAGE_SIZE))
-      flags &= ~BAT_PHYSICAL_BIT;
+      flags = (flags & ~BAT_PHYSICAL_BIT) | BAT_MEMCHECK_BIT;
 
     bat_table[e_address] = p_address | flags;
   }
@@ -64,7 +64,8 @@ constexpr u32 BAT_PAGE_COUNT = 1 << (32 - BAT_INDEX_SHIFT);
 constexpr u32 BAT_MAPPED_BIT = 0x1;
 constexpr u32 BAT_PHYSICAL_BIT = 0x2;
 constexpr u32 BAT_WI_BIT = 0x4;
-constexpr u32 BAT_RESULT_MASK = UINT32_C(~0x7);
+constexpr u32 BAT_MEMCHECK_BIT = 0x8;
+constexpr u32 BAT_RESULT_MASK = UINT32_C(~0xF);
 using BatTable = std::array<u32, BAT_PAGE_COUNT>;  // 128 KB
 
 constexpr size_t HW_PAGE_SIZE = 4096;
@@ -142,6 +143,7 @@ public:
   template <class T>
   static size_t ReadAndCopyBytes(const Core::CPUThreadGuard& guard, char* buff, u32 address);
   static char* HostRead_Bytes(const Core::CPUThreadGuard& guard, u32 address, u32 size);
+  static void HostRead_Bytes(const Core::CPUThreadGuard& guard, u32 address, char* buff, u32 size);
 
   // Try to read a value from emulated memory at the given address in the given memory space.
   // If the read succeeds, the returned value will be present and the ReadResult contains the read
@@ -318,6 +320,8 @@ private:
 
   void Memcheck(u32 address, u64 var, bool write, size_t size);
 
+  bool HostCopyPageFromRAM(u32 address, char* buff, u32 size);
+
   void UpdateBATs(BatTable& bat_table, u32 base_spr);
   void UpdateFakeMMUBat(BatTable& bat_table, u32 start_addr);
 
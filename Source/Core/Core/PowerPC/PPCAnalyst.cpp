@@ -239,6 +239,10 @@ bool PPCAnalyzer::CanSwapAdjacentOps(const CodeOp& a, const CodeOp& b) const
     if (breakpoints.IsAddressBreakPoint(a.address) || breakpoints.IsAddressBreakPoint(b.address))
       return false;
   }
+  // nor around code hooks, which see the state right before their instruction
+  const auto& code_hooks = Core::System::GetInstance().GetPowerPC().GetCodeHooks();
+  if (code_hooks.HasHook(a.address) || code_hooks.HasHook(b.address))
+    return false;
   // Any instruction which can raise an interrupt is *not* a possible swap candidate:
   // see [1] for an example of a crash caused by this error.
   //
@@ -890,8 +894,10 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
       else if (inst.OPCD == 19 && inst.SUBOP10 == 16 && !inst.LK && found_call)
       {
         code[i].branchTo = code[caller].address + 4;
+        // Skipped returns aren't compiled, so don't skip ones that have code hooks.
         if ((inst.BO & BO_DONT_DECREMENT_FLAG) && (inst.BO & BO_DONT_CHECK_CONDITION) &&
-            numFollows < BRANCH_FOLLOWING_THRESHOLD)
+            numFollows < BRANCH_FOLLOWING_THRESHOLD &&
+            !system.GetPowerPC().GetCodeHooks().HasHook(address))
         {
           // bclrx with unconditional branch = return
           // Follow it if we can propagate the LR value of the last CALL instruction.
@@ -1004,14 +1010,17 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
     const auto ppc_mode = power_pc.GetMode();
     const bool hle = !!HLE::TryReplaceFunction(ppc_symbol_db, op.address, ppc_mode);
     const bool breakpoint = power_pc.GetBreakPoints().IsAddressBreakPoint(op.address);
+    const bool code_hook = power_pc.GetCodeHooks().HasHook(op.address);
     const bool may_exit_block = hle || breakpoint || op.canEndBlock || op.canCauseException;
+    // Code hooks don't exit the block, but can look at the flags all the same.
+    const bool wants_flags = may_exit_block || code_hook;
 
     const bool opWantsFPRF = op.wantsFPRF;
     const bool opWantsCA = op.wantsCA;
-    op.wantsFPRF = wantsFPRF || may_exit_block;
-    op.wantsCA = wantsCA || may_exit_block;
-    wantsFPRF |= opWantsFPRF || may_exit_block;
-    wantsCA |= opWantsCA || may_exit_block;
+    op.wantsFPRF = wantsFPRF || wants_flags;
+    op.wantsCA = wantsCA || wants_flags;
+    wantsFPRF |= opWantsFPRF || wants_flags;
+    wantsCA |= opWantsCA || wants_flags;
     wantsFPRF &= !op.outputFPRF || opWantsFPRF;
     wantsCA &= !op.outputCA || opWantsCA;
     op.gprInUse = gprInUse;
@@ -1030,7 +1039,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
     if (strncmp(op.opinfo->opname, "stfd", 4))
       fprInXmm |= op.fregsIn;
 
-    if (hle || breakpoint)
+    if (hle || breakpoint || code_hook)
     {
       gprInUse = BitSet32{};
       fprInUse = BitSet32{};
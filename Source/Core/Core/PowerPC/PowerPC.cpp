@@ -62,7 +62,8 @@ static void InvalidateCacheThreadSafe(Core::System& system, u64 userdata, s64 cy
 }
 
 PowerPCManager::PowerPCManager(Core::System& system)
-    : m_breakpoints(system), m_memchecks(system), m_debug_interface(system, m_symbol_db),
+    : m_breakpoints(system), m_memchecks(system), m_code_hooks(system),
+      m_debug_interface(system, m_symbol_db), m_call_tracer(system.GetCoreTiming()),
       m_system(system)
 {
 }
@@ -255,10 +256,24 @@ void PowerPCManager::RefreshConfig()
     INFO_LOG_FMT(POWERPC, "Flushing data cache");
     m_ppc_state.dCache.FlushAll(m_system.GetMemory());
   }
+
+  const bool old_memcheck_page_protection = m_memcheck_page_protection;
+
+  m_memcheck_page_protection = Config::Get(Config::MAIN_MEMCHECK_PAGE_PROTECTION);
+
+  // Whether memchecked pages are mapped into the fastmem arena depends on this setting, so the
+  // logical mappings and the JIT code that was compiled against them have to be rebuilt.
+  if (old_memcheck_page_protection != m_memcheck_page_protection && m_memchecks.HasAny())
+  {
+    INFO_LOG_FMT(POWERPC, "Rebuilding memchecked fastmem mappings");
+    m_system.GetMMU().DBATUpdated();
+  }
 }
 
 void PowerPCManager::Init(CPUCore cpu_core)
 {
+  // The mappings are built with the current setting on boot, there's nothing to rebuild yet.
+  m_memcheck_page_protection = Config::Get(Config::MAIN_MEMCHECK_PAGE_PROTECTION);
   m_registered_config_callback_id =
       CPUThreadConfigCallback::AddConfigChangedCallback([this] { RefreshConfig(); });
   RefreshConfig();
@@ -648,7 +663,8 @@ bool PowerPCManager::CheckBreakPoints()
   }
   if (bp->break_on_hit)
   {
-    API::GetEventHub().EmitEvent(API::Events::CodeBreakpoint{m_ppc_state.pc});
+    if (API::GetEventHub().HasListeners<API::Events::CodeBreakpoint>())
+      API::GetEventHub().EmitEvent(API::Events::CodeBreakpoint{m_ppc_state.pc});
     return true;
   }
   return false;
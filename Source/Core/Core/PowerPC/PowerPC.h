@@ -14,8 +14,10 @@
 
 #include "Core/CPUThreadConfigCallback.h"
 #include "Core/Debugger/BranchWatch.h"
+#include "Core/Debugger/CallTracer.h"
 #include "Core/Debugger/PPCDebugInterface.h"
 #include "Core/PowerPC/BreakPoints.h"
+#include "Core/PowerPC/CodeHooks.h"
 #include "Core/PowerPC/ConditionRegister.h"
 #include "Core/PowerPC/Gekko.h"
 #include "Core/PowerPC/PPCCache.h"
@@ -296,12 +298,16 @@ public:
   const BreakPoints& GetBreakPoints() const { return m_breakpoints; }
   MemChecks& GetMemChecks() { return m_memchecks; }
   const MemChecks& GetMemChecks() const { return m_memchecks; }
+  CodeHooks& GetCodeHooks() { return m_code_hooks; }
+  const CodeHooks& GetCodeHooks() const { return m_code_hooks; }
   PPCDebugInterface& GetDebugInterface() { return m_debug_interface; }
   const PPCDebugInterface& GetDebugInterface() const { return m_debug_interface; }
   PPCSymbolDB& GetSymbolDB() { return m_symbol_db; }
   const PPCSymbolDB& GetSymbolDB() const { return m_symbol_db; }
   Core::BranchWatch& GetBranchWatch() { return m_branch_watch; }
   const Core::BranchWatch& GetBranchWatch() const { return m_branch_watch; }
+  Core::CallTracer& GetCallTracer() { return m_call_tracer; }
+  const Core::CallTracer& GetCallTracer() const { return m_call_tracer; }
 
 private:
   void InitializeCPUCore(CPUCore cpu_core);
@@ -314,12 +320,15 @@ private:
   CPUCoreBase* m_cpu_core_base = nullptr;
   bool m_cpu_core_base_is_injected = false;
   CoreMode m_mode = CoreMode::Interpreter;
+  bool m_memcheck_page_protection = false;
 
   BreakPoints m_breakpoints;
   MemChecks m_memchecks;
+  CodeHooks m_code_hooks;
   PPCSymbolDB m_symbol_db;
   PPCDebugInterface m_debug_interface;
   Core::BranchWatch m_branch_watch;
+  Core::CallTracer m_call_tracer;
 
   CPUThreadConfigCallback::ConfigChangedCallbackID m_registered_config_callback_id;
 
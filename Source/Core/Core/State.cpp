@@ -102,7 +102,7 @@ static size_t s_state_writes_in_queue;
 static std::condition_variable s_state_write_queue_is_empty;
 
 // Don't forget to increase this after doing changes on the savestate system
-constexpr u32 STATE_VERSION = 170;  // Last changed in PR 13219
+constexpr u32 STATE_VERSION = 171;  // Last changed for delta savestates
 
 // Increase this if the StateExtendedHeader definition changes
 constexpr u32 EXTENDED_HEADER_VERSION = 1;  // Last changed in PR 12217
@@ -209,6 +209,12 @@ static void DoState(Core::System& system, PointerWrap& p)
 }
 
 void LoadFromBuffer(Core::System& system, std::vector<u8>& buffer, bool emit_event)
+{
+  LoadFromBuffer(system, buffer.data(), buffer.size(), emit_event);
+}
+
+void LoadFromBuffer(Core::System& system, const u8* data, size_t size, bool emit_event,
+                    const Memory::RAMSnapshot* delta_base)
 {
   if (NetPlay::IsNetPlayRunning())
   {
@@ -227,9 +233,12 @@ void LoadFromBuffer(Core::System& system, std::vector<u8>& buffer, bool emit_eve
       [&] {
         if (emit_event)
           API::GetEventHub().EmitEvent(API::Events::BeforeSaveStateLoad{false, -1});
-        u8* ptr = buffer.data();
-        PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Read);
+        // PointerWrap never writes to the buffer in read mode
+        u8* ptr = const_cast<u8*>(data);
+        PointerWrap p(&ptr, size, PointerWrap::Mode::Read);
+        system.GetMemory().SetStateDeltaBase(delta_base);
         DoState(system, p);
+        system.GetMemory().SetStateDeltaBase(nullptr);
         if (emit_event)
           API::GetEventHub().EmitEvent(API::Events::SaveStateLoad{false, -1});
         if (Config::Get(Config::MAIN_REMOVE_UI_DELAY))
@@ -261,6 +270,47 @@ void SaveToBuffer(Core::System& system, std::vector<u8>& buffer, bool emit_event
       true);
 }
 
+size_t SaveToReusedBuffer(Core::System& system, std::vector<u8>& buffer, bool emit_event,
+                          const Memory::RAMSnapshot* delta_base)
+{
+  size_t state_size = 0;
+  Core::RunOnCPUThread(
+      system,
+      [&] {
+        if (emit_event)
+          API::GetEventHub().EmitEvent(API::Events::SaveStateSave{false, -1});
+
+        system.GetMemory().SetStateDeltaBase(delta_base);
+
+        // Optimistically write into the existing buffer. If the state doesn't fit,
+        // PointerWrap switches to measure mode, so the pass doubles as the measure pass.
+        u8* ptr = buffer.data();
+        PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Write);
+        DoState(system, p);
+        state_size = static_cast<size_t>(ptr - buffer.data());
+
+        if (p.IsMeasureMode())
+        {
+          buffer.resize(state_size);
+          ptr = buffer.data();
+          PointerWrap p_retry(&ptr, state_size, PointerWrap::Mode::Write);
+          DoState(system, p_retry);
+          state_size = static_cast<size_t>(ptr - buffer.data());
+        }
+        system.GetMemory().SetStateDeltaBase(nullptr);
+        if (Config::Get(Config::MAIN_REMOVE_UI_DELAY))
+          g_presenter->Present();
+      },
+      true);
+  return state_size;
+}
+
+void TakeRAMSnapshot(Core::System& system, Memory::RAMSnapshot& snapshot)
+{
+  Core::RunOnCPUThread(
+      system, [&] { system.GetMemory().TakeRAMSnapshot(&snapshot); }, true);
+}
+
 namespace
 {
 struct SlotWithTimestamp
@@ -17,6 +17,10 @@ namespace Core
 {
 class System;
 }
+namespace Memory
+{
+struct RAMSnapshot;
+}
 
 namespace State
 {
@@ -111,6 +115,19 @@ void LoadFile(Core::System& system, const std::string& filename, bool emit_event
 void SaveToBuffer(Core::System& system, std::vector<u8>& buffer, bool emit_event);
 void LoadFromBuffer(Core::System& system, std::vector<u8>& buffer, bool emit_event);
 
+// Like SaveToBuffer, but uses the buffer's current size as a guess for the savestate's size,
+// which skips the measuring pass as long as the savestate fits. The buffer only ever grows.
+// Returns the savestate's actual size, which may be less than the buffer's size.
+// If a delta base is given, only the pages of emulated RAM that differ from it are saved,
+// and the savestate can only be loaded with the same delta base.
+size_t SaveToReusedBuffer(Core::System& system, std::vector<u8>& buffer, bool emit_event,
+                          const Memory::RAMSnapshot* delta_base = nullptr);
+void LoadFromBuffer(Core::System& system, const u8* data, size_t size, bool emit_event,
+                    const Memory::RAMSnapshot* delta_base = nullptr);
+
+// Copies the current emulated RAM, to be used as a base for delta savestates.
+void TakeRAMSnapshot(Core::System& system, Memory::RAMSnapshot& snapshot);
+
 void LoadLastSaved(Core::System& system, int i = 1);
 void SaveFirstSaved(Core::System& system);
 void UndoSaveState(Core::System& system);
@@ -4,9 +4,11 @@
 #include "DolphinNoGUI/Platform.h"
 
 #include <OptionParser.h>
+#include <algorithm>
 #include <cstddef>
 #include <cstdio>
 #include <cstring>
+#include <optional>
 #include <signal.h>
 #include <string>
 #include <vector>
@@ -17,15 +19,20 @@
 #include <Windows.h>
 #endif
 
+#include "Common/Config/Config.h"
 #include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
 #include "Core/Boot/Boot.h"
 #include "Core/BootManager.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/Host.h"
 #include "Core/System.h"
 
+#include "Scripting/ScriptList.h"
+#include "Scripting/ScriptingEngine.h"
+
 #include "UICommon/CommandLineParse.h"
 #ifdef USE_DISCORD_PRESENCE
 #include "UICommon/DiscordPresence.h"
@@ -248,6 +255,14 @@ int main(int argc, char* argv[])
             "macos"
 #endif
       });
+  parser->add_option("--exit-on-script-end")
+      .action("store_true")
+      .dest("exit_on_script_end")
+      .help("Stop emulation once all scripts supplied with --script have finished");
+  parser->add_option("--emulation-speed")
+      .type("float")
+      .dest("emulation_speed")
+      .help("Emulation speed as a multiple of full speed, 0 for unlimited");
 
   optparse::Values& options = CommandLineParse::ParseArguments(parser.get(), argc, argv);
   std::vector<std::string> args = parser->args();
@@ -294,6 +309,22 @@ int main(int argc, char* argv[])
     return 0;
   }
 
+  std::optional<std::string> script_path;
+  if (options.is_set("script"))
+    script_path = static_cast<const char*>(options.get("script"));
+
+  const bool exit_on_script_end = options.is_set("exit_on_script_end");
+  if (exit_on_script_end && !script_path)
+  {
+    fprintf(stderr, "--exit-on-script-end requires a script supplied with --script.\n");
+    return 1;
+  }
+
+  if (options.is_set("no_python_subinterpreters"))
+    Scripting::ScriptingBackend::DisablePythonSubinterpreters();
+  if (options.get("python_per_interpreter_gil"))
+    Scripting::ScriptingBackend::EnablePythonPerInterpreterGIL();
+
   std::string user_directory;
   if (options.is_set("user"))
     user_directory = static_cast<const char*>(options.get("user"));
@@ -322,6 +353,17 @@ int main(int argc, char* argv[])
     return 1;
   }
 
+  if (options.is_set("emulation_speed"))
+  {
+    const float emulation_speed = options.get("emulation_speed");
+    Config::SetCurrent(Config::MAIN_EMULATION_SPEED, std::max(emulation_speed, 0.0f));
+  }
+
+  // Scripts are started by Core once the game has booted.
+  if (script_path)
+    Scripts::g_scripts[*script_path] = nullptr;
+  s_platform->SetExitOnScriptEnd(exit_on_script_end);
+
   Core::AddOnStateChangedCallback([](Core::State state) {
     if (state == Core::State::Uninitialized)
       s_platform->Stop();
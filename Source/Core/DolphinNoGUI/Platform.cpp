@@ -3,11 +3,15 @@
 
 #include "DolphinNoGUI/Platform.h"
 
+#include <algorithm>
+
+#include "Core/Core.h"
 #include "Core/HW/ProcessorInterface.h"
 #include "Core/IOS/IOS.h"
 #include "Core/IOS/STM/STM.h"
 #include "Core/State.h"
 #include "Core/System.h"
+#include "Scripting/ScriptList.h"
 
 Platform::~Platform() = default;
 
@@ -40,6 +44,22 @@ void Platform::UpdateRunningFlag()
   }
 }
 
+void Platform::DispatchHostJobs()
+{
+  Core::HostDispatchJobs(Core::System::GetInstance());
+
+  // Scripts queue starting and stopping scripts through host jobs, e.g. with cancel_script.
+  Scripts::ApplyQueuedScriptChanges();
+  // Scripts that were cancelled are gone, scripts that returned or failed are still there.
+  if (m_exit_on_script_end &&
+      std::ranges::all_of(Scripts::g_scripts, [](const auto& script) {
+        return script.second != nullptr && script.second->HasEnded();
+      }))
+  {
+    m_running.Clear();
+  }
+}
+
 void Platform::Stop()
 {
   m_running.Clear();
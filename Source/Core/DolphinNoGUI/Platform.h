@@ -30,6 +30,10 @@ public:
   // Request an immediate shutdown.
   void Stop();
 
+  // Request an immediate shutdown once all scripts were cancelled, or have returned or failed
+  // without waiting for any events.
+  void SetExitOnScriptEnd(bool exit_on_script_end) { m_exit_on_script_end = exit_on_script_end; }
+
   static std::unique_ptr<Platform> CreateHeadlessPlatform();
 #ifdef HAVE_X11
   static std::unique_ptr<Platform> CreateX11Platform();
@@ -49,6 +53,8 @@ public:
 
 protected:
   void UpdateRunningFlag();
+  // Dispatches host jobs and applies the script changes they queued.
+  void DispatchHostJobs();
 
   Common::Flag m_running{true};
   Common::Flag m_shutdown_requested{false};
@@ -56,4 +62,5 @@ protected:
 
   bool m_window_focus = true;  // Should be made atomic if actually implemented
   bool m_window_fullscreen = false;
+  bool m_exit_on_script_end = false;
 };
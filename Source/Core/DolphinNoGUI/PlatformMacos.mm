@@ -227,7 +227,7 @@ void PlatformMacOS::MainLoop()
   while (IsRunning())
   {
     UpdateRunningFlag();
-    Core::HostDispatchJobs(Core::System::GetInstance());
+    DispatchHostJobs();
     ProcessEvents();
     UpdateWindowPosition();
   }
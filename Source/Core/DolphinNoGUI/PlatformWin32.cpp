@@ -125,7 +125,7 @@ void PlatformWin32::MainLoop()
   while (IsRunning())
   {
     UpdateRunningFlag();
-    Core::HostDispatchJobs(Core::System::GetInstance());
+    DispatchHostJobs();
     ProcessEvents();
     UpdateWindowPosition();
 
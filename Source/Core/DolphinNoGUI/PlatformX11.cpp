@@ -153,7 +153,7 @@ void PlatformX11::MainLoop()
   while (IsRunning())
   {
     UpdateRunningFlag();
-    Core::HostDispatchJobs(Core::System::GetInstance());
+    DispatchHostJobs();
     ProcessEvents();
     UpdateWindowPosition();
 
@@ -229,6 +229,10 @@ int main(int argc, char* argv[])
   {
     Scripting::ScriptingBackend::DisablePythonSubinterpreters();
   }
+  if (options.get("python_per_interpreter_gil"))
+  {
+    Scripting::ScriptingBackend::EnablePythonPerInterpreterGIL();
+  }
 
   int retval;
 
@@ -4,19 +4,28 @@
 
 #include "controllermodule.h"
 
+#include <optional>
+#include <vector>
+
+#include <structmember.h>
+
 #include "Core/API/Controller.h"
+#include "Core/HW/WiimoteEmu/WiimoteEmu.h"
 #include "Common/Logging/Log.h"
 #include "Scripting/Python/PyScriptingBackend.h"
 #include "Scripting/Python/Utils/module.h"
 
 namespace PyScripting
 {
+// The state's address also identifies the script as the owner of the inputs it sets.
 struct ControllerModuleState
 {
   API::GCManip* gc_manip;
   API::WiiButtonsManip* wii_buttons_manip;
   API::WiiIRManip* wii_ir_manip;
   API::NunchuckButtonsManip* nunchuck_buttons_manip;
+  PyTypeObject* gc_pad_state_type;
+  PyTypeObject* wii_buttons_state_type;
 };
 
 static PyObject* GCPadStatusToPyDict(GCPadStatus status) {
@@ -157,6 +166,264 @@ static WiimoteCommon::ButtonData WiiButtonDataFromPyDict(PyObject* dict) {
   return status;
 }
 
+// Fixed-layout alternatives to the input dicts, wrapping the native input structs directly.
+// Reading and writing their fields doesn't need any dict lookups, and they are converted
+// to and from the native inputs by a plain copy.
+struct PyGCPadState
+{
+  PyObject_HEAD
+  GCPadStatus status;
+};
+
+struct PyWiiButtonsState
+{
+  PyObject_HEAD
+  WiimoteCommon::ButtonData data;
+};
+
+// Button getters and setters receive the button's bit mask as their closure.
+static u16 ButtonMaskFromClosure(void* closure)
+{
+  return static_cast<u16>(reinterpret_cast<uintptr_t>(closure));
+}
+
+static void* ButtonMaskToClosure(u16 mask)
+{
+  return reinterpret_cast<void*>(static_cast<uintptr_t>(mask));
+}
+
+static PyObject* GetButton(u16 buttons, void* closure)
+{
+  return PyBool_FromLong(buttons & ButtonMaskFromClosure(closure));
+}
+
+static int SetButton(u16* buttons, PyObject* value, void* closure)
+{
+  if (value == nullptr)
+  {
+    PyErr_SetString(PyExc_AttributeError, "cannot delete buttons");
+    return -1;
+  }
+  const int pressed = PyObject_IsTrue(value);
+  if (pressed < 0)
+    return -1;
+  if (pressed)
+    *buttons |= ButtonMaskFromClosure(closure);
+  else
+    *buttons &= ~ButtonMaskFromClosure(closure);
+  return 0;
+}
+
+static PyObject* GCPadStateNew(PyTypeObject* type, PyObject* args, PyObject* kwargs)
+{
+  if (PyTuple_GET_SIZE(args) != 0)
+  {
+    PyErr_SetString(PyExc_TypeError, "GCPadState only takes keyword arguments");
+    return nullptr;
+  }
+  // Same defaults as for the dicts, i.e. neutral sticks and connected.
+  GCPadStatus status;
+  status.stickX = GCPadStatus::MAIN_STICK_CENTER_X;
+  status.stickY = GCPadStatus::MAIN_STICK_CENTER_Y;
+  status.substickX = GCPadStatus::C_STICK_CENTER_X;
+  status.substickY = GCPadStatus::C_STICK_CENTER_Y;
+  if (kwargs != nullptr)
+  {
+    status = GCPadStatusFromPyDict(kwargs);
+    if (PyErr_Occurred())
+      return nullptr;
+  }
+  PyGCPadState* self = reinterpret_cast<PyGCPadState*>(type->tp_alloc(type, 0));
+  if (self == nullptr)
+    return nullptr;
+  self->status = status;
+  return reinterpret_cast<PyObject*>(self);
+}
+
+static void GCPadStateDealloc(PyObject* self)
+{
+  PyTypeObject* type = Py_TYPE(self);
+  type->tp_free(self);
+  Py_DECREF(type);
+}
+
+static PyObject* GCPadStateGetButton(PyObject* self, void* closure)
+{
+  return GetButton(reinterpret_cast<PyGCPadState*>(self)->status.button, closure);
+}
+
+static int GCPadStateSetButton(PyObject* self, PyObject* value, void* closure)
+{
+  return SetButton(&reinterpret_cast<PyGCPadState*>(self)->status.button, value, closure);
+}
+
+static PyTypeObject* CreateGCPadStateType(PyObject* module)
+{
+  static PyGetSetDef getset[] = {
+      {"Left", GCPadStateGetButton, GCPadStateSetButton, nullptr,
+       ButtonMaskToClosure(PAD_BUTTON_LEFT)},
+      {"Right", GCPadStateGetButton, GCPadStateSetButton, nullptr,
+       ButtonMaskToClosure(PAD_BUTTON_RIGHT)},
+      {"Down", GCPadStateGetButton, GCPadStateSetButton, nullptr,
+       ButtonMaskToClosure(PAD_BUTTON_DOWN)},
+      {"Up", GCPadStateGetButton, GCPadStateSetButton, nullptr, ButtonMaskToClosure(PAD_BUTTON_UP)},
+      {"Z", GCPadStateGetButton, GCPadStateSetButton, nullptr, ButtonMaskToClosure(PAD_TRIGGER_Z)},
+      {"R", GCPadStateGetButton, GCPadStateSetButton, nullptr, ButtonMaskToClosure(PAD_TRIGGER_R)},
+      {"L", GCPadStateGetButton, GCPadStateSetButton, nullptr, ButtonMaskToClosure(PAD_TRIGGER_L)},
+      {"A", GCPadStateGetButton, GCPadStateSetButton, nullptr, ButtonMaskToClosure(PAD_BUTTON_A)},
+      {"B", GCPadStateGetButton, GCPadStateSetButton, nullptr, ButtonMaskToClosure(PAD_BUTTON_B)},
+      {"X", GCPadStateGetButton, GCPadStateSetButton, nullptr, ButtonMaskToClosure(PAD_BUTTON_X)},
+      {"Y", GCPadStateGetButton, GCPadStateSetButton, nullptr, ButtonMaskToClosure(PAD_BUTTON_Y)},
+      {"Start", GCPadStateGetButton, GCPadStateSetButton, nullptr,
+       ButtonMaskToClosure(PAD_BUTTON_START)},
+      {nullptr, nullptr, nullptr, nullptr, nullptr}  // Sentinel
+  };
+  static PyMemberDef members[] = {
+      {"Buttons", T_USHORT, offsetof(PyGCPadState, status.button), 0, nullptr},
+      {"StickX", T_UBYTE, offsetof(PyGCPadState, status.stickX), 0, nullptr},
+      {"StickY", T_UBYTE, offsetof(PyGCPadState, status.stickY), 0, nullptr},
+      {"CStickX", T_UBYTE, offsetof(PyGCPadState, status.substickX), 0, nullptr},
+      {"CStickY", T_UBYTE, offsetof(PyGCPadState, status.substickY), 0, nullptr},
+      {"TriggerLeft", T_UBYTE, offsetof(PyGCPadState, status.triggerLeft), 0, nullptr},
+      {"TriggerRight", T_UBYTE, offsetof(PyGCPadState, status.triggerRight), 0, nullptr},
+      {"AnalogA", T_UBYTE, offsetof(PyGCPadState, status.analogA), 0, nullptr},
+      {"AnalogB", T_UBYTE, offsetof(PyGCPadState, status.analogB), 0, nullptr},
+      {"Connected", T_BOOL, offsetof(PyGCPadState, status.isConnected), 0, nullptr},
+      {nullptr, 0, 0, 0, nullptr}  // Sentinel
+  };
+  static PyType_Slot slots[] = {
+      {Py_tp_new, reinterpret_cast<void*>(GCPadStateNew)},
+      {Py_tp_dealloc, reinterpret_cast<void*>(GCPadStateDealloc)},
+      {Py_tp_getset, getset},
+      {Py_tp_members, members},
+      {0, nullptr}  // Sentinel
+  };
+  static PyType_Spec spec = {
+      "dolphin_controller.GCPadState",
+      sizeof(PyGCPadState),
+      0,
+      Py_TPFLAGS_DEFAULT,
+      slots,
+  };
+  return Py::AddTypeToModule(module, &spec);
+}
+
+static PyObject* WiiButtonsStateNew(PyTypeObject* type, PyObject* args, PyObject* kwargs)
+{
+  if (PyTuple_GET_SIZE(args) != 0)
+  {
+    PyErr_SetString(PyExc_TypeError, "WiiButtonsState only takes keyword arguments");
+    return nullptr;
+  }
+  WiimoteCommon::ButtonData data{};
+  if (kwargs != nullptr)
+    data = WiiButtonDataFromPyDict(kwargs);
+  PyWiiButtonsState* self = reinterpret_cast<PyWiiButtonsState*>(type->tp_alloc(type, 0));
+  if (self == nullptr)
+    return nullptr;
+  self->data = data;
+  return reinterpret_cast<PyObject*>(self);
+}
+
+static void WiiButtonsStateDealloc(PyObject* self)
+{
+  PyTypeObject* type = Py_TYPE(self);
+  type->tp_free(self);
+  Py_DECREF(type);
+}
+
+static PyObject* WiiButtonsStateGetButton(PyObject* self, void* closure)
+{
+  return GetButton(reinterpret_cast<PyWiiButtonsState*>(self)->data.hex, closure);
+}
+
+static int WiiButtonsStateSetButton(PyObject* self, PyObject* value, void* closure)
+{
+  return SetButton(&reinterpret_cast<PyWiiButtonsState*>(self)->data.hex, value, closure);
+}
+
+static PyTypeObject* CreateWiiButtonsStateType(PyObject* module)
+{
+  using WiimoteEmu::Wiimote;
+  static PyGetSetDef getset[] = {
+      {"Left", WiiButtonsStateGetButton, WiiButtonsStateSetButton, nullptr,
+       ButtonMaskToClosure(Wiimote::PAD_LEFT)},
+      {"Right", WiiButtonsStateGetButton, WiiButtonsStateSetButton, nullptr,
+       ButtonMaskToClosure(Wiimote::PAD_RIGHT)},
+      {"Down", WiiButtonsStateGetButton, WiiButtonsStateSetButton, nullptr,
+       ButtonMaskToClosure(Wiimote::PAD_DOWN)},
+      {"Up", WiiButtonsStateGetButton, WiiButtonsStateSetButton, nullptr,
+       ButtonMaskToClosure(Wiimote::PAD_UP)},
+      {"Plus", WiiButtonsStateGetButton, WiiButtonsStateSetButton, nullptr,
+       ButtonMaskToClosure(Wiimote::BUTTON_PLUS)},
+      {"Two", WiiButtonsStateGetButton, WiiButtonsStateSetButton, nullptr,
+       ButtonMaskToClosure(Wiimote::BUTTON_TWO)},
+      {"One", WiiButtonsStateGetButton, WiiButtonsStateSetButton, nullptr,
+       ButtonMaskToClosure(Wiimote::BUTTON_ONE)},
+      {"B", WiiButtonsStateGetButton, WiiButtonsStateSetButton, nullptr,
+       ButtonMaskToClosure(Wiimote::BUTTON_B)},
+      {"A", WiiButtonsStateGetButton, WiiButtonsStateSetButton, nullptr,
+       ButtonMaskToClosure(Wiimote::BUTTON_A)},
+      {"Minus", WiiButtonsStateGetButton, WiiButtonsStateSetButton, nullptr,
+       ButtonMaskToClosure(Wiimote::BUTTON_MINUS)},
+      {"Home", WiiButtonsStateGetButton, WiiButtonsStateSetButton, nullptr,
+       ButtonMaskToClosure(Wiimote::BUTTON_HOME)},
+      {nullptr, nullptr, nullptr, nullptr, nullptr}  // Sentinel
+  };
+  static PyMemberDef members[] = {
+      {"Buttons", T_USHORT, offsetof(PyWiiButtonsState, data.hex), 0, nullptr},
+      {nullptr, 0, 0, 0, nullptr}  // Sentinel
+  };
+  static PyType_Slot slots[] = {
+      {Py_tp_new, reinterpret_cast<void*>(WiiButtonsStateNew)},
+      {Py_tp_dealloc, reinterpret_cast<void*>(WiiButtonsStateDealloc)},
+      {Py_tp_getset, getset},
+      {Py_tp_members, members},
+      {0, nullptr}  // Sentinel
+  };
+  static PyType_Spec spec = {
+      "dolphin_controller.WiiButtonsState",
+      sizeof(PyWiiButtonsState),
+      0,
+      Py_TPFLAGS_DEFAULT,
+      slots,
+  };
+  return Py::AddTypeToModule(module, &spec);
+}
+
+// Converts either a GCPadState or an input dict.
+// Returns an empty optional with a python exception set on failure.
+static std::optional<GCPadStatus> GCPadStatusFromPy(const ControllerModuleState* state,
+                                                    PyObject* obj)
+{
+  if (Py_IS_TYPE(obj, state->gc_pad_state_type))
+    return reinterpret_cast<PyGCPadState*>(obj)->status;
+  if (!PyDict_Check(obj))
+  {
+    PyErr_SetString(PyExc_TypeError, "inputs must be a GCPadState or a dict");
+    return std::nullopt;
+  }
+  const GCPadStatus status = GCPadStatusFromPyDict(obj);
+  if (PyErr_Occurred())
+    return std::nullopt;
+  return status;
+}
+
+// Converts either a WiiButtonsState or an input dict.
+// Returns an empty optional with a python exception set on failure.
+static std::optional<WiimoteCommon::ButtonData>
+WiiButtonDataFromPy(const ControllerModuleState* state, PyObject* obj)
+{
+  if (Py_IS_TYPE(obj, state->wii_buttons_state_type))
+    return reinterpret_cast<PyWiiButtonsState*>(obj)->data;
+  if (!PyDict_Check(obj))
+  {
+    PyErr_SetString(PyExc_TypeError, "inputs must be a WiiButtonsState or a dict");
+    return std::nullopt;
+  }
+  return WiiButtonDataFromPyDict(obj);
+}
+
 static PyObject* NunchuckButtonDataToPyDict(WiimoteEmu::Nunchuk::DataFormat status)
 {
   return Py_BuildValue("{s:O,s:O,s:B,s:B}", "C",
@@ -185,6 +452,89 @@ static WiimoteEmu::Nunchuk::DataFormat NunchuckButtonDataFromPyDict(PyObject* di
   return status;
 }
 
+// Packed timeline records as accepted by the set_*_timeline functions,
+// described in python's struct module syntax.
+static constexpr char GC_TIMELINE_FORMAT[] = "<H8B?x";
+static constexpr size_t GC_TIMELINE_RECORD_SIZE = 12;
+static constexpr char WII_BUTTONS_TIMELINE_FORMAT[] = "<H";
+static constexpr size_t WII_BUTTONS_TIMELINE_RECORD_SIZE = 2;
+
+static GCPadStatus GCPadStatusFromRecord(const u8* record)
+{
+  GCPadStatus status;
+  status.button = record[0] | record[1] << 8;
+  status.stickX = record[2];
+  status.stickY = record[3];
+  status.substickX = record[4];
+  status.substickY = record[5];
+  status.triggerLeft = record[6];
+  status.triggerRight = record[7];
+  status.analogA = record[8];
+  status.analogB = record[9];
+  status.isConnected = record[10] != 0;
+  return status;
+}
+
+static WiimoteCommon::ButtonData WiiButtonDataFromRecord(const u8* record)
+{
+  WiimoteCommon::ButtonData status;
+  status.hex = (record[0] | record[1] << 8) & WiimoteCommon::ButtonData::BUTTON_MASK;
+  return status;
+}
+
+// Parses timeline inputs, which are either a bytes-like object of packed records
+// or an iterable of the same input objects or dicts the set_* functions take.
+// Returns an empty optional with a python exception set on failure.
+template <typename TInput, size_t RecordSize>
+static std::optional<std::vector<TInput>> ParseTimeline(
+    const ControllerModuleState* state, PyObject* inputs, TInput (*from_record)(const u8*),
+    std::optional<TInput> (*from_object)(const ControllerModuleState*, PyObject*))
+{
+  std::vector<TInput> timeline;
+  if (PyObject_CheckBuffer(inputs))
+  {
+    Py_buffer buffer;
+    if (PyObject_GetBuffer(inputs, &buffer, PyBUF_C_CONTIGUOUS) < 0)
+      return std::nullopt;
+    if (buffer.len % RecordSize != 0)
+    {
+      PyErr_Format(PyExc_ValueError, "timeline buffer size must be a multiple of %zu bytes",
+                   RecordSize);
+      PyBuffer_Release(&buffer);
+      return std::nullopt;
+    }
+    const u8* records = static_cast<const u8*>(buffer.buf);
+    timeline.reserve(buffer.len / RecordSize);
+    for (Py_ssize_t offset = 0; offset < buffer.len; offset += RecordSize)
+      timeline.push_back(from_record(records + offset));
+    PyBuffer_Release(&buffer);
+    return timeline;
+  }
+
+  Py::Object seq =
+      Py::Wrap(PySequence_Fast(inputs, "inputs must be a buffer or an iterable of inputs"));
+  if (seq.IsNull())
+    return std::nullopt;
+  const Py_ssize_t num_inputs = PySequence_Fast_GET_SIZE(seq.Lend());
+  PyObject** items = PySequence_Fast_ITEMS(seq.Lend());
+  timeline.reserve(num_inputs);
+  for (Py_ssize_t i = 0; i < num_inputs; i++)
+  {
+    std::optional<TInput> input = from_object(state, items[i]);
+    if (!input.has_value())
+      return std::nullopt;
+    timeline.push_back(input.value());
+  }
+  return timeline;
+}
+
+static PyObject* TimelinePositionToPy(std::optional<size_t> position)
+{
+  if (!position.has_value())
+    Py_RETURN_NONE;
+  return PyLong_FromSize_t(position.value());
+}
+
 static PyObject* get_gc_buttons(PyObject* module, PyObject* args)
 {
   auto controller_id_opt = Py::ParseTuple<int>(args);
@@ -199,15 +549,119 @@ static PyObject* get_gc_buttons(PyObject* module, PyObject* args)
 static PyObject* set_gc_buttons(PyObject* module, PyObject* args)
 {
   int controller_id;
-  PyObject* dict;
-  if (!PyArg_ParseTuple(args, "iO!", &controller_id, &PyDict_Type, &dict))
+  PyObject* inputs;
+  if (!PyArg_ParseTuple(args, "iO", &controller_id, &inputs))
     return nullptr;
-  GCPadStatus status = GCPadStatusFromPyDict(dict);
   ControllerModuleState* state = Py::GetState<ControllerModuleState>(module);
-  state->gc_manip->Set(status, controller_id, API::ClearOn::NextFrame);
+  std::optional<GCPadStatus> status = GCPadStatusFromPy(state, inputs);
+  if (!status.has_value())
+    return nullptr;
+  state->gc_manip->Set(status.value(), controller_id, API::ClearOn::NextFrame, state);
+  Py_RETURN_NONE;
+}
+
+// Parses a controller id from a METH_FASTCALL argument.
+static bool ControllerIdFromPy(PyObject* obj, int* controller_id)
+{
+  const long value = PyLong_AsLong(obj);
+  if (value == -1 && PyErr_Occurred())
+    return false;
+  *controller_id = static_cast<int>(value);
+  return true;
+}
+
+static bool CheckNumArgs(const char* func_name, Py_ssize_t nargs, Py_ssize_t min, Py_ssize_t max)
+{
+  if (nargs >= min && nargs <= max)
+    return true;
+  PyErr_Format(PyExc_TypeError, "%s() takes %zd to %zd positional arguments but %zd were given",
+               func_name, min, max, nargs);
+  return false;
+}
+
+// Returns `out` filled with the given input if it's an instance of `type`,
+// or a new instance of `type` otherwise. `TState` is the input object's struct.
+template <typename TState>
+static TState* GetOrCreateInputObject(PyTypeObject* type, PyObject* out)
+{
+  if (out != nullptr && out != Py_None)
+  {
+    if (!Py_IS_TYPE(out, type))
+    {
+      PyErr_Format(PyExc_TypeError, "out must be a %s", type->tp_name);
+      return nullptr;
+    }
+    Py_INCREF(out);
+    return reinterpret_cast<TState*>(out);
+  }
+  return reinterpret_cast<TState*>(type->tp_alloc(type, 0));
+}
+
+static PyObject* get_gc_state(PyObject* module, PyObject* const* args, Py_ssize_t nargs)
+{
+  int controller_id;
+  if (!CheckNumArgs("get_gc_state", nargs, 1, 2) || !ControllerIdFromPy(args[0], &controller_id))
+    return nullptr;
+  ControllerModuleState* state = Py::GetState<ControllerModuleState>(module);
+  PyGCPadState* result = GetOrCreateInputObject<PyGCPadState>(state->gc_pad_state_type,
+                                                               nargs > 1 ? args[1] : nullptr);
+  if (result == nullptr)
+    return nullptr;
+  result->status = state->gc_manip->Get(controller_id);
+  return reinterpret_cast<PyObject*>(result);
+}
+
+static PyObject* set_gc_state(PyObject* module, PyObject* const* args, Py_ssize_t nargs)
+{
+  int controller_id;
+  if (!CheckNumArgs("set_gc_state", nargs, 2, 2) || !ControllerIdFromPy(args[0], &controller_id))
+    return nullptr;
+  ControllerModuleState* state = Py::GetState<ControllerModuleState>(module);
+  std::optional<GCPadStatus> status = GCPadStatusFromPy(state, args[1]);
+  if (!status.has_value())
+    return nullptr;
+  state->gc_manip->Set(status.value(), controller_id, API::ClearOn::NextFrame, state);
   Py_RETURN_NONE;
 }
 
+static PyObject* set_gc_timeline(PyObject* module, PyObject* args)
+{
+  int controller_id;
+  PyObject* inputs;
+  if (!PyArg_ParseTuple(args, "iO", &controller_id, &inputs))
+    return nullptr;
+  ControllerModuleState* state = Py::GetState<ControllerModuleState>(module);
+  std::optional<std::vector<GCPadStatus>> timeline =
+      ParseTimeline<GCPadStatus, GC_TIMELINE_RECORD_SIZE>(state, inputs, GCPadStatusFromRecord,
+                                                          GCPadStatusFromPy);
+  if (!timeline.has_value())
+    return nullptr;
+  const size_t num_frames = timeline->size();
+  state->gc_manip->GetTimelines().Set(controller_id, std::move(timeline.value()), state);
+  return PyLong_FromSize_t(num_frames);
+}
+
+static PyObject* clear_gc_timeline(PyObject* module, PyObject* args)
+{
+  auto controller_id_opt = Py::ParseTuple<int>(args);
+  if (!controller_id_opt.has_value())
+    return nullptr;
+  int controller_id = std::get<0>(controller_id_opt.value());
+  ControllerModuleState* state = Py::GetState<ControllerModuleState>(module);
+  state->gc_manip->GetTimelines().Clear(controller_id);
+  Py_RETURN_NONE;
+}
+
+static PyObject* get_gc_timeline_position(PyObject* module, PyObject* args)
+{
+  auto controller_id_opt = Py::ParseTuple<int>(args);
+  if (!controller_id_opt.has_value())
+    return nullptr;
+  int controller_id = std::get<0>(controller_id_opt.value());
+  ControllerModuleState* state = Py::GetState<ControllerModuleState>(module);
+  return TimelinePositionToPy(state->gc_manip->GetTimelines().GetPosition(controller_id));
+}
+
 static PyObject* get_wii_buttons(PyObject* module, PyObject* args)
 {
   auto controller_id_opt = Py::ParseTuple<int>(args);
@@ -222,15 +676,84 @@ static PyObject* get_wii_buttons(PyObject* module, PyObject* args)
 static PyObject* set_wii_buttons(PyObject* module, PyObject* args)
 {
   int controller_id;
-  PyObject* dict;
-  if (!PyArg_ParseTuple(args, "iO!", &controller_id, &PyDict_Type, &dict))
+  PyObject* inputs;
+  if (!PyArg_ParseTuple(args, "iO", &controller_id, &inputs))
     return nullptr;
-  WiimoteCommon::ButtonData status = WiiButtonDataFromPyDict(dict);
   ControllerModuleState* state = Py::GetState<ControllerModuleState>(module);
-  state->wii_buttons_manip->Set(status, controller_id, API::ClearOn::NextFrame);
+  std::optional<WiimoteCommon::ButtonData> status = WiiButtonDataFromPy(state, inputs);
+  if (!status.has_value())
+    return nullptr;
+  state->wii_buttons_manip->Set(status.value(), controller_id, API::ClearOn::NextFrame, state);
   Py_RETURN_NONE;
 }
 
+static PyObject* get_wii_buttons_state(PyObject* module, PyObject* const* args, Py_ssize_t nargs)
+{
+  int controller_id;
+  if (!CheckNumArgs("get_wii_buttons_state", nargs, 1, 2) ||
+      !ControllerIdFromPy(args[0], &controller_id))
+    return nullptr;
+  ControllerModuleState* state = Py::GetState<ControllerModuleState>(module);
+  PyWiiButtonsState* result = GetOrCreateInputObject<PyWiiButtonsState>(
+      state->wii_buttons_state_type, nargs > 1 ? args[1] : nullptr);
+  if (result == nullptr)
+    return nullptr;
+  result->data = state->wii_buttons_manip->Get(controller_id);
+  return reinterpret_cast<PyObject*>(result);
+}
+
+static PyObject* set_wii_buttons_state(PyObject* module, PyObject* const* args, Py_ssize_t nargs)
+{
+  int controller_id;
+  if (!CheckNumArgs("set_wii_buttons_state", nargs, 2, 2) ||
+      !ControllerIdFromPy(args[0], &controller_id))
+    return nullptr;
+  ControllerModuleState* state = Py::GetState<ControllerModuleState>(module);
+  std::optional<WiimoteCommon::ButtonData> status = WiiButtonDataFromPy(state, args[1]);
+  if (!status.has_value())
+    return nullptr;
+  state->wii_buttons_manip->Set(status.value(), controller_id, API::ClearOn::NextFrame, state);
+  Py_RETURN_NONE;
+}
+
+static PyObject* set_wii_buttons_timeline(PyObject* module, PyObject* args)
+{
+  int controller_id;
+  PyObject* inputs;
+  if (!PyArg_ParseTuple(args, "iO", &controller_id, &inputs))
+    return nullptr;
+  ControllerModuleState* state = Py::GetState<ControllerModuleState>(module);
+  std::optional<std::vector<WiimoteCommon::ButtonData>> timeline =
+      ParseTimeline<WiimoteCommon::ButtonData, WII_BUTTONS_TIMELINE_RECORD_SIZE>(
+          state, inputs, WiiButtonDataFromRecord, WiiButtonDataFromPy);
+  if (!timeline.has_value())
+    return nullptr;
+  const size_t num_frames = timeline->size();
+  state->wii_buttons_manip->GetTimelines().Set(controller_id, std::move(timeline.value()), state);
+  return PyLong_FromSize_t(num_frames);
+}
+
+static PyObject* clear_wii_buttons_timeline(PyObject* module, PyObject* args)
+{
+  auto controller_id_opt = Py::ParseTuple<int>(args);
+  if (!controller_id_opt.has_value())
+    return nullptr;
+  int controller_id = std::get<0>(controller_id_opt.value());
+  ControllerModuleState* state = Py::GetState<ControllerModuleState>(module);
+  state->wii_buttons_manip->GetTimelines().Clear(controller_id);
+  Py_RETURN_NONE;
+}
+
+static PyObject* get_wii_buttons_timeline_position(PyObject* module, PyObject* args)
+{
+  auto controller_id_opt = Py::ParseTuple<int>(args);
+  if (!controller_id_opt.has_value())
+    return nullptr;
+  int controller_id = std::get<0>(controller_id_opt.value());
+  ControllerModuleState* state = Py::GetState<ControllerModuleState>(module);
+  return TimelinePositionToPy(state->wii_buttons_manip->GetTimelines().GetPosition(controller_id));
+}
+
 static PyObject* set_wii_ircamera_transform(PyObject* module, PyObject* args)
 {
   int controller_id;
@@ -241,7 +764,8 @@ static PyObject* set_wii_ircamera_transform(PyObject* module, PyObject* args)
     return nullptr;
   const ControllerModuleState* state = Py::GetState<ControllerModuleState>(module);
 
-  state->wii_ir_manip->Set({{x, y, z}, {pitch, yaw, roll}}, controller_id, API::ClearOn::NextFrame);
+  state->wii_ir_manip->Set({{x, y, z}, {pitch, yaw, roll}}, controller_id, API::ClearOn::NextFrame,
+                           state);
   Py_RETURN_NONE;
 }
 
@@ -264,7 +788,7 @@ static PyObject* set_nunchuck_buttons(PyObject* module, PyObject* args)
     return nullptr;
   WiimoteEmu::Nunchuk::DataFormat status = NunchuckButtonDataFromPyDict(dict);
   ControllerModuleState* state = Py::GetState<ControllerModuleState>(module);
-  state->nunchuck_buttons_manip->Set(status, controller_id, API::ClearOn::NextFrame);
+  state->nunchuck_buttons_manip->Set(status, controller_id, API::ClearOn::NextFrame, state);
   Py_RETURN_NONE;
 }
 
@@ -274,11 +798,17 @@ static void setup_controller_module(PyObject* module, ControllerModuleState* sta
   state->wii_buttons_manip = PyScriptingBackend::GetCurrent()->GetWiiButtonsManip();
   state->wii_ir_manip = PyScriptingBackend::GetCurrent()->GetWiiIRManip();
   state->nunchuck_buttons_manip = PyScriptingBackend::GetCurrent()->GetNunchuckButtonsManip();
+  state->gc_pad_state_type = CreateGCPadStateType(module);
+  state->wii_buttons_state_type = CreateWiiButtonsStateType(module);
+  PyModule_AddStringConstant(module, "GC_TIMELINE_FORMAT", GC_TIMELINE_FORMAT);
+  PyModule_AddStringConstant(module, "WII_BUTTONS_TIMELINE_FORMAT", WII_BUTTONS_TIMELINE_FORMAT);
+  // Workers share the manips with the script that started them, so each script only removes
+  // the inputs it set itself.
   PyScriptingBackend::GetCurrent()->AddCleanupFunc([state] {
-    state->gc_manip->Clear();
-    state->wii_buttons_manip->Clear();
-    state->wii_ir_manip->Clear();
-    state->nunchuck_buttons_manip->Clear();
+    state->gc_manip->ClearOwnedBy(state);
+    state->wii_buttons_manip->ClearOwnedBy(state);
+    state->wii_ir_manip->ClearOwnedBy(state);
+    state->nunchuck_buttons_manip->ClearOwnedBy(state);
   });
 }
 
@@ -287,8 +817,20 @@ PyMODINIT_FUNC PyInit_controller()
   static PyMethodDef method_defs[] = {
       {"get_gc_buttons", get_gc_buttons, METH_VARARGS, ""},
       {"set_gc_buttons", set_gc_buttons, METH_VARARGS, ""},
+      {"get_gc_state", reinterpret_cast<PyCFunction>(get_gc_state), METH_FASTCALL, ""},
+      {"set_gc_state", reinterpret_cast<PyCFunction>(set_gc_state), METH_FASTCALL, ""},
+      {"set_gc_timeline", set_gc_timeline, METH_VARARGS, ""},
+      {"clear_gc_timeline", clear_gc_timeline, METH_VARARGS, ""},
+      {"get_gc_timeline_position", get_gc_timeline_position, METH_VARARGS, ""},
       {"get_wii_buttons", get_wii_buttons, METH_VARARGS, ""},
       {"set_wii_buttons", set_wii_buttons, METH_VARARGS, ""},
+      {"get_wii_buttons_state", reinterpret_cast<PyCFunction>(get_wii_buttons_state),
+       METH_FASTCALL, ""},
+      {"set_wii_buttons_state", reinterpret_cast<PyCFunction>(set_wii_buttons_state),
+       METH_FASTCALL, ""},
+      {"set_wii_buttons_timeline", set_wii_buttons_timeline, METH_VARARGS, ""},
+      {"clear_wii_buttons_timeline", clear_wii_buttons_timeline, METH_VARARGS, ""},
+      {"get_wii_buttons_timeline_position", get_wii_buttons_timeline_position, METH_VARARGS, ""},
       {"set_wii_ircamera_transform", set_wii_ircamera_transform, METH_VARARGS, ""},
       {"get_nunchuck_buttons", get_nunchuck_buttons, METH_VARARGS, ""},
       {"set_nunchuck_buttons", set_nunchuck_buttons, METH_VARARGS, ""},
@@ -6,8 +6,14 @@
 
 #include <Python.h>
 
+#include <cstddef>
+#include <new>
+#include <string>
+
 #include "Common/Logging/Log.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
+#include "Core/Debugger/CallTracer.h"
 #include "Core/PowerPC/BreakPoints.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
@@ -128,6 +134,77 @@ static PyObject* RemoveMemoryBreakpoint(PyObject* self, PyObject* args)
   Py_RETURN_NONE;
 }
 
+static PyObject* StartCallTrace(PyObject* self, PyObject* args)
+{
+  Py_ssize_t capacity = Core::CallTracer::DEFAULT_CAPACITY;
+  if (!PyArg_ParseTuple(args, "|n", &capacity))
+    return nullptr;
+  if (capacity <= 0 || static_cast<std::size_t>(capacity) > Core::CallTracer::MAX_CAPACITY)
+  {
+    PyErr_Format(PyExc_ValueError, "capacity must be between 1 and %zu",
+                 Core::CallTracer::MAX_CAPACITY);
+    return nullptr;
+  }
+
+  if (Config::Get(Config::MAIN_CPU_CORE) != PowerPC::CPUCore::Interpreter &&
+      !Config::Get(Config::MAIN_ENABLE_DEBUGGING))
+  {
+    WARN_LOG_FMT(SCRIPTING, "The JIT only traces calls while debugging is enabled.");
+  }
+
+  auto& system = Core::System::GetInstance();
+  Core::CPUThreadGuard guard(system);
+  // Exceptions must not cross the C API.
+  try
+  {
+    system.GetPowerPC().GetCallTracer().Start(guard, static_cast<std::size_t>(capacity));
+  }
+  catch (const std::bad_alloc&)
+  {
+    return PyErr_NoMemory();
+  }
+
+  Py_RETURN_NONE;
+}
+
+static PyObject* StopCallTrace(PyObject* self, PyObject* args)
+{
+  auto& system = Core::System::GetInstance();
+  Core::CPUThreadGuard guard(system);
+  system.GetPowerPC().GetCallTracer().Stop(guard);
+
+  Py_RETURN_NONE;
+}
+
+static PyObject* ExportCallTrace(PyObject* self, PyObject* args)
+{
+  auto args_opt = Py::ParseTuple<const char*>(args);
+  if (!args_opt.has_value())
+    return nullptr;
+  const std::string path = std::get<0>(args_opt.value());
+
+  // Only copying the trace pauses the emulation, not formatting and writing it.
+  Core::CallTraceSnapshot snapshot;
+  {
+    auto& system = Core::System::GetInstance();
+    Core::CPUThreadGuard guard(system);
+    auto& power_pc = system.GetPowerPC();
+    snapshot = power_pc.GetCallTracer().TakeSnapshot(guard, power_pc.GetSymbolDB());
+  }
+
+  bool success;
+  Py_BEGIN_ALLOW_THREADS
+  success = Core::CallTracer::ExportChromeTrace(snapshot, path);
+  Py_END_ALLOW_THREADS
+  if (!success)
+  {
+    PyErr_SetString(PyExc_OSError, ("could not write " + path).c_str());
+    return nullptr;
+  }
+
+  Py_RETURN_NONE;
+}
+
 static void SetupDebugModule(PyObject* module, DebugModuleState* state)
 {
 }
@@ -139,6 +216,9 @@ PyMODINIT_FUNC PyInit_debug()
       {"remove_breakpoint", RemoveBreakpoint, METH_VARARGS, ""},
       {"set_memory_breakpoint", SetMemoryBreakpoint, METH_VARARGS, ""},
       {"remove_memory_breakpoint", RemoveMemoryBreakpoint, METH_VARARGS, ""},
+      {"start_call_trace", StartCallTrace, METH_VARARGS, ""},
+      {"stop_call_trace", StopCallTrace, METH_NOARGS, ""},
+      {"export_call_trace", ExportCallTrace, METH_VARARGS, ""},
 
       {nullptr, nullptr, 0, nullptr}  // Sentinel
   };
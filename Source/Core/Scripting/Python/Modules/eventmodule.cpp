@@ -4,18 +4,32 @@
 
 #include "eventmodule.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <deque>
 #include <functional>
+#include <limits>
 #include <map>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include "Common/Logging/Log.h"
 #include "Core/API/Events.h"
+#include "Core/API/Memory.h"
+#include "Core/Core.h"
 #include "Core/HW/ProcessorInterface.h"
 #include "Core/Movie.h"
 #include "Core/System.h"
 
 #include "Scripting/Python/coroutine.h"
 #include "Scripting/Python/Utils/convert.h"
+#include "Scripting/Python/Utils/image_view.h"
 #include "Scripting/Python/Utils/invoke.h"
 #include "Scripting/Python/Utils/module.h"
 #include "Scripting/Python/Utils/object_wrapper.h"
@@ -27,21 +41,451 @@ namespace PyScripting
 // If you are looking for where the actual events are defined,
 // scroll to the bottom of this file.
 
-// We just want one Py::Object and one std::deque per event,
-// but unpacking the template parameters seem to require them to be used.
-// So let's just wrap them in a custom templated struct without actually using T.
+// Callbacks for code or memory breakpoints registered for a single address or an address range.
+// Breakpoint-heavy scripts typically only care about a few of the hit addresses,
+// so the lookup is done natively and the GIL is only taken for matching hits.
+// HasMatch gets called from the emulation thread without holding the GIL,
+// which is why the lookup tables are guarded by their own mutex.
+class AddressCallbacks
+{
+public:
+  bool HasMatch(u32 addr) const
+  {
+    if (m_num_callbacks.load(std::memory_order_acquire) == 0)
+      return false;
+    std::lock_guard lock{m_mutex};
+    if (m_single_callbacks.find(addr) != m_single_callbacks.end())
+      return true;
+    for (const RangeCallback& range : m_range_callbacks)
+    {
+      if (addr >= range.start && addr <= range.end)
+        return true;
+    }
+    return false;
+  }
+
+  // Requires the GIL, because the returned callbacks get their reference counts increased.
+  std::vector<Py::Object> GetMatches(u32 addr) const
+  {
+    std::vector<Py::Object> matches;
+    std::lock_guard lock{m_mutex};
+    if (auto it = m_single_callbacks.find(addr); it != m_single_callbacks.end())
+      matches.push_back(it->second);
+    for (const RangeCallback& range : m_range_callbacks)
+    {
+      if (addr >= range.start && addr <= range.end)
+        matches.push_back(range.callback);
+    }
+    return matches;
+  }
+
+  bool IsEmpty() const { return m_num_callbacks.load(std::memory_order_acquire) == 0; }
+
+  // Sets the callback for the inclusive range [start, end], or removes it if callback is null.
+  // Requires the GIL.
+  void Set(u32 start, u32 end, Py::Object callback)
+  {
+    std::lock_guard lock{m_mutex};
+    if (start == end)
+    {
+      if (callback.IsNull())
+        m_single_callbacks.erase(start);
+      else
+        m_single_callbacks[start] = std::move(callback);
+    }
+    else
+    {
+      auto it = std::find_if(m_range_callbacks.begin(), m_range_callbacks.end(),
+                             [&](const RangeCallback& range) {
+                               return range.start == start && range.end == end;
+                             });
+      if (callback.IsNull())
+      {
+        if (it != m_range_callbacks.end())
+          m_range_callbacks.erase(it);
+      }
+      else if (it != m_range_callbacks.end())
+      {
+        it->callback = std::move(callback);
+      }
+      else
+      {
+        m_range_callbacks.push_back({start, end, std::move(callback)});
+      }
+    }
+    m_num_callbacks.store(m_single_callbacks.size() + m_range_callbacks.size(),
+                          std::memory_order_release);
+  }
+
+  // Requires the GIL.
+  void Clear()
+  {
+    std::lock_guard lock{m_mutex};
+    m_single_callbacks.clear();
+    m_range_callbacks.clear();
+    m_num_callbacks.store(0, std::memory_order_release);
+  }
+
+private:
+  struct RangeCallback
+  {
+    u32 start;
+    u32 end;
+    Py::Object callback;
+  };
+
+  mutable std::mutex m_mutex;
+  std::unordered_map<u32, Py::Object> m_single_callbacks;
+  std::vector<RangeCallback> m_range_callbacks;
+  std::atomic<size_t> m_num_callbacks = 0;
+};
+
+enum class ConditionValueType
+{
+  U8, U16, U32, U64, S8, S16, S32, S64, F32, F64
+};
+static constexpr std::array<std::pair<std::string_view, ConditionValueType>, 10>
+    s_condition_value_types = {{
+        {"u8", ConditionValueType::U8},
+        {"u16", ConditionValueType::U16},
+        {"u32", ConditionValueType::U32},
+        {"u64", ConditionValueType::U64},
+        {"s8", ConditionValueType::S8},
+        {"s16", ConditionValueType::S16},
+        {"s32", ConditionValueType::S32},
+        {"s64", ConditionValueType::S64},
+        {"f32", ConditionValueType::F32},
+        {"f64", ConditionValueType::F64},
+    }};
+
+enum class ConditionOp
+{
+  Equal, NotEqual, Less, LessEqual, Greater, GreaterEqual, BitsSet
+};
+static constexpr std::array<std::pair<std::string_view, ConditionOp>, 7> s_condition_ops = {{
+    {"==", ConditionOp::Equal},
+    {"!=", ConditionOp::NotEqual},
+    {"<", ConditionOp::Less},
+    {"<=", ConditionOp::LessEqual},
+    {">", ConditionOp::Greater},
+    {">=", ConditionOp::GreaterEqual},
+    {"&", ConditionOp::BitsSet},
+}};
+
+// A value read from memory, widened to the largest type of its kind.
+struct ConditionValue
+{
+  enum class Kind
+  {
+    Unsigned, Signed, Float
+  };
+  Kind kind;
+  u64 u = 0;
+  s64 s = 0;
+  double f = 0;
+
+  PyObject* ToPyObject() const
+  {
+    switch (kind)
+    {
+    case Kind::Unsigned:
+      return PyLong_FromUnsignedLongLong(u);
+    case Kind::Signed:
+      return PyLong_FromLongLong(s);
+    default:
+      return PyFloat_FromDouble(f);
+    }
+  }
+};
+
+static ConditionValue::Kind GetConditionValueKind(ConditionValueType type)
+{
+  switch (type)
+  {
+  case ConditionValueType::U8:
+  case ConditionValueType::U16:
+  case ConditionValueType::U32:
+  case ConditionValueType::U64:
+    return ConditionValue::Kind::Unsigned;
+  case ConditionValueType::S8:
+  case ConditionValueType::S16:
+  case ConditionValueType::S32:
+  case ConditionValueType::S64:
+    return ConditionValue::Kind::Signed;
+  default:
+    return ConditionValue::Kind::Float;
+  }
+}
+
+static ConditionValue ReadConditionValue(const Core::CPUThreadGuard& guard, u32 addr,
+                                         ConditionValueType type)
+{
+  ConditionValue value{GetConditionValueKind(type)};
+  switch (type)
+  {
+  case ConditionValueType::U8:
+    value.u = API::Memory::Read_U8(guard, addr);
+    break;
+  case ConditionValueType::U16:
+    value.u = API::Memory::Read_U16(guard, addr);
+    break;
+  case ConditionValueType::U32:
+    value.u = API::Memory::Read_U32(guard, addr);
+    break;
+  case ConditionValueType::U64:
+    value.u = API::Memory::Read_U64(guard, addr);
+    break;
+  case ConditionValueType::S8:
+    value.s = API::Memory::Read_S8(guard, addr);
+    break;
+  case ConditionValueType::S16:
+    value.s = API::Memory::Read_S16(guard, addr);
+    break;
+  case ConditionValueType::S32:
+    value.s = API::Memory::Read_S32(guard, addr);
+    break;
+  case ConditionValueType::S64:
+    value.s = API::Memory::Read_S64(guard, addr);
+    break;
+  case ConditionValueType::F32:
+    value.f = API::Memory::Read_F32(guard, addr);
+    break;
+  case ConditionValueType::F64:
+    value.f = API::Memory::Read_F64(guard, addr);
+    break;
+  }
+  return value;
+}
+
+template <typename T>
+static bool CompareConditionValues(T lhs, ConditionOp op, T rhs)
+{
+  switch (op)
+  {
+  case ConditionOp::Equal:
+    return lhs == rhs;
+  case ConditionOp::NotEqual:
+    return lhs != rhs;
+  case ConditionOp::Less:
+    return lhs < rhs;
+  case ConditionOp::LessEqual:
+    return lhs <= rhs;
+  case ConditionOp::Greater:
+    return lhs > rhs;
+  case ConditionOp::GreaterEqual:
+    return lhs >= rhs;
+  case ConditionOp::BitsSet:
+    if constexpr (std::is_integral_v<T>)
+      return (lhs & rhs) != 0;
+    else
+      return false;
+  }
+  return false;
+}
+
+// A memory condition awaited with `await until(address, type, op, value)`.
+struct MemoryCondition
+{
+  u32 addr;
+  ConditionValueType type;
+  ConditionOp op;
+  ConditionValue operand;
+
+  // Sets the python error and returns nullopt if the arguments are invalid.
+  static std::optional<MemoryCondition> FromArgs(PyObject* args)
+  {
+    u32 addr;
+    const char* type_name;
+    const char* op_name;
+    PyObject* operand_obj;
+    if (!PyArg_ParseTuple(args, "IssO", &addr, &type_name, &op_name, &operand_obj))
+      return std::nullopt;
+
+    const auto type_it = std::find_if(s_condition_value_types.begin(), s_condition_value_types.end(),
+                                      [&](const auto& pair) { return pair.first == type_name; });
+    if (type_it == s_condition_value_types.end())
+    {
+      PyErr_Format(PyExc_ValueError, "unknown type '%s', expected e.g. 'u32', 's16' or 'f32'",
+                   type_name);
+      return std::nullopt;
+    }
+    const auto op_it = std::find_if(s_condition_ops.begin(), s_condition_ops.end(),
+                                    [&](const auto& pair) { return pair.first == op_name; });
+    if (op_it == s_condition_ops.end())
+    {
+      PyErr_Format(PyExc_ValueError,
+                   "unknown operator '%s', expected one of ==, !=, <, <=, >, >= or &", op_name);
+      return std::nullopt;
+    }
+
+    MemoryCondition condition{addr, type_it->second, op_it->second,
+                              ConditionValue{GetConditionValueKind(type_it->second)}};
+    switch (condition.operand.kind)
+    {
+    case ConditionValue::Kind::Unsigned:
+      condition.operand.u = PyLong_AsUnsignedLongLongMask(operand_obj);
+      break;
+    case ConditionValue::Kind::Signed:
+      condition.operand.s = PyLong_AsLongLong(operand_obj);
+      break;
+    case ConditionValue::Kind::Float:
+      if (condition.op == ConditionOp::BitsSet)
+      {
+        PyErr_SetString(PyExc_ValueError, "operator & is not supported for float types");
+        return std::nullopt;
+      }
+      condition.operand.f = PyFloat_AsDouble(operand_obj);
+      break;
+    }
+    if (PyErr_Occurred())
+      return std::nullopt;
+    return condition;
+  }
+
+  // Returns the value read from memory if the condition is met.
+  std::optional<ConditionValue> Evaluate(const Core::CPUThreadGuard& guard) const
+  {
+    const ConditionValue value = ReadConditionValue(guard, addr, type);
+    bool met;
+    switch (value.kind)
+    {
+    case ConditionValue::Kind::Unsigned:
+      met = CompareConditionValues(value.u, op, operand.u);
+      break;
+    case ConditionValue::Kind::Signed:
+      met = CompareConditionValues(value.s, op, operand.s);
+      break;
+    default:
+      met = CompareConditionValues(value.f, op, operand.f);
+      break;
+    }
+    if (!met)
+      return std::nullopt;
+    return value;
+  }
+};
+
+// Coroutines awaiting `frameadvance(n)` with n > 1 or `until(...)`.
+// Frames are counted and memory conditions evaluated natively on every frame advance,
+// so a coroutine is only resumed, and the GIL only taken, once it is done waiting.
+class FrameWaiters
+{
+public:
+  // Called on every frame advance from the emulation thread without holding the GIL.
+  // Returns whether any waiter is done waiting.
+  bool Tick()
+  {
+    if (m_num_waiters.load(std::memory_order_acquire) == 0)
+      return false;
+    std::lock_guard lock{m_mutex};
+    ++m_frame;
+    std::optional<Core::CPUThreadGuard> guard;
+    bool any_done = false;
+    for (Waiter& waiter : m_waiters)
+    {
+      if (!waiter.done && waiter.condition.has_value())
+      {
+        if (!guard.has_value())
+          guard.emplace(Core::System::GetInstance());
+        waiter.value = waiter.condition->Evaluate(*guard);
+        waiter.done = waiter.value.has_value();
+      }
+      else if (!waiter.done)
+      {
+        waiter.done = m_frame >= waiter.resume_frame;
+      }
+      any_done |= waiter.done;
+    }
+    return any_done;
+  }
+
+  bool IsEmpty() const { return m_num_waiters.load(std::memory_order_acquire) == 0; }
+
+  // Requires the GIL.
+  void AddFrameCount(Py::Object coro, u32 num_frames)
+  {
+    std::lock_guard lock{m_mutex};
+    m_waiters.push_back({std::move(coro), m_frame + num_frames, std::nullopt, std::nullopt});
+    m_num_waiters.store(m_waiters.size(), std::memory_order_release);
+  }
+
+  // Requires the GIL.
+  void AddCondition(Py::Object coro, const MemoryCondition& condition)
+  {
+    std::lock_guard lock{m_mutex};
+    m_waiters.push_back({std::move(coro), 0, condition, std::nullopt});
+    m_num_waiters.store(m_waiters.size(), std::memory_order_release);
+  }
+
+  // Removes all waiters that are done waiting and returns their coroutines,
+  // each with the value to resume it with. Requires the GIL.
+  std::vector<std::pair<Py::Object, Py::Object>> TakeDone()
+  {
+    std::vector<std::pair<Py::Object, Py::Object>> done;
+    std::lock_guard lock{m_mutex};
+    auto it = std::stable_partition(m_waiters.begin(), m_waiters.end(),
+                                    [](const Waiter& waiter) { return !waiter.done; });
+    for (auto done_it = it; done_it != m_waiters.end(); ++done_it)
+    {
+      Py::Object value = done_it->value.has_value() ? Py::Wrap(done_it->value->ToPyObject()) :
+                                                      Py::Wrap(PyTuple_New(0));
+      done.emplace_back(std::move(done_it->coro), std::move(value));
+    }
+    m_waiters.erase(it, m_waiters.end());
+    m_num_waiters.store(m_waiters.size(), std::memory_order_release);
+    return done;
+  }
+
+  // Requires the GIL.
+  void Clear()
+  {
+    std::lock_guard lock{m_mutex};
+    m_waiters.clear();
+    m_num_waiters.store(0, std::memory_order_release);
+  }
+
+private:
+  struct Waiter
+  {
+    Py::Object coro;
+    u64 resume_frame;
+    std::optional<MemoryCondition> condition;
+    std::optional<ConditionValue> value;
+    bool done = false;
+  };
+
+  std::mutex m_mutex;
+  std::vector<Waiter> m_waiters;
+  std::atomic<size_t> m_num_waiters = 0;
+  u64 m_frame = 0;
+};
+
+template <typename T>
+constexpr bool HasAddressCallbacks =
+    std::is_same_v<T, API::Events::CodeBreakpoint> || std::is_same_v<T, API::Events::MemoryBreakpoint>;
+
+// The python side of one event: its callback, the coroutines awaiting it,
+// and the listener on the event dispatcher while there are any of those.
 template <typename T>
 struct EventState
 {
   Py::Object callback;
   std::deque<Py::Object> awaiting_coroutines;
+  // Whether there is a callback or awaiting coroutine.
+  // Lets listeners skip taking the GIL for events nobody in python is interested in.
+  std::atomic<bool> has_python_listeners = false;
+  // Only set while python code is interested in the event, so that emitting sites checking
+  // HasListeners can skip the event entirely otherwise.
+  std::optional<API::ListenerID<T>> listener_id;
 };
 template <typename... TsEvents>
 struct GenericEventModuleState
 {
-  API::EventHub* event_hub;
-  std::optional<std::function<void()>> cleanup_listeners;
+  PyEventDispatcher* event_dispatcher;
   std::tuple<EventState<TsEvents>...> event_state;
+  AddressCallbacks code_breakpoint_callbacks;
+  AddressCallbacks memory_breakpoint_callbacks;
+  FrameWaiters frame_waiters;
 
   template <typename TEvent>
   Py::Object& GetCallback()
@@ -55,10 +499,57 @@ struct GenericEventModuleState
     return std::get<EventState<TEvent>>(event_state).awaiting_coroutines;
   }
 
-  void Reset()
+  template <typename TEvent>
+  std::optional<API::ListenerID<TEvent>>& GetListenerID()
+  {
+    return std::get<EventState<TEvent>>(event_state).listener_id;
+  }
+
+  template <typename TEvent>
+  AddressCallbacks& GetAddressCallbacks()
+  {
+    static_assert(HasAddressCallbacks<TEvent>);
+    if constexpr (std::is_same_v<TEvent, API::Events::CodeBreakpoint>)
+      return code_breakpoint_callbacks;
+    else
+      return memory_breakpoint_callbacks;
+  }
+
+  // May be called without holding the GIL.
+  template <typename TEvent>
+  bool HasPythonListeners(const TEvent& event)
+  {
+    if (std::get<EventState<TEvent>>(event_state).has_python_listeners.load(std::memory_order_acquire))
+      return true;
+    if constexpr (HasAddressCallbacks<TEvent>)
+      return GetAddressCallbacks<TEvent>().HasMatch(event.addr);
+    else
+      return false;
+  }
+
+  // Must be called after changing the callback or the awaiting coroutines.
+  template <typename TEvent>
+  void UpdateHasPythonListeners()
   {
-    std::apply([](auto&&... s) { ((s.callback = Py::Null(), s.awaiting_coroutines.clear()), ...); },
-        event_state);
+    EventState<TEvent>& s = std::get<EventState<TEvent>>(event_state);
+    s.has_python_listeners.store(!s.callback.IsNull() || !s.awaiting_coroutines.empty(),
+                                 std::memory_order_release);
+  }
+
+  // Whether anything in python may need the event, including native waits. Requires the GIL.
+  template <typename TEvent>
+  bool NeedsEvent()
+  {
+    if (std::get<EventState<TEvent>>(event_state).has_python_listeners.load(std::memory_order_acquire))
+      return true;
+    if constexpr (HasAddressCallbacks<TEvent>)
+    {
+      if (!GetAddressCallbacks<TEvent>().IsEmpty())
+        return true;
+    }
+    if constexpr (std::is_same_v<TEvent, API::Events::FrameAdvance>)
+      return !frame_waiters.IsEmpty();
+    return false;
   }
 };
 using EventModuleState = GenericEventModuleState<
@@ -87,20 +578,64 @@ using EventModuleState = GenericEventModuleState<
 template <typename TEvent, typename... TsArgs>
 using MappingFunc = const std::tuple<TsArgs...> (*)(const TEvent&);
 
+static void ResumeFrameWaiters(const Py::Object module, EventModuleState* state)
+{
+  auto done = state->frame_waiters.TakeDone();
+  state->event_dispatcher->CountCoroutineResumes<API::Events::FrameAdvance>(done.size());
+  for (auto& [coro, value] : done)
+  {
+    PyObject* newAsyncEventTuple = Py::CallMethod(coro, "send", value.Lend());
+    if (newAsyncEventTuple != nullptr)
+      HandleCoroutine(module, coro, Py::Wrap(newAsyncEventTuple));
+    else if (!PyErr_ExceptionMatches(PyExc_StopIteration))
+      // coroutines signal completion by raising StopIteration
+      PyErr_Print();
+    else
+      PyErr_Clear();
+  }
+}
+
 template <typename T, T>
 struct PyEvent;
 
 template <typename TEvent, typename... TsArgs, MappingFunc<TEvent, TsArgs...> TFunc>
 struct PyEvent<MappingFunc<TEvent, TsArgs...>, TFunc>
 {
-  static std::function<void(const TEvent&)> GetListener(const Py::Object module)
+  // Listens on the event dispatcher while python code needs the event and stops listening
+  // once it doesn't anymore. Must be called after anything NeedsEvent depends on changed.
+  // Requires the GIL.
+  static void UpdateSubscription(const Py::Object module)
   {
-    PyThreadState* threadstate = PyThreadState_Get();
-    return [=](const TEvent& event) {
-      PyEval_RestoreThread(threadstate);
-      Listener(module, event);
-      PyEval_SaveThread();
-    };
+    EventModuleState* state = Py::GetState<EventModuleState>(module.Lend());
+    state->UpdateHasPythonListeners<TEvent>();
+    std::optional<API::ListenerID<TEvent>>& listener_id = state->GetListenerID<TEvent>();
+    const bool needs_event = state->NeedsEvent<TEvent>();
+    if (needs_event && !listener_id.has_value())
+    {
+      listener_id = Listen(module);
+    }
+    else if (!needs_event && listener_id.has_value())
+    {
+      state->event_dispatcher->UnlistenEvent(listener_id.value());
+      listener_id.reset();
+    }
+  }
+
+  static API::ListenerID<TEvent> Listen(const Py::Object module)
+  {
+    EventModuleState* state = Py::GetState<EventModuleState>(module.Lend());
+    return state->event_dispatcher->ListenEvent<TEvent>(
+        [state](const TEvent& event) {
+          bool has_done_frame_waiters = false;
+          if constexpr (std::is_same_v<TEvent, API::Events::FrameAdvance>)
+            has_done_frame_waiters = state->frame_waiters.Tick();
+          return has_done_frame_waiters || state->HasPythonListeners(event);
+        },
+        // The listener may be dropped by an emission in progress without holding the GIL, so it
+        // can't own a reference. Clearing the module's events unlistens before the module dies.
+        [module_ptr = module.Lend()](const TEvent& event) {
+          Listener(Py::Take(module_ptr), event);
+        });
   }
 
   static void DecrefPyObjectsInArgs(const std::tuple<TsArgs...> args) {
@@ -131,12 +666,27 @@ struct PyEvent<MappingFunc<TEvent, TsArgs...>, TFunc>
     // a) emulation events being processed synchronously to emulation, and
     // b) concurrent events be processed concurrently.
     EventModuleState* state = Py::GetState<EventModuleState>(module.Lend());
-    NotifyAwaitingCoroutines(module, event);
-    if (state->GetCallback<TEvent>().IsNull())
-      return;
+    // Mapped once and shared by everyone interested, so that e.g. a frame only gets copied once.
     const std::tuple<TsArgs...> args = TFunc(event);
+    NotifyAwaitingCoroutines(module, args);
+    if constexpr (std::is_same_v<TEvent, API::Events::FrameAdvance>)
+      ResumeFrameWaiters(module, state);
+    if (!state->GetCallback<TEvent>().IsNull())
+      InvokeCallback(module, state->GetCallback<TEvent>(), args);
+    if constexpr (HasAddressCallbacks<TEvent>)
+    {
+      for (const Py::Object& callback : state->GetAddressCallbacks<TEvent>().GetMatches(event.addr))
+        InvokeCallback(module, callback, args);
+    }
+    DecrefPyObjectsInArgs(args);
+    // Awaiting coroutines and frame waiters that were resumed may not have waited again.
+    UpdateSubscription(module);
+  }
+  static void InvokeCallback(const Py::Object module, const Py::Object callback,
+                             const std::tuple<TsArgs...>& args)
+  {
     PyObject* result =
-        std::apply([&](auto&&... arg) { return Py::CallFunction(state->GetCallback<TEvent>(), arg...); }, args);
+        std::apply([&](auto&&... arg) { return Py::CallFunction(callback, arg...); }, args);
     if (result == nullptr)
     {
       PyErr_Print();
@@ -144,7 +694,8 @@ struct PyEvent<MappingFunc<TEvent, TsArgs...>, TFunc>
     }
     if (PyCoro_CheckExact(result))
       HandleNewCoroutine(module, Py::Wrap(result));
-    DecrefPyObjectsInArgs(args);
+    else
+      Py_DECREF(result);
   }
   static PyObject* SetCallback(PyObject* module, PyObject* newCallback)
   {
@@ -152,6 +703,7 @@ struct PyEvent<MappingFunc<TEvent, TsArgs...>, TFunc>
     if (newCallback == Py_None)
     {
       state->GetCallback<TEvent>() = Py::Null();
+      UpdateSubscription(Py::Take(module));
       Py_RETURN_NONE;
     }
     if (!PyCallable_Check(newCallback))
@@ -160,23 +712,64 @@ struct PyEvent<MappingFunc<TEvent, TsArgs...>, TFunc>
       return nullptr;
     }
     state->GetCallback<TEvent>() = Py::Take(newCallback);
+    UpdateSubscription(Py::Take(module));
     Py_RETURN_NONE;
   }
-  static void ScheduleCoroutine(Py::Object module, const Py::Object coro)
+  static PyObject* SetAddressCallback(PyObject* module, PyObject* args, PyObject* kwargs)
   {
+    static const char* kwlist[] = {"address", "callback", "end", nullptr};
+    u32 start;
+    PyObject* new_callback;
+    PyObject* end_obj = Py_None;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "IO|O", const_cast<char**>(kwlist), &start,
+                                     &new_callback, &end_obj))
+      return nullptr;
+    u32 end = start;
+    if (end_obj != Py_None)
+    {
+      const unsigned long end_value = PyLong_AsUnsignedLong(end_obj);
+      if (PyErr_Occurred())
+        return nullptr;
+      if (end_value < start || end_value > 0xFFFFFFFF)
+      {
+        PyErr_SetString(PyExc_ValueError, "end must be a 32-bit address not lower than address");
+        return nullptr;
+      }
+      end = static_cast<u32>(end_value);
+    }
+    if (new_callback != Py_None && !PyCallable_Check(new_callback))
+    {
+      PyErr_SetString(PyExc_TypeError, "event callback must be callable");
+      return nullptr;
+    }
+    EventModuleState* state = Py::GetState<EventModuleState>(module);
+    state->GetAddressCallbacks<TEvent>().Set(
+        start, end, new_callback == Py_None ? Py::Null() : Py::Take(new_callback));
+    UpdateSubscription(Py::Take(module));
+    Py_RETURN_NONE;
+  }
+  static bool ScheduleCoroutine(const Py::Object module, const Py::Object coro, PyObject* args)
+  {
+    if (PyTuple_GET_SIZE(args) != 0)
+    {
+      PyErr_SetString(PyExc_TypeError, "this event cannot be awaited with arguments");
+      return false;
+    }
     EventModuleState* state = Py::GetState<EventModuleState>(module.Lend());
     state->GetAwaitingCoroutines<TEvent>().emplace_back(coro);
+    UpdateSubscription(module);
+    return true;
   }
-  static void NotifyAwaitingCoroutines(const Py::Object module, const TEvent& event)
+  static void NotifyAwaitingCoroutines(const Py::Object module, const std::tuple<TsArgs...>& args)
   {
     EventModuleState* state = Py::GetState<EventModuleState>(module.Lend());
     std::deque<Py::Object> awaiting_coroutines;
     std::swap(state->GetAwaitingCoroutines<TEvent>(), awaiting_coroutines);
+    state->event_dispatcher->CountCoroutineResumes<TEvent>(awaiting_coroutines.size());
     while (!awaiting_coroutines.empty())
     {
       const Py::Object coro = awaiting_coroutines.front();
       awaiting_coroutines.pop_front();
-      const std::tuple<TsArgs...> args = TFunc(event);
       Py::Object args_tuple = Py::Wrap(Py::BuildValueTuple(args));
       PyObject* newAsyncEventTuple = Py::CallMethod(coro, "send", args_tuple.Lend());
       if (newAsyncEventTuple != nullptr)
@@ -184,13 +777,25 @@ struct PyEvent<MappingFunc<TEvent, TsArgs...>, TFunc>
       else if (!PyErr_ExceptionMatches(PyExc_StopIteration))
         // coroutines signal completion by raising StopIteration
         PyErr_Print();
-      DecrefPyObjectsInArgs(args);
+      else
+        PyErr_Clear();
     }
+    state->UpdateHasPythonListeners<TEvent>();
   }
   static void Clear(EventModuleState* state)
   {
+    if (std::optional<API::ListenerID<TEvent>>& listener_id = state->GetListenerID<TEvent>())
+    {
+      state->event_dispatcher->UnlistenEvent(listener_id.value());
+      listener_id.reset();
+    }
     state->GetCallback<TEvent>() = Py::Null();
     state->GetAwaitingCoroutines<TEvent>().clear();
+    state->UpdateHasPythonListeners<TEvent>();
+    if constexpr (HasAddressCallbacks<TEvent>)
+      state->GetAddressCallbacks<TEvent>().Clear();
+    if constexpr (std::is_same_v<TEvent, API::Events::FrameAdvance>)
+      state->frame_waiters.Clear();
   }
 };
 
@@ -203,23 +808,9 @@ template <class... Ts>
 struct PythonEventContainer
 {
 public:
-  static void RegisterListeners(const Py::Object module)
-  {
-    EventModuleState* state = Py::GetState<EventModuleState>(module.Lend());
-    const auto listener_ids = std::apply(
-        [&](auto&&... pyevent) {
-          return std::make_tuple(state->event_hub->ListenEvent(pyevent.GetListener(module))...);
-        },
-        s_pyevents);
-    state->cleanup_listeners.emplace([=]() {
-      std::apply([&](const auto&... listener_id) { (state->event_hub->UnlistenEvent(listener_id), ...); },
-          listener_ids);
-    });
-  }
-  static void UnregisterListeners(EventModuleState* state)
+  // Drops all of python's interest in events and stops listening to them.
+  static void Clear(EventModuleState* state)
   {
-    state->cleanup_listeners.value()();
-    state->cleanup_listeners.reset();
     std::apply([&](const auto&... pyevent) { (pyevent.Clear(state), ...); }, s_pyevents);
   }
 private:
@@ -239,10 +830,13 @@ static const std::tuple<> PyFrameAdvance(const API::Events::FrameAdvance& evt)
 }
 static const std::tuple<u32, u32, PyObject*> PyFrameDrawn(const API::Events::FrameDrawn& evt)
 {
-  const u32 num_bytes = evt.width * evt.height * 4;
-  auto data = reinterpret_cast<const char*>(evt.data);
-  PyObject* pybytes = PyBytes_FromStringAndSize(data, num_bytes);
-  return std::make_tuple(evt.width, evt.height, pybytes);
+  // A read-only view of the frame, shaped (height, width, 4). The event's data is reused for later
+  // frames, so the view is backed by a copy that lives as long as the script keeps it.
+  // The view is shared by all callbacks and coroutines of the interpreter.
+  PyObject* view = Py::MakeImageView(evt.data, evt.width, evt.height, evt.stride);
+  if (view == nullptr)
+    PyErr_Print();
+  return std::make_tuple(evt.width, evt.height, view);
 }
 static const std::tuple<bool, u32, u64> PyMemoryBreakpoint(const API::Events::MemoryBreakpoint& evt)
 {
@@ -341,13 +935,51 @@ using EventContainer = PythonEventContainer<
 template <>
 const EventTuple EventContainer::s_pyevents = {};
 
+// `await frameadvance(n)` only resumes the coroutine after n frames.
+static bool ScheduleFrameAdvanceCoroutine(const Py::Object module, const Py::Object coro,
+                                          PyObject* args)
+{
+  long long num_frames = 1;
+  if (!PyArg_ParseTuple(args, "|L", &num_frames))
+    return false;
+  if (num_frames < 1 || num_frames > std::numeric_limits<u32>::max())
+  {
+    PyErr_SetString(PyExc_ValueError,
+                    "frameadvance() must wait for between 1 and 4294967295 frames");
+    return false;
+  }
+  if (num_frames == 1)
+    return PyFrameAdvanceEvent::ScheduleCoroutine(module, coro, Py::Wrap(PyTuple_New(0)).Lend());
+
+  EventModuleState* state = Py::GetState<EventModuleState>(module.Lend());
+  state->frame_waiters.AddFrameCount(coro, static_cast<u32>(num_frames));
+  PyFrameAdvanceEvent::UpdateSubscription(module);
+  return true;
+}
+
+// `await until(address, type, op, value)` resumes the coroutine on the first frame advance
+// where the memory condition is met.
+static bool ScheduleUntilCoroutine(const Py::Object module, const Py::Object coro,
+                                   PyObject* args)
+{
+  const std::optional<MemoryCondition> condition = MemoryCondition::FromArgs(args);
+  if (!condition.has_value())
+    return false;
+
+  EventModuleState* state = Py::GetState<EventModuleState>(module.Lend());
+  state->frame_waiters.AddCondition(coro, condition.value());
+  PyFrameAdvanceEvent::UpdateSubscription(module);
+  return true;
+}
+
 std::optional<CoroutineScheduler> GetCoroutineScheduler(std::string aeventname)
 {
   static std::map<std::string, CoroutineScheduler> lookup = {
       // HOOKING UP PY EVENTS TO AWAITABLE STRING REPRESENTATION
       // All async-awaitable events must be listed twice:
       // Here, and under the same name in the setup python code
-      {"frameadvance", PyFrameAdvanceEvent::ScheduleCoroutine},
+      {"frameadvance", ScheduleFrameAdvanceCoroutine},
+      {"until", ScheduleUntilCoroutine},
       {"framedrawn", PyFrameDrawnEvent::ScheduleCoroutine},
       {"memorybreakpoint", PyMemoryBreakpointEvent::ScheduleCoroutine},
       {"codebreakpoint", PyCodeBreakpointEvent::ScheduleCoroutine},
@@ -378,8 +1010,11 @@ class _DolphinAsyncEvent:
     def __await__(self):
         return (yield ("dolphin_async_event_magic_string", self.event_name, self.args))
 
-async def frameadvance():
-    return (await _DolphinAsyncEvent("frameadvance"))
+async def frameadvance(count=1):
+    return (await _DolphinAsyncEvent("frameadvance", count))
+
+async def until(address, type, op, value):
+    return (await _DolphinAsyncEvent("until", address, type, op, value))
 
 async def memorybreakpoint():
     return (await _DolphinAsyncEvent("memorybreakpoint"))
@@ -422,17 +1057,15 @@ async def scriptend():
   {
     ERROR_LOG_FMT(SCRIPTING, "Failed to load embedded python code into event module");
   }
-  API::EventHub* event_hub = PyScripting::PyScriptingBackend::GetCurrent()->GetEventHub();
-  state->event_hub = event_hub;
-  const std::function cleanup = [state] { EventContainer::UnregisterListeners(state); };
+  state->event_dispatcher = PyScripting::PyScriptingBackend::GetCurrent()->GetEventDispatcher();
+  const std::function cleanup = [state] { EventContainer::Clear(state); };
   PyScripting::PyScriptingBackend::GetCurrent()->AddCleanupFunc(cleanup);
-  EventContainer::RegisterListeners(Py::Take(module));
 }
 
 static PyObject* Reset(PyObject* module)
 {
   EventModuleState* state = Py::GetState<EventModuleState>(module);
-  state->Reset();
+  EventContainer::Clear(state);
   Py_RETURN_NONE;
 }
 
@@ -455,6 +1088,10 @@ PyMODINIT_FUNC PyInit_event()
       Py::MakeMethodDef<PyFrameDrawnEvent::SetCallback>("on_framedrawn"),
       Py::MakeMethodDef<PyMemoryBreakpointEvent::SetCallback>("on_memorybreakpoint"),
       Py::MakeMethodDef<PyCodeBreakpointEvent::SetCallback>("on_codebreakpoint"),
+      {"on_memorybreakpoint_at", (PyCFunction)PyMemoryBreakpointEvent::SetAddressCallback,
+       METH_VARARGS | METH_KEYWORDS, ""},
+      {"on_codebreakpoint_at", (PyCFunction)PyCodeBreakpointEvent::SetAddressCallback,
+       METH_VARARGS | METH_KEYWORDS, ""},
       Py::MakeMethodDef<PySaveStateSaveEvent::SetCallback>("on_savestatesave"),
       Py::MakeMethodDef<PySaveStateLoadEvent::SetCallback>("on_savestateload"),
       Py::MakeMethodDef<PyBeforeSaveStateLoadEvent::SetCallback>("on_beforesavestateload"),
@@ -15,7 +15,10 @@ namespace PyScripting
 
 PyMODINIT_FUNC PyInit_event();
 
-using CoroutineScheduler = void(*)(const Py::Object, const Py::Object);
+// Schedules a coroutine to be resumed once the awaited event happens.
+// Receives the arguments the event was awaited with, e.g. `(5,)` for `await frameadvance(5)`.
+// Returns false and sets the python error if the arguments are invalid.
+using CoroutineScheduler = bool(*)(const Py::Object, const Py::Object, PyObject*);
 std::optional<CoroutineScheduler> GetCoroutineScheduler(std::string aeventname);
 
 }
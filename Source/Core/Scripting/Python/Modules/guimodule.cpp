@@ -4,6 +4,11 @@
 
 #include "guimodule.h"
 
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include "Common/Logging/Log.h"
 #include "Core/API/Gui.h"
 #include "Core/Config/MainSettings.h"
@@ -16,6 +21,10 @@ namespace PyScripting
 struct GuiModuleState
 {
   API::Gui* gui;
+  PyTypeObject* layer_type;
+  // Names of all layers this script has committed, to remove them when the script ends.
+  // The state's address identifies the script as the owner of its layers.
+  std::set<std::string> layer_names;
 };
 
 static void add_osd_message(PyObject* self, const char* message, u32 duration_ms, u32 color_argb)
@@ -111,28 +120,293 @@ static void draw_text(PyObject* self, float posX, float posY, u32 color, const c
   state->gui->DrawText({posX, posY}, color, std::string(text));
 }
 
+// Parses points given as an iterable of (x, y) pairs, or as a buffer of float32 x/y pairs.
+// Returns false with a python exception set on failure.
+static bool PointsFromPy(PyObject* obj, std::vector<Vec2f>* points)
+{
+  points->clear();
+  if (PyObject_CheckBuffer(obj))
+  {
+    Py_buffer buffer;
+    if (PyObject_GetBuffer(obj, &buffer, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0)
+      return false;
+    const std::string_view format = buffer.format != nullptr ? buffer.format : "B";
+    if ((format != "f" && format != "=f") || buffer.len % sizeof(Vec2f) != 0)
+    {
+      PyErr_SetString(PyExc_ValueError, "points buffer must consist of float32 x/y pairs");
+      PyBuffer_Release(&buffer);
+      return false;
+    }
+    const Vec2f* begin = static_cast<const Vec2f*>(buffer.buf);
+    points->assign(begin, begin + buffer.len / sizeof(Vec2f));
+    PyBuffer_Release(&buffer);
+    return true;
+  }
+
+  Py::Object seq = Py::Wrap(PySequence_Fast(obj, "points must be an iterable of (x, y)"));
+  if (seq.IsNull())
+    return false;
+  const Py_ssize_t num_points = PySequence_Fast_GET_SIZE(seq.Lend());
+  PyObject** items = PySequence_Fast_ITEMS(seq.Lend());
+  points->reserve(num_points);
+  for (Py_ssize_t i = 0; i < num_points; i++)
+  {
+    float x, y;
+    if (!PyTuple_Check(items[i]))
+    {
+      PyErr_SetString(PyExc_TypeError, "points must be an iterable of (x, y)");
+      return false;
+    }
+    if (!PyArg_ParseTuple(items[i], "ff;points must be an iterable of (x, y)", &x, &y))
+      return false;
+    points->push_back({x, y});
+  }
+  return true;
+}
+
+static int SegmentsForRadius(float radius)
+{
+  return 8 + static_cast<int>(radius / 50);
+}
+
+// The draw functions below parse python arguments and record a command into the given target,
+// which is either a layer's or a temporary DrawCommandBuffer.
+// They return false with a python exception set on failure.
+
+static bool RecordLine(API::DrawCommandBuffer& target, PyObject* args)
+{
+  Vec2f a, b;
+  u32 color;
+  float thickness = 1.0f;
+  if (!PyArg_ParseTuple(args, "(ff)(ff)I|f", &a.x, &a.y, &b.x, &b.y, &color, &thickness))
+    return false;
+  target.DrawLine(a, b, color, thickness);
+  return true;
+}
+
+static bool RecordRect(API::DrawCommandBuffer& target, PyObject* args)
+{
+  Vec2f a, b;
+  u32 color;
+  float rounding = 0.0f, thickness = 1.0f;
+  if (!PyArg_ParseTuple(args, "(ff)(ff)I|ff", &a.x, &a.y, &b.x, &b.y, &color, &rounding,
+                        &thickness))
+    return false;
+  target.DrawRect(a, b, color, rounding, thickness);
+  return true;
+}
+
+static bool RecordRectFilled(API::DrawCommandBuffer& target, PyObject* args)
+{
+  Vec2f a, b;
+  u32 color;
+  float rounding = 0.0f;
+  if (!PyArg_ParseTuple(args, "(ff)(ff)I|f", &a.x, &a.y, &b.x, &b.y, &color, &rounding))
+    return false;
+  target.DrawRectFilled(a, b, color, rounding);
+  return true;
+}
+
+static bool RecordQuad(API::DrawCommandBuffer& target, PyObject* args)
+{
+  Vec2f a, b, c, d;
+  u32 color;
+  float thickness = 1.0f;
+  if (!PyArg_ParseTuple(args, "(ff)(ff)(ff)(ff)I|f", &a.x, &a.y, &b.x, &b.y, &c.x, &c.y, &d.x,
+                        &d.y, &color, &thickness))
+    return false;
+  target.DrawQuad(a, b, c, d, color, thickness);
+  return true;
+}
+
+static bool RecordQuadFilled(API::DrawCommandBuffer& target, PyObject* args)
+{
+  Vec2f a, b, c, d;
+  u32 color;
+  if (!PyArg_ParseTuple(args, "(ff)(ff)(ff)(ff)I", &a.x, &a.y, &b.x, &b.y, &c.x, &c.y, &d.x, &d.y,
+                        &color))
+    return false;
+  target.DrawQuadFilled(a, b, c, d, color);
+  return true;
+}
+
+static bool RecordTriangle(API::DrawCommandBuffer& target, PyObject* args)
+{
+  Vec2f a, b, c;
+  u32 color;
+  float thickness = 1.0f;
+  if (!PyArg_ParseTuple(args, "(ff)(ff)(ff)I|f", &a.x, &a.y, &b.x, &b.y, &c.x, &c.y, &color,
+                        &thickness))
+    return false;
+  target.DrawTriangle(a, b, c, color, thickness);
+  return true;
+}
+
+static bool RecordTriangleFilled(API::DrawCommandBuffer& target, PyObject* args)
+{
+  Vec2f a, b, c;
+  u32 color;
+  if (!PyArg_ParseTuple(args, "(ff)(ff)(ff)I", &a.x, &a.y, &b.x, &b.y, &c.x, &c.y, &color))
+    return false;
+  target.DrawTriangleFilled(a, b, c, color);
+  return true;
+}
+
+static bool RecordCircle(API::DrawCommandBuffer& target, PyObject* args)
+{
+  Vec2f center;
+  float radius;
+  u32 color;
+  PyObject* num_segments_obj = Py_None;
+  float thickness = 1.0f;
+  if (!PyArg_ParseTuple(args, "(ff)fI|Of", &center.x, &center.y, &radius, &color,
+                        &num_segments_obj, &thickness))
+    return false;
+  int num_segments = SegmentsForRadius(radius);
+  if (num_segments_obj != Py_None)
+  {
+    num_segments = PyLong_AsLong(num_segments_obj);
+    if (PyErr_Occurred())
+      return false;
+  }
+  target.DrawCircle(center, radius, color, num_segments, thickness);
+  return true;
+}
+
+static bool RecordCircleFilled(API::DrawCommandBuffer& target, PyObject* args)
+{
+  Vec2f center;
+  float radius;
+  u32 color;
+  PyObject* num_segments_obj = Py_None;
+  if (!PyArg_ParseTuple(args, "(ff)fI|O", &center.x, &center.y, &radius, &color,
+                        &num_segments_obj))
+    return false;
+  int num_segments = SegmentsForRadius(radius);
+  if (num_segments_obj != Py_None)
+  {
+    num_segments = PyLong_AsLong(num_segments_obj);
+    if (PyErr_Occurred())
+      return false;
+  }
+  target.DrawCircleFilled(center, radius, color, num_segments);
+  return true;
+}
+
+static bool RecordText(API::DrawCommandBuffer& target, PyObject* args)
+{
+  Vec2f pos;
+  u32 color;
+  const char* text;
+  Py_ssize_t text_length;
+  if (!PyArg_ParseTuple(args, "(ff)Is#", &pos.x, &pos.y, &color, &text, &text_length))
+    return false;
+  target.DrawText(pos, color, std::string_view(text, text_length));
+  return true;
+}
+
+static bool RecordPolyline(API::DrawCommandBuffer& target, PyObject* args)
+{
+  PyObject* points_obj;
+  u32 color;
+  int closed = 0;
+  float thickness = 1.0f;
+  if (!PyArg_ParseTuple(args, "OI|pf", &points_obj, &color, &closed, &thickness))
+    return false;
+  std::vector<Vec2f> points;
+  if (!PointsFromPy(points_obj, &points))
+    return false;
+  target.DrawPolyline(points, color, closed, thickness);
+  return true;
+}
+
+static bool RecordConvexPolyFilled(API::DrawCommandBuffer& target, PyObject* args)
+{
+  PyObject* points_obj;
+  u32 color;
+  if (!PyArg_ParseTuple(args, "OI", &points_obj, &color))
+    return false;
+  std::vector<Vec2f> points;
+  if (!PointsFromPy(points_obj, &points))
+    return false;
+  target.DrawConvexPolyFilled(points, color);
+  return true;
+}
+
+static bool RecordPolylines(API::DrawCommandBuffer& target, PyObject* args)
+{
+  PyObject* polylines_obj;
+  u32 color;
+  int closed = 0;
+  float thickness = 1.0f;
+  if (!PyArg_ParseTuple(args, "OI|pf", &polylines_obj, &color, &closed, &thickness))
+    return false;
+  Py::Object seq =
+      Py::Wrap(PySequence_Fast(polylines_obj, "polylines must be an iterable of point lists"));
+  if (seq.IsNull())
+    return false;
+  const Py_ssize_t num_polylines = PySequence_Fast_GET_SIZE(seq.Lend());
+  PyObject** items = PySequence_Fast_ITEMS(seq.Lend());
+  std::vector<Vec2f> points;
+  for (Py_ssize_t i = 0; i < num_polylines; i++)
+  {
+    if (!PointsFromPy(items[i], &points))
+      return false;
+    target.DrawPolyline(points, color, closed, thickness);
+  }
+  return true;
+}
+
+static bool RecordTexts(API::DrawCommandBuffer& target, PyObject* args)
+{
+  PyObject* texts_obj;
+  if (!PyArg_ParseTuple(args, "O", &texts_obj))
+    return false;
+  Py::Object seq =
+      Py::Wrap(PySequence_Fast(texts_obj, "texts must be an iterable of (pos, color, text)"));
+  if (seq.IsNull())
+    return false;
+  const Py_ssize_t num_texts = PySequence_Fast_GET_SIZE(seq.Lend());
+  PyObject** items = PySequence_Fast_ITEMS(seq.Lend());
+  for (Py_ssize_t i = 0; i < num_texts; i++)
+  {
+    if (!PyTuple_Check(items[i]))
+    {
+      PyErr_SetString(PyExc_TypeError, "texts must be an iterable of (pos, color, text)");
+      return false;
+    }
+    if (!RecordText(target, items[i]))
+      return false;
+  }
+  return true;
+}
+
+using RecordFunc = bool (*)(API::DrawCommandBuffer&, PyObject*);
+
+// Records into a temporary buffer first, so the commands get handed to the gui all at once,
+// and nothing gets drawn if parsing fails halfway through.
+template <RecordFunc TRecord>
+static PyObject* DrawBatched(PyObject* self, PyObject* args)
+{
+  API::DrawCommandBuffer commands;
+  if (!TRecord(commands, args))
+    return nullptr;
+  GuiModuleState* state = Py::GetState<GuiModuleState>(self);
+  state->gui->DrawCommands(commands);
+  Py_RETURN_NONE;
+}
+
 static PyObject* draw_polyline(PyObject* self, PyObject* args)
 {
-  PyObject* points_list_obj;
+  std::vector<Vec2f> points;
+  PyObject* points_obj;
   u32 color;
-  bool closed;
+  int closed;
   float thickness;
-  if (!PyArg_ParseTuple(args, "O!Ipf", &PyList_Type, &points_list_obj, &color, &closed,
-                        &thickness))
+  if (!PyArg_ParseTuple(args, "OIpf", &points_obj, &color, &closed, &thickness))
     return nullptr;
-  int num_points = PyList_Size(points_list_obj);
-  if (num_points < 0)
+  if (!PointsFromPy(points_obj, &points))
     return nullptr;
-  std::vector<Vec2f> points_collecting;
-  for (int i = 0; i < num_points; ++i)
-  {
-    PyObject* item = PyList_GetItem(points_list_obj, i);
-    float x, y;
-    if (!PyArg_ParseTuple(item, "ff", &x, &y))
-      return nullptr;
-    points_collecting.push_back({x, y});
-  }
-  const std::vector<Vec2f> points = points_collecting;
   GuiModuleState* state = Py::GetState<GuiModuleState>(self);
   state->gui->DrawPolyline(points, color, closed, thickness);
   Py_RETURN_NONE;
@@ -140,27 +414,149 @@ static PyObject* draw_polyline(PyObject* self, PyObject* args)
 
 static PyObject* draw_convex_poly_filled(PyObject* self, PyObject* args)
 {
-  PyObject* points_list_obj;
+  std::vector<Vec2f> points;
+  PyObject* points_obj;
   u32 color;
-  if (!PyArg_ParseTuple(args, "O!I", &PyList_Type, &points_list_obj, &color))
+  if (!PyArg_ParseTuple(args, "OI", &points_obj, &color))
     return nullptr;
-  int num_points = PyList_Size(points_list_obj);
-  if (num_points < 0)
+  if (!PointsFromPy(points_obj, &points))
     return nullptr;
-  std::vector<Vec2f> points;
-  for (int i = 0; i < num_points; ++i)
-  {
-    PyObject* item = PyList_GetItem(points_list_obj, i);
-    float x, y;
-    if (!PyArg_ParseTuple(item, "ff", &x, &y))
-      return nullptr;
-    points.push_back({x, y});
-  }
   GuiModuleState* state = Py::GetState<GuiModuleState>(self);
   state->gui->DrawConvexPolyFilled(points, color);
   Py_RETURN_NONE;
 }
 
+// A named set of draw commands that is drawn every frame until it is changed or removed.
+// Commands are recorded into the layer without being visible,
+// and are only handed to the gui on commit.
+struct PyGuiLayer
+{
+  PyObject_HEAD
+  API::DrawCommandBuffer* commands;
+  std::string* name;
+  int order;
+};
+
+static PyObject* LayerNew(PyTypeObject* type, PyObject* args, PyObject* kwargs)
+{
+  const char* name;
+  int order = 0;
+  static char* kwlist[] = {const_cast<char*>("name"), const_cast<char*>("order"), nullptr};
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s|i", kwlist, &name, &order))
+    return nullptr;
+  PyGuiLayer* self = reinterpret_cast<PyGuiLayer*>(type->tp_alloc(type, 0));
+  if (self == nullptr)
+    return nullptr;
+  self->commands = new API::DrawCommandBuffer();
+  self->name = new std::string(name);
+  self->order = order;
+  return reinterpret_cast<PyObject*>(self);
+}
+
+static void LayerDealloc(PyObject* self)
+{
+  PyTypeObject* type = Py_TYPE(self);
+  PyGuiLayer* layer = reinterpret_cast<PyGuiLayer*>(self);
+  delete layer->commands;
+  delete layer->name;
+  type->tp_free(self);
+  Py_DECREF(type);
+}
+
+template <RecordFunc TRecord>
+static PyObject* LayerRecord(PyObject* self, PyObject* args)
+{
+  if (!TRecord(*reinterpret_cast<PyGuiLayer*>(self)->commands, args))
+    return nullptr;
+  Py_RETURN_NONE;
+}
+
+static PyObject* LayerClear(PyObject* self, PyObject*)
+{
+  reinterpret_cast<PyGuiLayer*>(self)->commands->Clear();
+  Py_RETURN_NONE;
+}
+
+static PyObject* LayerCommit(PyObject* self, PyObject*)
+{
+  PyGuiLayer* layer = reinterpret_cast<PyGuiLayer*>(self);
+  GuiModuleState* state = Py::GetState<GuiModuleState>(PyType_GetModule(Py_TYPE(self)));
+  // Copies the commands, so the layer can keep being recorded into or committed again.
+  state->gui->SetLayer(state, *layer->name, layer->order, *layer->commands);
+  state->layer_names.insert(*layer->name);
+  Py_RETURN_NONE;
+}
+
+static PyObject* LayerRemove(PyObject* self, PyObject*)
+{
+  PyGuiLayer* layer = reinterpret_cast<PyGuiLayer*>(self);
+  GuiModuleState* state = Py::GetState<GuiModuleState>(PyType_GetModule(Py_TYPE(self)));
+  state->gui->RemoveLayer(state, *layer->name);
+  state->layer_names.erase(*layer->name);
+  Py_RETURN_NONE;
+}
+
+static PyObject* LayerGetName(PyObject* self, void*)
+{
+  const std::string& name = *reinterpret_cast<PyGuiLayer*>(self)->name;
+  return PyUnicode_FromStringAndSize(name.data(), static_cast<Py_ssize_t>(name.size()));
+}
+
+static PyObject* LayerGetOrder(PyObject* self, void*)
+{
+  return PyLong_FromLong(reinterpret_cast<PyGuiLayer*>(self)->order);
+}
+
+static Py_ssize_t LayerLength(PyObject* self)
+{
+  return static_cast<Py_ssize_t>(reinterpret_cast<PyGuiLayer*>(self)->commands->Size());
+}
+
+static PyTypeObject* CreateLayerType(PyObject* module)
+{
+  static PyMethodDef methods[] = {
+      {"clear", LayerClear, METH_NOARGS, ""},
+      {"commit", LayerCommit, METH_NOARGS, ""},
+      {"remove", LayerRemove, METH_NOARGS, ""},
+      {"draw_line", LayerRecord<RecordLine>, METH_VARARGS, ""},
+      {"draw_rect", LayerRecord<RecordRect>, METH_VARARGS, ""},
+      {"draw_rect_filled", LayerRecord<RecordRectFilled>, METH_VARARGS, ""},
+      {"draw_quad", LayerRecord<RecordQuad>, METH_VARARGS, ""},
+      {"draw_quad_filled", LayerRecord<RecordQuadFilled>, METH_VARARGS, ""},
+      {"draw_triangle", LayerRecord<RecordTriangle>, METH_VARARGS, ""},
+      {"draw_triangle_filled", LayerRecord<RecordTriangleFilled>, METH_VARARGS, ""},
+      {"draw_circle", LayerRecord<RecordCircle>, METH_VARARGS, ""},
+      {"draw_circle_filled", LayerRecord<RecordCircleFilled>, METH_VARARGS, ""},
+      {"draw_text", LayerRecord<RecordText>, METH_VARARGS, ""},
+      {"draw_polyline", LayerRecord<RecordPolyline>, METH_VARARGS, ""},
+      {"draw_convex_poly_filled", LayerRecord<RecordConvexPolyFilled>, METH_VARARGS, ""},
+      {"draw_polylines", LayerRecord<RecordPolylines>, METH_VARARGS, ""},
+      {"draw_texts", LayerRecord<RecordTexts>, METH_VARARGS, ""},
+      {nullptr, nullptr, 0, nullptr}  // Sentinel
+  };
+  static PyGetSetDef getset[] = {
+      {"name", LayerGetName, nullptr, nullptr, nullptr},
+      {"order", LayerGetOrder, nullptr, nullptr, nullptr},
+      {nullptr, nullptr, nullptr, nullptr, nullptr}  // Sentinel
+  };
+  static PyType_Slot slots[] = {
+      {Py_tp_new, reinterpret_cast<void*>(LayerNew)},
+      {Py_tp_dealloc, reinterpret_cast<void*>(LayerDealloc)},
+      {Py_tp_methods, methods},
+      {Py_tp_getset, getset},
+      {Py_sq_length, reinterpret_cast<void*>(LayerLength)},
+      {0, nullptr}  // Sentinel
+  };
+  static PyType_Spec spec = {
+      "dolphin_gui.Layer",
+      sizeof(PyGuiLayer),
+      0,
+      Py_TPFLAGS_DEFAULT,
+      slots,
+  };
+  return Py::AddTypeToModule(module, &spec);
+}
+
 static void SetupGuiModule(PyObject* module, GuiModuleState* state)
 {
   static const char pycode[] = R"(
@@ -214,6 +610,12 @@ def draw_convex_poly_filled(points, color):
   }
   API::Gui* gui = PyScripting::PyScriptingBackend::GetCurrent()->GetGui();
   state->gui = gui;
+  state->layer_type = CreateLayerType(module);
+  PyScriptingBackend::GetCurrent()->AddCleanupFunc([state] {
+    for (const std::string& name : state->layer_names)
+      state->gui->RemoveLayer(state, name);
+    state->layer_names.clear();
+  });
 }
 
 PyMODINIT_FUNC PyInit_gui()
@@ -235,6 +637,8 @@ PyMODINIT_FUNC PyInit_gui()
       {"_draw_text", Py::as_py_func<draw_text>, METH_VARARGS, ""},
       {"_draw_polyline", draw_polyline, METH_VARARGS, ""},
       {"_draw_convex_poly_filled", draw_convex_poly_filled, METH_VARARGS, ""},
+      {"draw_polylines", DrawBatched<RecordPolylines>, METH_VARARGS, ""},
+      {"draw_texts", DrawBatched<RecordTexts>, METH_VARARGS, ""},
 
       {nullptr, nullptr, 0, nullptr}  // Sentinel
   };
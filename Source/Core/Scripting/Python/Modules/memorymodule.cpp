@@ -4,13 +4,37 @@
 
 #include "memorymodule.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "Core/API/Events.h"
 #include "Core/API/Memory.h"
+#include "Core/API/MemoryWatch.h"
+#include "Core/CheatSearch.h"
+#include "Core/CompactCheatSearch.h"
+#include "Core/CoreTiming.h"
 #include "Core/HW/Memmap.h"
+#include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
 
 #include "Scripting/Python/Utils/module.h"
 #include "Scripting/Python/Utils/as_py_func.h"
+#include "Scripting/Python/Utils/object_wrapper.h"
+#include "Scripting/Python/PyScriptingBackend.h"
 #include "Core/Core.h"
 
 namespace PyScripting
@@ -20,8 +44,389 @@ struct MemoryModuleState
 {
   // If Memory wasn't static, you'd store the memory instance here:
   //API::Memory* memory;
+  PyTypeObject* read_plan_type;
+  PyTypeObject* ram_view_type;
+  PyTypeObject* pointer_path_type;
+  PyTypeObject* memory_watch_type;
+  PyTypeObject* cheat_search_type;
+
+  PyScripting::PyEventDispatcher* event_dispatcher;
+  // Only listens to frameadvance while there are watches with callbacks.
+  std::optional<API::ListenerID<API::Events::FrameAdvance>> frame_listener;
+  std::vector<Py::Object> watches;
+};
+
+// Incremented by every write performed through this module (from any interpreter).
+// Used to invalidate cached pointer paths.
+static std::atomic<u64> s_write_generation = 0;
+
+static bool CheckMemoryInitialized()
+{
+  if (!Core::System::GetInstance().GetMemory().IsInitialized())
+  {
+    PyErr_SetString(PyExc_ValueError, "memory is not initialized");
+    return false;
+  }
+  return true;
+}
+
+// Value types understood by the batched read functions,
+// named the same as the respective read_* functions.
+enum class ValueType : u8
+{
+  U8,
+  U16,
+  U32,
+  U64,
+  S8,
+  S16,
+  S32,
+  S64,
+  F32,
+  F64,
+};
+
+struct ValueTypeInfo
+{
+  ValueType type;
+  const char* name;
+  // format character of python's struct module for this type
+  char struct_format;
+  u32 size;
+};
+
+static constexpr std::array<ValueTypeInfo, 10> s_value_types = {{
+    {ValueType::U8, "u8", 'B', 1},
+    {ValueType::U16, "u16", 'H', 2},
+    {ValueType::U32, "u32", 'I', 4},
+    {ValueType::U64, "u64", 'Q', 8},
+    {ValueType::S8, "s8", 'b', 1},
+    {ValueType::S16, "s16", 'h', 2},
+    {ValueType::S32, "s32", 'i', 4},
+    {ValueType::S64, "s64", 'q', 8},
+    {ValueType::F32, "f32", 'f', 4},
+    {ValueType::F64, "f64", 'd', 8},
+}};
+
+static const ValueTypeInfo& GetValueTypeInfo(ValueType type)
+{
+  return s_value_types[static_cast<size_t>(type)];
+}
+
+static std::optional<ValueType> ParseValueType(const char* name)
+{
+  for (const ValueTypeInfo& info : s_value_types)
+  {
+    if (std::strcmp(info.name, name) == 0)
+      return info.type;
+  }
+  return std::nullopt;
+}
+
+struct ReadPlanEntry
+{
+  u32 addr;
+  ValueType type;
+  // offset of this value within the packed output buffer
+  u32 offset;
+};
+
+// A list of reads that was parsed and validated once and can be executed
+// many times. All values are read under a single CPU thread guard into a
+// packed, host-endian buffer whose layout is described by `format`.
+struct ReadPlan
+{
+  std::vector<ReadPlanEntry> entries;
+  std::string format = "=";
+  std::vector<u8> buffer;
+};
+
+// Compiles an iterable of (address, type name) tuples into a read plan.
+// Returns an empty optional with a python exception set on failure.
+static std::optional<ReadPlan> CompileReadPlan(PyObject* reads)
+{
+  Py::Object seq = Py::Wrap(PySequence_Fast(reads, "reads must be an iterable of (addr, type)"));
+  if (seq.IsNull())
+    return std::nullopt;
+  const Py_ssize_t num_reads = PySequence_Fast_GET_SIZE(seq.Lend());
+  PyObject** items = PySequence_Fast_ITEMS(seq.Lend());
+
+  ReadPlan plan;
+  plan.entries.reserve(num_reads);
+  u32 offset = 0;
+  for (Py_ssize_t i = 0; i < num_reads; i++)
+  {
+    u32 addr;
+    const char* type_name;
+    if (!PyArg_ParseTuple(items[i], "Is;reads must be an iterable of (addr, type)", &addr,
+                          &type_name))
+      return std::nullopt;
+    const std::optional<ValueType> type = ParseValueType(type_name);
+    if (!type.has_value())
+    {
+      PyErr_Format(PyExc_ValueError, "unknown value type '%s'", type_name);
+      return std::nullopt;
+    }
+    const ValueTypeInfo& info = GetValueTypeInfo(type.value());
+    plan.entries.push_back({addr, info.type, offset});
+    plan.format += info.struct_format;
+    offset += info.size;
+  }
+  plan.buffer.resize(offset);
+  return plan;
+}
+
+// Reads the raw bits of a value into `dest` in host byte order.
+// The signedness and float-ness only matter when unpacking,
+// so just read the raw bits of the respective size here.
+static void ReadRawValue(const Core::CPUThreadGuard& guard, ValueType type, u32 addr, u8* dest)
+{
+  switch (GetValueTypeInfo(type).size)
+  {
+  case 1:
+  {
+    const u8 value = API::Memory::Read_U8(guard, addr);
+    std::memcpy(dest, &value, sizeof(value));
+    break;
+  }
+  case 2:
+  {
+    const u16 value = API::Memory::Read_U16(guard, addr);
+    std::memcpy(dest, &value, sizeof(value));
+    break;
+  }
+  case 4:
+  {
+    const u32 value = API::Memory::Read_U32(guard, addr);
+    std::memcpy(dest, &value, sizeof(value));
+    break;
+  }
+  case 8:
+  {
+    const u64 value = API::Memory::Read_U64(guard, addr);
+    std::memcpy(dest, &value, sizeof(value));
+    break;
+  }
+  }
+}
+
+static void ExecuteReadPlan(const Core::CPUThreadGuard& guard, const ReadPlan& plan, u8* out)
+{
+  for (const ReadPlanEntry& entry : plan.entries)
+    ReadRawValue(guard, entry.type, entry.addr, out + entry.offset);
+}
+
+template <typename T>
+static T LoadPacked(const u8* src)
+{
+  T value;
+  std::memcpy(&value, src, sizeof(T));
+  return value;
+}
+
+static PyObject* UnpackToPyObject(ValueType type, const u8* src)
+{
+  switch (type)
+  {
+  case ValueType::U8:
+    return PyLong_FromUnsignedLong(LoadPacked<u8>(src));
+  case ValueType::U16:
+    return PyLong_FromUnsignedLong(LoadPacked<u16>(src));
+  case ValueType::U32:
+    return PyLong_FromUnsignedLong(LoadPacked<u32>(src));
+  case ValueType::U64:
+    return PyLong_FromUnsignedLongLong(LoadPacked<u64>(src));
+  case ValueType::S8:
+    return PyLong_FromLong(LoadPacked<s8>(src));
+  case ValueType::S16:
+    return PyLong_FromLong(LoadPacked<s16>(src));
+  case ValueType::S32:
+    return PyLong_FromLong(LoadPacked<s32>(src));
+  case ValueType::S64:
+    return PyLong_FromLongLong(LoadPacked<s64>(src));
+  case ValueType::F32:
+    return PyFloat_FromDouble(LoadPacked<float>(src));
+  case ValueType::F64:
+    return PyFloat_FromDouble(LoadPacked<double>(src));
+  }
+  Py_RETURN_NONE;
+}
+
+// Unpacks a value that was read by its raw bits, e.g. by an API::MemoryWatchList.
+static PyObject* UnpackRawToPyObject(ValueType type, u64 raw)
+{
+  u8 bytes[sizeof(u64)];
+  switch (GetValueTypeInfo(type).size)
+  {
+  case 1:
+    bytes[0] = static_cast<u8>(raw);
+    break;
+  case 2:
+  {
+    const u16 value = static_cast<u16>(raw);
+    std::memcpy(bytes, &value, sizeof(value));
+    break;
+  }
+  case 4:
+  {
+    const u32 value = static_cast<u32>(raw);
+    std::memcpy(bytes, &value, sizeof(value));
+    break;
+  }
+  case 8:
+    std::memcpy(bytes, &raw, sizeof(raw));
+    break;
+  }
+  return UnpackToPyObject(type, bytes);
+}
+
+static PyObject* UnpackToTuple(const ReadPlan& plan, const u8* packed)
+{
+  PyObject* tuple = PyTuple_New(plan.entries.size());
+  if (tuple == nullptr)
+    return nullptr;
+  for (size_t i = 0; i < plan.entries.size(); i++)
+  {
+    const ReadPlanEntry& entry = plan.entries[i];
+    PyObject* value = UnpackToPyObject(entry.type, packed + entry.offset);
+    if (value == nullptr)
+    {
+      Py_DECREF(tuple);
+      return nullptr;
+    }
+    PyTuple_SET_ITEM(tuple, i, value);
+  }
+  return tuple;
+}
+
+static PyObject* RunReadPlan(ReadPlan& plan)
+{
+  if (!CheckMemoryInitialized())
+    return nullptr;
+  {
+    Core::CPUThreadGuard guard(Core::System::GetInstance());
+    ExecuteReadPlan(guard, plan, plan.buffer.data());
+  }
+  // Python objects are only built after the guard was released,
+  // so the emulation is blocked for as short as possible.
+  return UnpackToTuple(plan, plan.buffer.data());
+}
+
+struct PyReadPlan
+{
+  PyObject_HEAD
+  ReadPlan* plan;
 };
 
+static PyObject* ReadPlanNew(PyTypeObject* type, PyObject* args, PyObject* kwargs)
+{
+  PyObject* reads;
+  static char* kwlist[] = {const_cast<char*>("reads"), nullptr};
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O", kwlist, &reads))
+    return nullptr;
+  std::optional<ReadPlan> plan = CompileReadPlan(reads);
+  if (!plan.has_value())
+    return nullptr;
+  PyReadPlan* self = reinterpret_cast<PyReadPlan*>(type->tp_alloc(type, 0));
+  if (self == nullptr)
+    return nullptr;
+  self->plan = new ReadPlan(std::move(plan.value()));
+  return reinterpret_cast<PyObject*>(self);
+}
+
+static void ReadPlanDealloc(PyObject* self)
+{
+  PyTypeObject* type = Py_TYPE(self);
+  delete reinterpret_cast<PyReadPlan*>(self)->plan;
+  type->tp_free(self);
+  // instances of heap types hold a reference to their type
+  Py_DECREF(type);
+}
+
+static Py_ssize_t ReadPlanLength(PyObject* self)
+{
+  return reinterpret_cast<PyReadPlan*>(self)->plan->entries.size();
+}
+
+static PyObject* ReadPlanGetFormat(PyObject* self, void*)
+{
+  return PyUnicode_FromString(reinterpret_cast<PyReadPlan*>(self)->plan->format.c_str());
+}
+
+static PyObject* ReadPlanGetSize(PyObject* self, void*)
+{
+  return PyLong_FromSize_t(reinterpret_cast<PyReadPlan*>(self)->plan->buffer.size());
+}
+
+static PyObject* ReadPlanRead(PyObject* self, PyObject*)
+{
+  return RunReadPlan(*reinterpret_cast<PyReadPlan*>(self)->plan);
+}
+
+static PyObject* ReadPlanReadInto(PyObject* self, PyObject* buffer_obj)
+{
+  const ReadPlan& plan = *reinterpret_cast<PyReadPlan*>(self)->plan;
+  if (!CheckMemoryInitialized())
+    return nullptr;
+  Py_buffer buffer;
+  if (PyObject_GetBuffer(buffer_obj, &buffer, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS) < 0)
+    return nullptr;
+  if (buffer.len < static_cast<Py_ssize_t>(plan.buffer.size()))
+  {
+    PyErr_Format(PyExc_ValueError, "buffer is too small: got %zd bytes, need %zu", buffer.len,
+                 plan.buffer.size());
+    PyBuffer_Release(&buffer);
+    return nullptr;
+  }
+  {
+    Core::CPUThreadGuard guard(Core::System::GetInstance());
+    ExecuteReadPlan(guard, plan, static_cast<u8*>(buffer.buf));
+  }
+  PyBuffer_Release(&buffer);
+  Py_RETURN_NONE;
+}
+
+static PyTypeObject* CreateReadPlanType(PyObject* module)
+{
+  static PyMethodDef methods[] = {
+      {"read", ReadPlanRead, METH_NOARGS, ""},
+      {"read_into", ReadPlanReadInto, METH_O, ""},
+      {nullptr, nullptr, 0, nullptr}  // Sentinel
+  };
+  static PyGetSetDef getset[] = {
+      {"format", ReadPlanGetFormat, nullptr, nullptr, nullptr},
+      {"size", ReadPlanGetSize, nullptr, nullptr, nullptr},
+      {nullptr, nullptr, nullptr, nullptr, nullptr}  // Sentinel
+  };
+  static PyType_Slot slots[] = {
+      {Py_tp_new, reinterpret_cast<void*>(ReadPlanNew)},
+      {Py_tp_dealloc, reinterpret_cast<void*>(ReadPlanDealloc)},
+      {Py_tp_methods, methods},
+      {Py_tp_getset, getset},
+      {Py_sq_length, reinterpret_cast<void*>(ReadPlanLength)},
+      {0, nullptr}  // Sentinel
+  };
+  static PyType_Spec spec = {
+      "dolphin_memory.ReadPlan",
+      sizeof(PyReadPlan),
+      0,
+      Py_TPFLAGS_DEFAULT,
+      slots,
+  };
+  return Py::AddTypeToModule(module, &spec);
+}
+
+static PyObject* ReadMany(PyObject* module, PyObject* reads)
+{
+  MemoryModuleState* state = Py::GetState<MemoryModuleState>(module);
+  if (PyObject_TypeCheck(reads, state->read_plan_type))
+    return RunReadPlan(*reinterpret_cast<PyReadPlan*>(reads)->plan);
+  std::optional<ReadPlan> plan = CompileReadPlan(reads);
+  if (!plan.has_value())
+    return nullptr;
+  return RunReadPlan(plan.value());
+}
+
 template <auto TRead>
 static PyObject* Read(PyObject* self, PyObject* args)
 {
@@ -41,7 +446,6 @@ static PyObject* Read(PyObject* self, PyObject* args)
   return result;
 }
 
-template <auto TReadBytes>
 static PyObject* ReadBytes(PyObject* self, PyObject* args)
 {
   // If Memory wasn't static, you'd get the memory instance from the state:
@@ -56,14 +460,87 @@ static PyObject* ReadBytes(PyObject* self, PyObject* args)
     return nullptr;
   u32 addr = std::get<0>(args_opt.value());
   u32 size = std::get<1>(args_opt.value());
+  // read straight into the bytearray's storage instead of going through a temporary copy
+  PyObject* result = PyByteArray_FromStringAndSize(nullptr, size);
+  if (result == nullptr)
+    return nullptr;
   Core::CPUThreadGuard guard(Core::System::GetInstance());
-  char* ptr = TReadBytes(guard, addr, size);
-  
-  PyObject* result = PyByteArray_FromStringAndSize(ptr, size);
-  delete ptr;
+  API::Memory::Read_Bytes(guard, addr, PyByteArray_AS_STRING(result), size);
   return result;
 }
 
+// Gets a contiguous buffer that holds a whole number of values of type T.
+// Buffers of bytes are accepted as well as buffers of matching item size,
+// e.g. bytearray, array.array("I") or numpy.uint32 arrays for 32-bit values.
+template <typename T>
+static bool GetArrayBuffer(PyObject* buffer_obj, Py_buffer* buffer, int flags)
+{
+  if (PyObject_GetBuffer(buffer_obj, buffer, flags | PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0)
+    return false;
+  if (buffer->itemsize != 1 && buffer->itemsize != sizeof(T))
+  {
+    PyErr_Format(PyExc_ValueError, "buffer item size must be 1 or %zu, but is %zd", sizeof(T),
+                 buffer->itemsize);
+    PyBuffer_Release(buffer);
+    return false;
+  }
+  if (buffer->len % sizeof(T) != 0)
+  {
+    PyErr_Format(PyExc_ValueError, "buffer size must be a multiple of %zu, but is %zd", sizeof(T),
+                 buffer->len);
+    PyBuffer_Release(buffer);
+    return false;
+  }
+  return true;
+}
+
+template <typename T>
+static PyObject* ReadArray(PyObject* self, PyObject* args)
+{
+  // If Memory wasn't static, you'd get the memory instance from the state:
+  // MemoryModuleState* state = Py::GetState<MemoryModuleState>();
+  if (!CheckMemoryInitialized())
+    return nullptr;
+  auto args_opt = Py::ParseTuple<u32, PyObject*>(args);
+  if (!args_opt.has_value())
+    return nullptr;
+  u32 addr = std::get<0>(args_opt.value());
+  PyObject* buffer_obj = std::get<1>(args_opt.value());
+  Py_buffer buffer;
+  if (!GetArrayBuffer<T>(buffer_obj, &buffer, PyBUF_WRITABLE))
+    return nullptr;
+  {
+    Core::CPUThreadGuard guard(Core::System::GetInstance());
+    API::Memory::Read_Array<T>(guard, addr, buffer.buf, static_cast<u32>(buffer.len / sizeof(T)));
+  }
+  PyBuffer_Release(&buffer);
+  Py_RETURN_NONE;
+}
+
+template <typename T>
+static PyObject* WriteArray(PyObject* self, PyObject* args)
+{
+  // If Memory wasn't static, you'd get the memory instance from the state:
+  // MemoryModuleState* state = Py::GetState<MemoryModuleState>();
+  if (!CheckMemoryInitialized())
+    return nullptr;
+  auto args_opt = Py::ParseTuple<u32, PyObject*>(args);
+  if (!args_opt.has_value())
+    return nullptr;
+  u32 addr = std::get<0>(args_opt.value());
+  PyObject* buffer_obj = std::get<1>(args_opt.value());
+  Py_buffer buffer;
+  if (!GetArrayBuffer<T>(buffer_obj, &buffer, PyBUF_SIMPLE))
+    return nullptr;
+  {
+    Core::CPUThreadGuard guard(Core::System::GetInstance());
+    API::Memory::Write_Array<T>(guard, addr, buffer.buf, static_cast<u32>(buffer.len / sizeof(T)));
+    s_write_generation++;
+  }
+  PyBuffer_Release(&buffer);
+  Py_RETURN_NONE;
+}
+
 template <auto TWrite, typename T>
 static PyObject* Write(PyObject* self, PyObject* args)
 {
@@ -81,6 +558,7 @@ static PyObject* Write(PyObject* self, PyObject* args)
   T value = std::get<1>(args_opt.value());
   Core::CPUThreadGuard guard(Core::System::GetInstance());
   TWrite(guard, addr, value);
+  s_write_generation++;
   Py_RETURN_NONE;
 }
 
@@ -102,6 +580,7 @@ static PyObject* WriteBytes(PyObject* self, PyObject* args)
 
   Core::CPUThreadGuard guard(Core::System::GetInstance());
   TWriteBytes(guard, addr, buff, num_bytes);
+  s_write_generation++;
   Py_RETURN_NONE;
 }
 
@@ -149,11 +628,1021 @@ static PyObject* IsMemoryAccessible(PyObject* self, PyObject* args)
   }
 }
 
+// A read-only, zero-copy view of a physical memory region, exposed via the buffer protocol.
+// It uses its own mapping of the region's backing memory, so buffers exported from it
+// stay valid even if the emulated system shuts down while the script still holds on to them.
+// The contents are only consistent while emulation is paused or from within CPU-thread callbacks.
+struct PyRamView
+{
+  PyObject_HEAD
+  u8* view;
+  u32 mapped_size;
+  u32 size;
+};
+
+static void RamViewDealloc(PyObject* self)
+{
+  PyTypeObject* type = Py_TYPE(self);
+  // Exported buffers hold a reference to this object,
+  // so once we get here nobody can access the view anymore.
+  PyRamView* ram_view = reinterpret_cast<PyRamView*>(self);
+  if (ram_view->view != nullptr)
+  {
+    Core::System::GetInstance().GetMemory().ReleasePhysicalRegionView(ram_view->view,
+                                                                      ram_view->mapped_size);
+  }
+  type->tp_free(self);
+  Py_DECREF(type);
+}
+
+static int RamViewGetBuffer(PyObject* self, Py_buffer* buffer, int flags)
+{
+  PyRamView* ram_view = reinterpret_cast<PyRamView*>(self);
+  return PyBuffer_FillInfo(buffer, self, ram_view->view, ram_view->size, 1, flags);
+}
+
+static Py_ssize_t RamViewLength(PyObject* self)
+{
+  return reinterpret_cast<PyRamView*>(self)->size;
+}
+
+static PyTypeObject* CreateRamViewType(PyObject* module)
+{
+  static PyType_Slot slots[] = {
+      {Py_tp_dealloc, reinterpret_cast<void*>(RamViewDealloc)},
+      {Py_bf_getbuffer, reinterpret_cast<void*>(RamViewGetBuffer)},
+      {Py_sq_length, reinterpret_cast<void*>(RamViewLength)},
+      {0, nullptr}  // Sentinel
+  };
+  static PyType_Spec spec = {
+      "dolphin_memory.RamView",
+      sizeof(PyRamView),
+      0,
+      // not constructible from python, use ram_view() instead
+      Py_TPFLAGS_DEFAULT | Py_TPFLAGS_DISALLOW_INSTANTIATION,
+      slots,
+  };
+  return Py::AddTypeToModule(module, &spec);
+}
+
+static PyObject* GetRamView(PyObject* module, PyObject* args)
+{
+  MemoryModuleState* state = Py::GetState<MemoryModuleState>(module);
+  auto args_opt = Py::ParseTuple<const char*>(args);
+  if (!args_opt.has_value())
+    return nullptr;
+  const std::string region = std::get<0>(args_opt.value());
+  if (!CheckMemoryInitialized())
+    return nullptr;
+
+  auto& memory = Core::System::GetInstance().GetMemory();
+  u32 physical_address;
+  u32 size;
+  if (region == "mem1")
+  {
+    physical_address = 0x00000000;
+    size = memory.GetRamSizeReal();
+  }
+  else if (region == "mem2")
+  {
+    if (memory.GetEXRAM() == nullptr)
+    {
+      PyErr_SetString(PyExc_ValueError, "mem2 is only available in Wii mode");
+      return nullptr;
+    }
+    physical_address = 0x10000000;
+    size = memory.GetExRamSizeReal();
+  }
+  else
+  {
+    PyErr_Format(PyExc_ValueError, "unknown memory region '%s', expected 'mem1' or 'mem2'",
+                 region.c_str());
+    return nullptr;
+  }
+
+  u32 mapped_size = 0;
+  u8* view;
+  {
+    Core::CPUThreadGuard guard(Core::System::GetInstance());
+    view = memory.CreatePhysicalRegionView(physical_address, &mapped_size);
+  }
+  if (view == nullptr)
+  {
+    PyErr_SetString(PyExc_MemoryError, "failed to map memory region");
+    return nullptr;
+  }
+  PyRamView* ram_view = PyObject_New(PyRamView, state->ram_view_type);
+  if (ram_view == nullptr)
+  {
+    memory.ReleasePhysicalRegionView(view, mapped_size);
+    return nullptr;
+  }
+  ram_view->view = view;
+  ram_view->mapped_size = mapped_size;
+  ram_view->size = size;
+  return reinterpret_cast<PyObject*>(ram_view);
+}
+
+// A chain of pointer dereferences like "[[0x80001234]+0x20]+0x14", parsed once.
+// Resolving starts at `base`, then for each offset reads a pointer and adds the offset to it.
+struct PointerPath
+{
+  u32 base = 0;
+  std::vector<s32> offsets;
+
+  // If caching is enabled, the resolved address is remembered until either the emulation
+  // advances or something gets written through this module.
+  bool cache = false;
+  bool cache_valid = false;
+  u64 cache_ticks = 0;
+  u64 cache_write_generation = 0;
+  std::optional<u32> cached_address;
+};
+
+class PointerPathParser
+{
+public:
+  explicit PointerPathParser(const char* str) : m_str(str), m_pos(str) {}
+
+  // Returns an empty optional with a python exception set on failure.
+  std::optional<PointerPath> Parse()
+  {
+    PointerPath path;
+    if (!ParseExpression(&path))
+      return std::nullopt;
+    SkipWhitespace();
+    if (*m_pos != '\0')
+      return Fail("unexpected trailing characters");
+    return path;
+  }
+
+private:
+  // expression := (number | "[" expression "]") (("+" | "-") number)*
+  bool ParseExpression(PointerPath* path)
+  {
+    SkipWhitespace();
+    if (*m_pos == '[')
+    {
+      m_pos++;
+      if (!ParseExpression(path))
+        return false;
+      SkipWhitespace();
+      if (*m_pos != ']')
+        return Fail("expected ']'").has_value();
+      m_pos++;
+      path->offsets.push_back(0);
+    }
+    else
+    {
+      std::optional<u32> number = ParseNumber();
+      if (!number.has_value())
+        return false;
+      path->base = number.value();
+    }
+
+    while (true)
+    {
+      SkipWhitespace();
+      if (*m_pos != '+' && *m_pos != '-')
+        return true;
+      const bool negative = *m_pos == '-';
+      m_pos++;
+      SkipWhitespace();
+      std::optional<u32> number = ParseNumber();
+      if (!number.has_value())
+        return false;
+      const u32 offset = negative ? 0u - number.value() : number.value();
+      if (path->offsets.empty())
+        path->base += offset;
+      else
+        path->offsets.back() += static_cast<s32>(offset);
+    }
+  }
+
+  std::optional<u32> ParseNumber()
+  {
+    char* end;
+    errno = 0;
+    const unsigned long long number = std::strtoull(m_pos, &end, 0);
+    if (end == m_pos)
+    {
+      Fail("expected a number");
+      return std::nullopt;
+    }
+    if (errno == ERANGE || number > std::numeric_limits<u32>::max())
+    {
+      Fail("number does not fit into 32 bits");
+      return std::nullopt;
+    }
+    m_pos = end;
+    return static_cast<u32>(number);
+  }
+
+  void SkipWhitespace()
+  {
+    while (std::isspace(static_cast<unsigned char>(*m_pos)))
+      m_pos++;
+  }
+
+  std::optional<PointerPath> Fail(const char* message)
+  {
+    PyErr_Format(PyExc_ValueError, "invalid pointer path '%s' at position %zd: %s", m_str,
+                 static_cast<Py_ssize_t>(m_pos - m_str), message);
+    return std::nullopt;
+  }
+
+  const char* m_str;
+  const char* m_pos;
+};
+
+// Walks the pointer path. Returns an empty optional if any hop, including the final address,
+// does not point to valid RAM for a read of `size` bytes.
+static std::optional<u32> ResolvePointerPath(const Core::CPUThreadGuard& guard, PointerPath& path,
+                                             u32 size)
+{
+  const u64 ticks = guard.GetSystem().GetCoreTiming().GetTicks();
+  const u64 write_generation = s_write_generation;
+  if (!path.cache || !path.cache_valid || path.cache_ticks != ticks ||
+      path.cache_write_generation != write_generation)
+  {
+    // Resolve the pointers only, the final access' size is checked below for every read.
+    const std::optional<u32> addr =
+        API::Memory::ResolvePointerChain(guard, path.base, path.offsets, 1);
+    if (!path.cache)
+      return addr.has_value() ? API::Memory::ResolvePointerChain(guard, *addr, {}, size) : addr;
+    path.cache_valid = true;
+    path.cache_ticks = ticks;
+    path.cache_write_generation = write_generation;
+    path.cached_address = addr;
+  }
+  if (!path.cached_address.has_value())
+    return std::nullopt;
+  return API::Memory::ResolvePointerChain(guard, path.cached_address.value(), {}, size);
+}
+
+struct PyPointerPath
+{
+  PyObject_HEAD
+  PointerPath* path;
+};
+
+static PyObject* PointerPathNew(PyTypeObject* type, PyObject* args, PyObject* kwargs)
+{
+  PyObject* path_obj;
+  PyObject* offsets_obj = nullptr;
+  int cache = 0;
+  static char* kwlist[] = {const_cast<char*>("path"), const_cast<char*>("offsets"),
+                           const_cast<char*>("cache"), nullptr};
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O$p", kwlist, &path_obj, &offsets_obj,
+                                   &cache))
+    return nullptr;
+
+  std::optional<PointerPath> path;
+  if (PyUnicode_Check(path_obj))
+  {
+    if (offsets_obj != nullptr)
+    {
+      PyErr_SetString(PyExc_TypeError, "offsets can only be given together with a base address");
+      return nullptr;
+    }
+    const char* path_str = PyUnicode_AsUTF8(path_obj);
+    if (path_str == nullptr)
+      return nullptr;
+    path = PointerPathParser(path_str).Parse();
+  }
+  else
+  {
+    path.emplace();
+    path->base = PyLong_AsUnsignedLongMask(path_obj);
+    if (PyErr_Occurred())
+      return nullptr;
+    if (offsets_obj != nullptr)
+    {
+      Py::Object seq = Py::Wrap(PySequence_Fast(offsets_obj, "offsets must be a sequence"));
+      if (seq.IsNull())
+        return nullptr;
+      const Py_ssize_t num_offsets = PySequence_Fast_GET_SIZE(seq.Lend());
+      for (Py_ssize_t i = 0; i < num_offsets; i++)
+      {
+        const long long offset = PyLong_AsLongLong(PySequence_Fast_GET_ITEM(seq.Lend(), i));
+        if (PyErr_Occurred())
+          return nullptr;
+        // Offsets wrap around like addresses, so both -0x10 and 0xFFFFFFF0 are accepted.
+        if (offset < std::numeric_limits<s32>::min() || offset > std::numeric_limits<u32>::max())
+        {
+          PyErr_Format(PyExc_ValueError, "offset %lld does not fit into 32 bits", offset);
+          return nullptr;
+        }
+        path->offsets.push_back(static_cast<s32>(static_cast<u32>(offset)));
+      }
+    }
+  }
+  if (!path.has_value())
+    return nullptr;
+  path->cache = cache != 0;
+
+  PyPointerPath* self = reinterpret_cast<PyPointerPath*>(type->tp_alloc(type, 0));
+  if (self == nullptr)
+    return nullptr;
+  self->path = new PointerPath(std::move(path.value()));
+  return reinterpret_cast<PyObject*>(self);
+}
+
+static void PointerPathDealloc(PyObject* self)
+{
+  PyTypeObject* type = Py_TYPE(self);
+  delete reinterpret_cast<PyPointerPath*>(self)->path;
+  type->tp_free(self);
+  Py_DECREF(type);
+}
+
+static PyObject* PointerPathRepr(PyObject* self)
+{
+  const PointerPath& path = *reinterpret_cast<PyPointerPath*>(self)->path;
+  std::string repr = fmt::format("{:#010x}", path.base);
+  for (const s32 offset : path.offsets)
+  {
+    repr = fmt::format("[{}]", repr);
+    if (offset != 0)
+      repr += fmt::format("{}{:#x}", offset < 0 ? '-' : '+', std::abs(s64{offset}));
+  }
+  return PyUnicode_FromFormat("PointerPath('%s')", repr.c_str());
+}
+
+static PyObject* PointerPathResolve(PyObject* self, PyObject*)
+{
+  PointerPath& path = *reinterpret_cast<PyPointerPath*>(self)->path;
+  if (!CheckMemoryInitialized())
+    return nullptr;
+  std::optional<u32> addr;
+  {
+    Core::CPUThreadGuard guard(Core::System::GetInstance());
+    addr = ResolvePointerPath(guard, path, 1);
+  }
+  if (!addr.has_value())
+    Py_RETURN_NONE;
+  return PyLong_FromUnsignedLong(addr.value());
+}
+
+static PyObject* PointerPathRead(PyObject* self, PyObject* args)
+{
+  PointerPath& path = *reinterpret_cast<PyPointerPath*>(self)->path;
+  auto args_opt = Py::ParseTuple<const char*>(args);
+  if (!args_opt.has_value())
+    return nullptr;
+  const char* type_name = std::get<0>(args_opt.value());
+  const std::optional<ValueType> type = ParseValueType(type_name);
+  if (!type.has_value())
+  {
+    PyErr_Format(PyExc_ValueError, "unknown value type '%s'", type_name);
+    return nullptr;
+  }
+  if (!CheckMemoryInitialized())
+    return nullptr;
+
+  u8 value[sizeof(u64)];
+  {
+    Core::CPUThreadGuard guard(Core::System::GetInstance());
+    const std::optional<u32> addr =
+        ResolvePointerPath(guard, path, GetValueTypeInfo(type.value()).size);
+    if (!addr.has_value())
+      Py_RETURN_NONE;
+    ReadRawValue(guard, type.value(), addr.value(), value);
+  }
+  return UnpackToPyObject(type.value(), value);
+}
+
+static PyObject* PointerPathInvalidate(PyObject* self, PyObject*)
+{
+  reinterpret_cast<PyPointerPath*>(self)->path->cache_valid = false;
+  Py_RETURN_NONE;
+}
+
+static PyTypeObject* CreatePointerPathType(PyObject* module)
+{
+  static PyMethodDef methods[] = {
+      {"resolve", PointerPathResolve, METH_NOARGS, ""},
+      {"read", PointerPathRead, METH_VARARGS, ""},
+      {"invalidate", PointerPathInvalidate, METH_NOARGS, ""},
+      {nullptr, nullptr, 0, nullptr}  // Sentinel
+  };
+  static PyType_Slot slots[] = {
+      {Py_tp_new, reinterpret_cast<void*>(PointerPathNew)},
+      {Py_tp_dealloc, reinterpret_cast<void*>(PointerPathDealloc)},
+      {Py_tp_repr, reinterpret_cast<void*>(PointerPathRepr)},
+      {Py_tp_methods, methods},
+      {0, nullptr}  // Sentinel
+  };
+  static PyType_Spec spec = {
+      "dolphin_memory.PointerPath",
+      sizeof(PyPointerPath),
+      0,
+      Py_TPFLAGS_DEFAULT,
+      slots,
+  };
+  return Py::AddTypeToModule(module, &spec);
+}
+
+// A set of watched memory locations, see memory.watch().
+struct MemoryWatch
+{
+  API::MemoryWatchList list;
+  std::vector<ValueType> types;
+  // Reused between polls to avoid reallocating every frame.
+  std::vector<size_t> changed;
+  Py::Object callback;
+};
+
+struct PyMemoryWatch
+{
+  PyObject_HEAD
+  MemoryWatch* watch;
+};
+
+static void PollMemoryWatch(const Core::CPUThreadGuard& guard, MemoryWatch& watch)
+{
+  watch.changed.clear();
+  watch.list.Poll(guard, &watch.changed);
+}
+
+// Builds a list of (index, value) tuples for the entries that changed during the last poll.
+static PyObject* BuildMemoryWatchChanges(const MemoryWatch& watch)
+{
+  PyObject* changes = PyList_New(watch.changed.size());
+  if (changes == nullptr)
+    return nullptr;
+  for (size_t i = 0; i < watch.changed.size(); i++)
+  {
+    const size_t index = watch.changed[i];
+    const std::optional<u64> raw = watch.list.GetValue(index);
+    PyObject* change;
+    if (raw.has_value())
+    {
+      Py::Object value = Py::Wrap(UnpackRawToPyObject(watch.types[index], raw.value()));
+      if (value.IsNull())
+      {
+        Py_DECREF(changes);
+        return nullptr;
+      }
+      change = Py_BuildValue("(nO)", static_cast<Py_ssize_t>(index), value.Lend());
+    }
+    else
+    {
+      change = Py_BuildValue("(nO)", static_cast<Py_ssize_t>(index), Py_None);
+    }
+    if (change == nullptr)
+    {
+      Py_DECREF(changes);
+      return nullptr;
+    }
+    PyList_SET_ITEM(changes, i, change);
+  }
+  return changes;
+}
+
+// Polls all watches with callbacks and invokes the callbacks of those that changed.
+// Runs on the emulation thread at the end of every frame, with the GIL held.
+static void DeliverMemoryWatchChanges(MemoryModuleState* state)
+{
+  if (!Core::System::GetInstance().GetMemory().IsInitialized())
+    return;
+  // callbacks may create or close watches, so iterate over a copy
+  const std::vector<Py::Object> watches = state->watches;
+  {
+    Core::CPUThreadGuard guard(Core::System::GetInstance());
+    for (const Py::Object& watch_obj : watches)
+      PollMemoryWatch(guard, *reinterpret_cast<PyMemoryWatch*>(watch_obj.Lend())->watch);
+  }
+  for (const Py::Object& watch_obj : watches)
+  {
+    const MemoryWatch& watch = *reinterpret_cast<PyMemoryWatch*>(watch_obj.Lend())->watch;
+    if (watch.changed.empty() || watch.callback.IsNull())
+      continue;
+    Py::Object changes = Py::Wrap(BuildMemoryWatchChanges(watch));
+    if (changes.IsNull())
+    {
+      PyErr_Print();
+      continue;
+    }
+    Py::Object result = Py::Wrap(
+        PyObject_CallFunctionObjArgs(watch.callback.Lend(), changes.Lend(), nullptr));
+    if (result.IsNull())
+      PyErr_Print();
+  }
+}
+
+static void StopMemoryWatches(MemoryModuleState* state)
+{
+  if (state->frame_listener.has_value())
+  {
+    state->event_dispatcher->UnlistenEvent(state->frame_listener.value());
+    state->frame_listener.reset();
+  }
+  for (const Py::Object& watch_obj : state->watches)
+    reinterpret_cast<PyMemoryWatch*>(watch_obj.Lend())->watch->callback = Py::Null();
+  state->watches.clear();
+}
+
+static PyObject* MemoryWatchPoll(PyObject* self, PyObject*)
+{
+  MemoryWatch& watch = *reinterpret_cast<PyMemoryWatch*>(self)->watch;
+  if (!CheckMemoryInitialized())
+    return nullptr;
+  {
+    Core::CPUThreadGuard guard(Core::System::GetInstance());
+    PollMemoryWatch(guard, watch);
+  }
+  return BuildMemoryWatchChanges(watch);
+}
+
+static PyObject* MemoryWatchClose(PyObject* self, PyObject*)
+{
+  MemoryWatch& watch = *reinterpret_cast<PyMemoryWatch*>(self)->watch;
+  watch.callback = Py::Null();
+  MemoryModuleState* state =
+      Py::GetState<MemoryModuleState>(PyType_GetModule(Py_TYPE(self)));
+  std::vector<Py::Object>& watches = state->watches;
+  for (auto it = watches.begin(); it != watches.end(); ++it)
+  {
+    if (it->Lend() == self)
+    {
+      watches.erase(it);
+      break;
+    }
+  }
+  if (watches.empty() && state->frame_listener.has_value())
+  {
+    state->event_dispatcher->UnlistenEvent(state->frame_listener.value());
+    state->frame_listener.reset();
+  }
+  Py_RETURN_NONE;
+}
+
+static Py_ssize_t MemoryWatchLength(PyObject* self)
+{
+  return static_cast<Py_ssize_t>(reinterpret_cast<PyMemoryWatch*>(self)->watch->list.Size());
+}
+
+static void MemoryWatchDealloc(PyObject* self)
+{
+  PyTypeObject* type = Py_TYPE(self);
+  delete reinterpret_cast<PyMemoryWatch*>(self)->watch;
+  type->tp_free(self);
+  Py_DECREF(type);
+}
+
+static PyTypeObject* CreateMemoryWatchType(PyObject* module)
+{
+  static PyMethodDef methods[] = {
+      {"poll", MemoryWatchPoll, METH_NOARGS, ""},
+      {"close", MemoryWatchClose, METH_NOARGS, ""},
+      {nullptr, nullptr, 0, nullptr}  // Sentinel
+  };
+  static PyType_Slot slots[] = {
+      {Py_tp_dealloc, reinterpret_cast<void*>(MemoryWatchDealloc)},
+      {Py_tp_methods, methods},
+      {Py_sq_length, reinterpret_cast<void*>(MemoryWatchLength)},
+      {0, nullptr}  // Sentinel
+  };
+  static PyType_Spec spec = {
+      "dolphin_memory.MemoryWatch",
+      sizeof(PyMemoryWatch),
+      0,
+      Py_TPFLAGS_DEFAULT | Py_TPFLAGS_DISALLOW_INSTANTIATION,
+      slots,
+  };
+  return Py::AddTypeToModule(module, &spec);
+}
+
+// Parses a watch entry's location, which is either an address or a PointerPath.
+static bool ParseWatchLocation(MemoryModuleState* state, PyObject* location,
+                               API::MemoryWatchList::Entry* entry)
+{
+  if (PyObject_TypeCheck(location, state->pointer_path_type))
+  {
+    const PointerPath& path = *reinterpret_cast<PyPointerPath*>(location)->path;
+    entry->base = path.base;
+    entry->offsets = path.offsets;
+    return true;
+  }
+  entry->base = PyLong_AsUnsignedLongMask(location);
+  return !PyErr_Occurred();
+}
+
+static PyObject* Watch(PyObject* module, PyObject* args)
+{
+  PyObject* entries;
+  PyObject* callback = Py_None;
+  if (!PyArg_ParseTuple(args, "O|O", &entries, &callback))
+    return nullptr;
+  if (callback != Py_None && !PyCallable_Check(callback))
+  {
+    PyErr_SetString(PyExc_TypeError, "watch callback must be callable");
+    return nullptr;
+  }
+  MemoryModuleState* state = Py::GetState<MemoryModuleState>(module);
+
+  Py::Object seq = Py::Wrap(PySequence_Fast(entries, "watch entries must be iterable"));
+  if (seq.IsNull())
+    return nullptr;
+  auto watch = std::make_unique<MemoryWatch>();
+  const Py_ssize_t num_entries = PySequence_Fast_GET_SIZE(seq.Lend());
+  for (Py_ssize_t i = 0; i < num_entries; i++)
+  {
+    PyObject* location;
+    const char* type_name;
+    if (!PyArg_ParseTuple(PySequence_Fast_GET_ITEM(seq.Lend(), i), "Os;watch entries must be "
+                          "(address or PointerPath, type) tuples", &location, &type_name))
+      return nullptr;
+    const std::optional<ValueType> type = ParseValueType(type_name);
+    if (!type.has_value())
+    {
+      PyErr_Format(PyExc_ValueError, "unknown value type '%s'", type_name);
+      return nullptr;
+    }
+    API::MemoryWatchList::Entry entry;
+    if (!ParseWatchLocation(state, location, &entry))
+      return nullptr;
+    entry.size = GetValueTypeInfo(type.value()).size;
+    watch->list.Add(std::move(entry));
+    watch->types.push_back(type.value());
+  }
+
+  PyMemoryWatch* self = PyObject_New(PyMemoryWatch, state->memory_watch_type);
+  if (self == nullptr)
+    return nullptr;
+  self->watch = watch.release();
+  Py::Object watch_obj = Py::Wrap(reinterpret_cast<PyObject*>(self));
+
+  if (callback != Py_None)
+  {
+    self->watch->callback = Py::Take(callback);
+    state->watches.push_back(watch_obj);
+    if (!state->frame_listener.has_value())
+    {
+      state->frame_listener = state->event_dispatcher->ListenEvent<API::Events::FrameAdvance>(
+          {}, [state](const API::Events::FrameAdvance&) { DeliverMemoryWatchChanges(state); });
+    }
+  }
+  return watch_obj.Leak();
+}
+
+// A cheat search over emulated RAM, see Cheats::CompactSearchSession.
+struct PyCheatSearch
+{
+  PyObject_HEAD
+  Cheats::CompactSearchSession* session;
+  ValueType type;
+};
+
+static_assert(static_cast<int>(ValueType::U8) == static_cast<int>(Cheats::DataType::U8) &&
+                  static_cast<int>(ValueType::S8) == static_cast<int>(Cheats::DataType::S8) &&
+                  static_cast<int>(ValueType::F64) == static_cast<int>(Cheats::DataType::F64),
+              "ValueType and Cheats::DataType must be in the same order");
+
+static std::optional<Cheats::CompareType> ParseCompareType(const char* op)
+{
+  static constexpr std::array<std::pair<const char*, Cheats::CompareType>, 6> compare_types = {{
+      {"==", Cheats::CompareType::Equal},
+      {"!=", Cheats::CompareType::NotEqual},
+      {"<", Cheats::CompareType::Less},
+      {"<=", Cheats::CompareType::LessOrEqual},
+      {">", Cheats::CompareType::Greater},
+      {">=", Cheats::CompareType::GreaterOrEqual},
+  }};
+  for (const auto& [name, compare_type] : compare_types)
+  {
+    if (std::strcmp(name, op) == 0)
+      return compare_type;
+  }
+  PyErr_Format(PyExc_ValueError, "unknown comparison '%s', expected one of ==, !=, <, <=, >, >=",
+               op);
+  return std::nullopt;
+}
+
+// Integers are truncated to the search's type, so e.g. a difference of -1 works for unsigned
+// types as well.
+template <typename T>
+static std::optional<Cheats::SearchValue> ToSearchValue(PyObject* obj)
+{
+  if constexpr (std::is_floating_point_v<T>)
+  {
+    const double value = PyFloat_AsDouble(obj);
+    if (value == -1.0 && PyErr_Occurred())
+      return std::nullopt;
+    return Cheats::SearchValue{static_cast<T>(value)};
+  }
+  else
+  {
+    const unsigned long long value = PyLong_AsUnsignedLongLongMask(obj);
+    if (value == static_cast<unsigned long long>(-1) && PyErr_Occurred())
+      return std::nullopt;
+    return Cheats::SearchValue{static_cast<T>(value)};
+  }
+}
+
+static std::optional<Cheats::SearchValue> ToSearchValue(ValueType type, PyObject* obj)
+{
+  switch (type)
+  {
+  case ValueType::U8:
+    return ToSearchValue<u8>(obj);
+  case ValueType::U16:
+    return ToSearchValue<u16>(obj);
+  case ValueType::U32:
+    return ToSearchValue<u32>(obj);
+  case ValueType::U64:
+    return ToSearchValue<u64>(obj);
+  case ValueType::S8:
+    return ToSearchValue<s8>(obj);
+  case ValueType::S16:
+    return ToSearchValue<s16>(obj);
+  case ValueType::S32:
+    return ToSearchValue<s32>(obj);
+  case ValueType::S64:
+    return ToSearchValue<s64>(obj);
+  case ValueType::F32:
+    return ToSearchValue<float>(obj);
+  case ValueType::F64:
+    return ToSearchValue<double>(obj);
+  }
+  return std::nullopt;
+}
+
+static PyObject* FromSearchValue(const Cheats::SearchValue& value)
+{
+  return std::visit(
+      [](auto v) -> PyObject* {
+        using T = decltype(v);
+        if constexpr (std::is_floating_point_v<T>)
+          return PyFloat_FromDouble(v);
+        else if constexpr (std::is_signed_v<T>)
+          return PyLong_FromLongLong(v);
+        else
+          return PyLong_FromUnsignedLongLong(v);
+      },
+      value.m_value);
+}
+
+static bool CheckSearchError(Cheats::SearchErrorCode error)
+{
+  switch (error)
+  {
+  case Cheats::SearchErrorCode::Success:
+    return true;
+  case Cheats::SearchErrorCode::NoEmulationActive:
+    PyErr_SetString(PyExc_RuntimeError, "no emulation is active");
+    return false;
+  case Cheats::SearchErrorCode::DisabledInHardcoreMode:
+    PyErr_SetString(PyExc_RuntimeError, "cheat searches are disabled in hardcore mode");
+    return false;
+  case Cheats::SearchErrorCode::VirtualAddressesCurrentlyNotAccessible:
+    PyErr_SetString(PyExc_RuntimeError, "virtual addresses are currently not accessible");
+    return false;
+  case Cheats::SearchErrorCode::InvalidParameters:
+  default:
+    PyErr_SetString(PyExc_ValueError,
+                    "invalid search: ranges must lie in MEM1 or MEM2, and comparing against "
+                    "the last values requires a previous search");
+    return false;
+  }
+}
+
+static PyObject* CheatSearchNew(PyTypeObject* type, PyObject* args, PyObject* kwargs)
+{
+  const char* type_name;
+  PyObject* ranges_obj = Py_None;
+  int aligned = 1;
+  static char* kwlist[] = {const_cast<char*>("type"), const_cast<char*>("ranges"),
+                           const_cast<char*>("aligned"), nullptr};
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s|O$p", kwlist, &type_name, &ranges_obj,
+                                   &aligned))
+    return nullptr;
+  const std::optional<ValueType> value_type = ParseValueType(type_name);
+  if (!value_type)
+  {
+    PyErr_Format(PyExc_ValueError, "unknown value type '%s'", type_name);
+    return nullptr;
+  }
+  if (!CheckMemoryInitialized())
+    return nullptr;
+
+  std::vector<Cheats::MemoryRange> ranges;
+  if (ranges_obj == Py_None)
+  {
+    Core::CPUThreadGuard guard(Core::System::GetInstance());
+    ranges = Cheats::CompactSearchSession::GetRAMRanges(guard);
+  }
+  else
+  {
+    Py::Object seq = Py::Wrap(PySequence_Fast(ranges_obj, "ranges must be a sequence"));
+    if (seq.IsNull())
+      return nullptr;
+    const Py_ssize_t num_ranges = PySequence_Fast_GET_SIZE(seq.Lend());
+    for (Py_ssize_t i = 0; i < num_ranges; i++)
+    {
+      PyObject* range = PySequence_Fast_GET_ITEM(seq.Lend(), i);
+      unsigned int start;
+      unsigned int length;
+      if (!PyTuple_Check(range) || !PyArg_ParseTuple(range, "II", &start, &length))
+      {
+        PyErr_SetString(PyExc_TypeError, "ranges must be (start, length) tuples");
+        return nullptr;
+      }
+      ranges.emplace_back(start, length);
+    }
+  }
+
+  PyObject* self = type->tp_alloc(type, 0);
+  if (self == nullptr)
+    return nullptr;
+  auto* search = reinterpret_cast<PyCheatSearch*>(self);
+  search->session = new Cheats::CompactSearchSession(
+      std::move(ranges), static_cast<Cheats::DataType>(*value_type), aligned != 0);
+  search->type = *value_type;
+  return self;
+}
+
+static PyObject* RunCheatSearch(PyObject* self, Cheats::FilterType filter_type,
+                                Cheats::CompareType compare_type, PyObject* value_obj)
+{
+  auto* search = reinterpret_cast<PyCheatSearch*>(self);
+  if (value_obj != nullptr)
+  {
+    const std::optional<Cheats::SearchValue> value = ToSearchValue(search->type, value_obj);
+    if (!value)
+      return nullptr;
+    search->session->SetValue(*value);
+  }
+  search->session->SetFilterType(filter_type);
+  search->session->SetCompareType(compare_type);
+
+  Cheats::SearchErrorCode error;
+  {
+    Core::CPUThreadGuard guard(Core::System::GetInstance());
+    error = search->session->RunSearch(guard);
+  }
+  if (!CheckSearchError(error))
+    return nullptr;
+  return PyLong_FromSize_t(search->session->GetResultCount());
+}
+
+static PyObject* CheatSearchSearch(PyObject* self, PyObject* args)
+{
+  const char* op;
+  PyObject* value_obj;
+  if (!PyArg_ParseTuple(args, "sO", &op, &value_obj))
+    return nullptr;
+  const std::optional<Cheats::CompareType> compare_type = ParseCompareType(op);
+  if (!compare_type)
+    return nullptr;
+  return RunCheatSearch(self, Cheats::FilterType::CompareAgainstSpecificValue, *compare_type,
+                        value_obj);
+}
+
+static PyObject* CheatSearchSearchLast(PyObject* self, PyObject* args)
+{
+  const char* op = "!=";
+  PyObject* delta_obj = nullptr;
+  if (!PyArg_ParseTuple(args, "|sO", &op, &delta_obj))
+    return nullptr;
+  const std::optional<Cheats::CompareType> compare_type = ParseCompareType(op);
+  if (!compare_type)
+    return nullptr;
+  Py::Object zero = Py::Wrap(PyLong_FromLong(0));
+  return RunCheatSearch(self, Cheats::FilterType::CompareAgainstLastValue, *compare_type,
+                        delta_obj != nullptr ? delta_obj : zero.Lend());
+}
+
+static PyObject* CheatSearchSnapshot(PyObject* self, PyObject*)
+{
+  return RunCheatSearch(self, Cheats::FilterType::DoNotFilter, Cheats::CompareType::Equal,
+                        nullptr);
+}
+
+static PyObject* CheatSearchReset(PyObject* self, PyObject*)
+{
+  reinterpret_cast<PyCheatSearch*>(self)->session->ResetResults();
+  Py_RETURN_NONE;
+}
+
+static PyObject* CheatSearchResults(PyObject* self, PyObject* args)
+{
+  Py_ssize_t start = 0;
+  PyObject* count_obj = Py_None;
+  if (!PyArg_ParseTuple(args, "|nO", &start, &count_obj))
+    return nullptr;
+  size_t max_count = std::numeric_limits<size_t>::max();
+  if (count_obj != Py_None)
+  {
+    const Py_ssize_t count = PyLong_AsSsize_t(count_obj);
+    if (count == -1 && PyErr_Occurred())
+      return nullptr;
+    max_count = static_cast<size_t>(std::max<Py_ssize_t>(count, 0));
+  }
+  if (start < 0)
+  {
+    PyErr_SetString(PyExc_ValueError, "start must not be negative");
+    return nullptr;
+  }
+
+  std::vector<u32> addresses;
+  std::vector<Cheats::SearchValue> values;
+  reinterpret_cast<PyCheatSearch*>(self)->session->GetResults(static_cast<size_t>(start),
+                                                               max_count, &addresses, &values);
+  Py::Object list = Py::Wrap(PyList_New(static_cast<Py_ssize_t>(addresses.size())));
+  if (list.IsNull())
+    return nullptr;
+  for (size_t i = 0; i < addresses.size(); i++)
+  {
+    PyObject* value = FromSearchValue(values[i]);
+    if (value == nullptr)
+      return nullptr;
+    PyObject* result = Py_BuildValue("(kN)", static_cast<unsigned long>(addresses[i]), value);
+    if (result == nullptr)
+      return nullptr;
+    PyList_SET_ITEM(list.Lend(), static_cast<Py_ssize_t>(i), result);
+  }
+  return list.Leak();
+}
+
+static Py_ssize_t CheatSearchLength(PyObject* self)
+{
+  return static_cast<Py_ssize_t>(
+      reinterpret_cast<PyCheatSearch*>(self)->session->GetResultCount());
+}
+
+static PyObject* CheatSearchGetType(PyObject* self, void*)
+{
+  return PyUnicode_FromString(GetValueTypeInfo(reinterpret_cast<PyCheatSearch*>(self)->type).name);
+}
+
+static PyObject* CheatSearchGetAligned(PyObject* self, void*)
+{
+  return PyBool_FromLong(reinterpret_cast<PyCheatSearch*>(self)->session->GetAligned());
+}
+
+static void CheatSearchDealloc(PyObject* self)
+{
+  PyTypeObject* type = Py_TYPE(self);
+  delete reinterpret_cast<PyCheatSearch*>(self)->session;
+  type->tp_free(self);
+  Py_DECREF(type);
+}
+
+static PyTypeObject* CreateCheatSearchType(PyObject* module)
+{
+  static PyMethodDef methods[] = {
+      {"search", CheatSearchSearch, METH_VARARGS, ""},
+      {"search_last", CheatSearchSearchLast, METH_VARARGS, ""},
+      {"snapshot", CheatSearchSnapshot, METH_NOARGS, ""},
+      {"reset", CheatSearchReset, METH_NOARGS, ""},
+      {"results", CheatSearchResults, METH_VARARGS, ""},
+      {nullptr, nullptr, 0, nullptr}  // Sentinel
+  };
+  static PyGetSetDef getset[] = {
+      {"type", CheatSearchGetType, nullptr, nullptr, nullptr},
+      {"aligned", CheatSearchGetAligned, nullptr, nullptr, nullptr},
+      {nullptr, nullptr, nullptr, nullptr, nullptr}  // Sentinel
+  };
+  static PyType_Slot slots[] = {
+      {Py_tp_new, reinterpret_cast<void*>(CheatSearchNew)},
+      {Py_tp_dealloc, reinterpret_cast<void*>(CheatSearchDealloc)},
+      {Py_tp_methods, methods},
+      {Py_tp_getset, getset},
+      {Py_sq_length, reinterpret_cast<void*>(CheatSearchLength)},
+      {0, nullptr}  // Sentinel
+  };
+  static PyType_Spec spec = {
+      "dolphin_memory.CheatSearch",
+      sizeof(PyCheatSearch),
+      0,
+      Py_TPFLAGS_DEFAULT,
+      slots,
+  };
+  return Py::AddTypeToModule(module, &spec);
+}
+
+static PyObject* Reset(PyObject* module)
+{
+  StopMemoryWatches(Py::GetState<MemoryModuleState>(module));
+  Py_RETURN_NONE;
+}
+
 static void SetupMemoryModule(PyObject* module, MemoryModuleState* state)
 {
   // If Memory wasn't static, you'd store the memory instance in the state:
   //API::Memory* memory = PyScripting::PyScriptingBackend::GetCurrent()->GetMemory();
   //state->memory = memory;
+  state->read_plan_type = CreateReadPlanType(module);
+  state->ram_view_type = CreateRamViewType(module);
+  state->pointer_path_type = CreatePointerPathType(module);
+  state->memory_watch_type = CreateMemoryWatchType(module);
+  state->cheat_search_type = CreateCheatSearchType(module);
+
+  state->event_dispatcher = PyScripting::PyScriptingBackend::GetCurrent()->GetEventDispatcher();
+  PyScripting::PyScriptingBackend::GetCurrent()->AddCleanupFunc(
+      [state] { StopMemoryWatches(state); });
 }
 
 PyMODINIT_FUNC PyInit_memory()
@@ -175,7 +1664,19 @@ PyMODINIT_FUNC PyInit_memory()
       {"read_f32", Read<API::Memory::Read_F32>, METH_VARARGS, ""},
       {"read_f64", Read<API::Memory::Read_F64>, METH_VARARGS, ""},
       
-      {"read_bytes", ReadBytes<API::Memory::Read_Bytes>, METH_VARARGS, ""},
+      {"read_bytes", ReadBytes, METH_VARARGS, ""},
+
+      {"read_u16_array", ReadArray<u16>, METH_VARARGS, ""},
+      {"read_u32_array", ReadArray<u32>, METH_VARARGS, ""},
+      {"read_u64_array", ReadArray<u64>, METH_VARARGS, ""},
+      {"read_s16_array", ReadArray<s16>, METH_VARARGS, ""},
+      {"read_s32_array", ReadArray<s32>, METH_VARARGS, ""},
+      {"read_s64_array", ReadArray<s64>, METH_VARARGS, ""},
+      {"read_f32_array", ReadArray<float>, METH_VARARGS, ""},
+      {"read_f64_array", ReadArray<double>, METH_VARARGS, ""},
+
+      {"read_many", ReadMany, METH_O, ""},
+      {"ram_view", GetRamView, METH_VARARGS, ""},
 
       {"invalidate_icache", Write<API::Memory::InvalidateICache, u32>, METH_VARARGS, ""},
       {"write_u8", Write<API::Memory::Write_U8, u8>, METH_VARARGS, ""},
@@ -193,8 +1694,20 @@ PyMODINIT_FUNC PyInit_memory()
 
       {"write_bytes", WriteBytes<API::Memory::Write_Bytes>, METH_VARARGS, ""},
 
+      {"write_u16_array", WriteArray<u16>, METH_VARARGS, ""},
+      {"write_u32_array", WriteArray<u32>, METH_VARARGS, ""},
+      {"write_u64_array", WriteArray<u64>, METH_VARARGS, ""},
+      {"write_s16_array", WriteArray<s16>, METH_VARARGS, ""},
+      {"write_s32_array", WriteArray<s32>, METH_VARARGS, ""},
+      {"write_s64_array", WriteArray<s64>, METH_VARARGS, ""},
+      {"write_f32_array", WriteArray<float>, METH_VARARGS, ""},
+      {"write_f64_array", WriteArray<double>, METH_VARARGS, ""},
+
       {"is_memory_accessible", IsMemoryAccessible, METH_NOARGS, ""},
 
+      {"watch", Watch, METH_VARARGS, ""},
+      Py::MakeMethodDef<Reset>("_dolphin_reset"),
+
       {nullptr, nullptr, 0, nullptr}  // Sentinel
   };
   static PyModuleDef module_def =
@@ -4,9 +4,12 @@
 
 #include "savestatemodule.h"
 
+#include <vector>
+
 #include "Common/Logging/Log.h"
 #include "Core/State.h"
 #include "Core/Core.h"
+#include "Core/HW/Memmap.h"
 #include "Core/System.h"
 #include "Scripting/Python/Utils/module.h"
 
@@ -17,6 +20,10 @@ struct SavestateModuleState
 {
   // If State wasn't static, you'd store an instance here:
   //API::SavestateManager* stateManager; // or however it would be called
+  PyTypeObject* savestate_buffer_type;
+  PyTypeObject* ram_snapshot_type;
+  // Reused by save_to_bytes, so repeated saves don't need to measure the savestate every time.
+  std::vector<u8> save_to_bytes_buffer;
 };
 
 static PyObject* SaveToSlot(PyObject* self, PyObject* args)
@@ -77,14 +84,13 @@ static PyObject* LoadFromFile(PyObject* self, PyObject* args)
   Py_RETURN_NONE;
 }
 
-static PyObject* SaveToBytes(PyObject* self, PyObject* args)
+static PyObject* SaveToBytes(PyObject* module, PyObject* args)
 {
-  // If State wasn't static, you'd get the state-manager instance from the module state:
-  //SavestateModuleState* state = Py::GetState<SavestateModuleState>();
-  std::vector<u8> buffer;
-  State::SaveToBuffer(Core::System::GetInstance(), buffer, false);
-  const u8* data = buffer.data();
-  PyObject* pybytes = PyBytes_FromStringAndSize(reinterpret_cast<const char*>(data), buffer.size());
+  SavestateModuleState* state = Py::GetState<SavestateModuleState>(module);
+  std::vector<u8>& buffer = state->save_to_bytes_buffer;
+  const size_t size = State::SaveToReusedBuffer(Core::System::GetInstance(), buffer, false);
+  PyObject* pybytes =
+      PyBytes_FromStringAndSize(reinterpret_cast<const char*>(buffer.data()), size);
   if (pybytes == nullptr)
   {
     ERROR_LOG_FMT(SCRIPTING, "Failed to turn buffer into python bytes object");
@@ -97,28 +103,241 @@ static PyObject* LoadFromBytes(PyObject* self, PyObject* args)
 {
   // If State wasn't static, you'd get the state-manager instance from the module state:
   //SavestateModuleState* state = Py::GetState<SavestateModuleState>();
-  auto bytes_opt = Py::ParseTuple<PyBytesObject*>(args);
-  if (!bytes_opt.has_value())
+  PyObject* buffer_obj;
+  if (!PyArg_ParseTuple(args, "O", &buffer_obj))
+    return nullptr;
+  // Accepts bytes as well as SavestateBuffer or any other buffer, and loads without copying.
+  Py_buffer buffer;
+  if (PyObject_GetBuffer(buffer_obj, &buffer, PyBUF_SIMPLE) < 0)
+    return nullptr;
+  State::LoadFromBuffer(Core::System::GetInstance(), static_cast<const u8*>(buffer.buf),
+                        static_cast<size_t>(buffer.len), false);
+  PyBuffer_Release(&buffer);
+  Py_RETURN_NONE;
+}
+
+// A copy of emulated RAM, for savestate buffers to store only the pages that differ from it.
+struct PyRamSnapshot
+{
+  PyObject_HEAD
+  Memory::RAMSnapshot* snapshot;
+};
+
+static PyObject* RamSnapshotNew(PyTypeObject* type, PyObject* args, PyObject* kwargs)
+{
+  static char* kwlist[] = {nullptr};
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, ":RamSnapshot", kwlist))
+    return nullptr;
+  if (!Core::System::GetInstance().GetMemory().IsInitialized())
+  {
+    PyErr_SetString(PyExc_ValueError, "memory is not initialized");
     return nullptr;
-  PyObject* pybytes = (PyObject*)std::get<0>(bytes_opt.value());
-  auto length = PyBytes_Size(pybytes);
+  }
+  PyRamSnapshot* self = reinterpret_cast<PyRamSnapshot*>(type->tp_alloc(type, 0));
+  if (self == nullptr)
+    return nullptr;
+  self->snapshot = new Memory::RAMSnapshot();
+  State::TakeRAMSnapshot(Core::System::GetInstance(), *self->snapshot);
+  return reinterpret_cast<PyObject*>(self);
+}
 
-  std::vector<u8> buffer(length, 0);
-  u8* data = buffer.data();
-  int result = PyBytes_AsStringAndSize(pybytes, reinterpret_cast<char**>(&data), &length);
-  if (result == -1)
+static void RamSnapshotDealloc(PyObject* self)
+{
+  PyTypeObject* type = Py_TYPE(self);
+  delete reinterpret_cast<PyRamSnapshot*>(self)->snapshot;
+  type->tp_free(self);
+  Py_DECREF(type);
+}
+
+static Py_ssize_t RamSnapshotLength(PyObject* self)
+{
+  const Memory::RAMSnapshot& snapshot = *reinterpret_cast<PyRamSnapshot*>(self)->snapshot;
+  return static_cast<Py_ssize_t>(snapshot.ram.size() + snapshot.exram.size());
+}
+
+static PyTypeObject* CreateRamSnapshotType(PyObject* module)
+{
+  static PyType_Slot slots[] = {
+      {Py_tp_new, reinterpret_cast<void*>(RamSnapshotNew)},
+      {Py_tp_dealloc, reinterpret_cast<void*>(RamSnapshotDealloc)},
+      {Py_sq_length, reinterpret_cast<void*>(RamSnapshotLength)},
+      {0, nullptr}  // Sentinel
+  };
+  static PyType_Spec spec = {
+      "dolphin_savestate.RamSnapshot",
+      sizeof(PyRamSnapshot),
+      0,
+      Py_TPFLAGS_DEFAULT,
+      slots,
+  };
+  return Py::AddTypeToModule(module, &spec);
+}
+
+// A savestate kept in native memory, whose buffer gets reused by every save.
+// Reusing the buffer avoids reallocating it, measuring the savestate's size on every save,
+// and copying the savestate into and out of python bytes objects.
+struct PySavestateBuffer
+{
+  PyObject_HEAD
+  std::vector<u8>* buffer;
+  // Size of the savestate currently in the buffer, 0 if nothing was saved yet.
+  size_t size;
+  // Number of exported buffers. Saving is refused while there are any,
+  // because the buffer may be reallocated.
+  Py_ssize_t exports;
+  // Optional RamSnapshot that this savestate's emulated RAM is stored relative to.
+  PyObject* delta_base;
+};
+
+static const Memory::RAMSnapshot* GetDeltaBase(const PySavestateBuffer* savestate)
+{
+  if (savestate->delta_base == nullptr)
+    return nullptr;
+  return reinterpret_cast<PyRamSnapshot*>(savestate->delta_base)->snapshot;
+}
+
+static PyObject* SavestateBufferNew(PyTypeObject* type, PyObject* args, PyObject* kwargs)
+{
+  Py_ssize_t size_hint = 0;
+  PyObject* delta_base = Py_None;
+  static char* kwlist[] = {const_cast<char*>("size_hint"), const_cast<char*>("base"), nullptr};
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|n$O", kwlist, &size_hint, &delta_base))
+    return nullptr;
+  SavestateModuleState* state = Py::GetState<SavestateModuleState>(PyType_GetModule(type));
+  if (delta_base != Py_None && !PyObject_TypeCheck(delta_base, state->ram_snapshot_type))
+  {
+    PyErr_SetString(PyExc_TypeError, "base must be a RamSnapshot or None");
+    return nullptr;
+  }
+  if (size_hint < 0)
+  {
+    PyErr_SetString(PyExc_ValueError, "size_hint must not be negative");
+    return nullptr;
+  }
+  PySavestateBuffer* self = reinterpret_cast<PySavestateBuffer*>(type->tp_alloc(type, 0));
+  if (self == nullptr)
     return nullptr;
-  // I don't understand where and why the buffer gets copied and why this is necessary...
-  buffer.assign(data, data+length);
-  State::LoadFromBuffer(Core::System::GetInstance(), buffer, false);
+  self->buffer = new std::vector<u8>(static_cast<size_t>(size_hint));
+  self->size = 0;
+  self->exports = 0;
+  self->delta_base = nullptr;
+  if (delta_base != Py_None)
+  {
+    Py_INCREF(delta_base);
+    self->delta_base = delta_base;
+  }
+  return reinterpret_cast<PyObject*>(self);
+}
+
+static void SavestateBufferDealloc(PyObject* self)
+{
+  PyTypeObject* type = Py_TYPE(self);
+  PySavestateBuffer* savestate = reinterpret_cast<PySavestateBuffer*>(self);
+  delete savestate->buffer;
+  Py_XDECREF(savestate->delta_base);
+  type->tp_free(self);
+  Py_DECREF(type);
+}
+
+static PyObject* SavestateBufferSave(PyObject* self, PyObject*)
+{
+  PySavestateBuffer* savestate = reinterpret_cast<PySavestateBuffer*>(self);
+  if (savestate->exports > 0)
+  {
+    PyErr_SetString(PyExc_BufferError, "cannot save while the savestate is exported as a buffer");
+    return nullptr;
+  }
+  savestate->size = State::SaveToReusedBuffer(Core::System::GetInstance(), *savestate->buffer,
+                                              false, GetDeltaBase(savestate));
   Py_RETURN_NONE;
 }
 
+static PyObject* SavestateBufferLoad(PyObject* self, PyObject*)
+{
+  PySavestateBuffer* savestate = reinterpret_cast<PySavestateBuffer*>(self);
+  if (savestate->size == 0)
+  {
+    PyErr_SetString(PyExc_ValueError, "cannot load a savestate buffer that was never saved to");
+    return nullptr;
+  }
+  State::LoadFromBuffer(Core::System::GetInstance(), savestate->buffer->data(), savestate->size,
+                        false, GetDeltaBase(savestate));
+  Py_RETURN_NONE;
+}
+
+static PyObject* SavestateBufferGetCapacity(PyObject* self, void*)
+{
+  return PyLong_FromSize_t(reinterpret_cast<PySavestateBuffer*>(self)->buffer->size());
+}
+
+static PyObject* SavestateBufferGetBase(PyObject* self, void*)
+{
+  PyObject* delta_base = reinterpret_cast<PySavestateBuffer*>(self)->delta_base;
+  if (delta_base == nullptr)
+    Py_RETURN_NONE;
+  Py_INCREF(delta_base);
+  return delta_base;
+}
+
+static Py_ssize_t SavestateBufferLength(PyObject* self)
+{
+  return static_cast<Py_ssize_t>(reinterpret_cast<PySavestateBuffer*>(self)->size);
+}
+
+static int SavestateBufferGetBuffer(PyObject* self, Py_buffer* buffer, int flags)
+{
+  PySavestateBuffer* savestate = reinterpret_cast<PySavestateBuffer*>(self);
+  if (PyBuffer_FillInfo(buffer, self, savestate->buffer->data(),
+                        static_cast<Py_ssize_t>(savestate->size), 1, flags) < 0)
+    return -1;
+  savestate->exports++;
+  return 0;
+}
+
+static void SavestateBufferReleaseBuffer(PyObject* self, Py_buffer*)
+{
+  reinterpret_cast<PySavestateBuffer*>(self)->exports--;
+}
+
+static PyTypeObject* CreateSavestateBufferType(PyObject* module)
+{
+  static PyMethodDef methods[] = {
+      {"save", SavestateBufferSave, METH_NOARGS, ""},
+      {"load", SavestateBufferLoad, METH_NOARGS, ""},
+      {nullptr, nullptr, 0, nullptr}  // Sentinel
+  };
+  static PyGetSetDef getset[] = {
+      {"capacity", SavestateBufferGetCapacity, nullptr, nullptr, nullptr},
+      {"base", SavestateBufferGetBase, nullptr, nullptr, nullptr},
+      {nullptr, nullptr, nullptr, nullptr, nullptr}  // Sentinel
+  };
+  static PyType_Slot slots[] = {
+      {Py_tp_new, reinterpret_cast<void*>(SavestateBufferNew)},
+      {Py_tp_dealloc, reinterpret_cast<void*>(SavestateBufferDealloc)},
+      {Py_tp_methods, methods},
+      {Py_tp_getset, getset},
+      {Py_sq_length, reinterpret_cast<void*>(SavestateBufferLength)},
+      {Py_bf_getbuffer, reinterpret_cast<void*>(SavestateBufferGetBuffer)},
+      {Py_bf_releasebuffer, reinterpret_cast<void*>(SavestateBufferReleaseBuffer)},
+      {0, nullptr}  // Sentinel
+  };
+  static PyType_Spec spec = {
+      "dolphin_savestate.SavestateBuffer",
+      sizeof(PySavestateBuffer),
+      0,
+      Py_TPFLAGS_DEFAULT,
+      slots,
+  };
+  return Py::AddTypeToModule(module, &spec);
+}
+
 static void SetupSavestateModule(PyObject* module, SavestateModuleState* state)
 {
   // If State wasn't static, you'd store a state manager instance in the module state:
   //API::StateManager* sm = PyScripting::PyScriptingBackend::GetCurrent()->GetStateManager();
   //state->stateManager = sm;
+  state->ram_snapshot_type = CreateRamSnapshotType(module);
+  state->savestate_buffer_type = CreateSavestateBufferType(module);
 }
 
 PyMODINIT_FUNC PyInit_savestate()
@@ -1,27 +1,38 @@
 #include "utilmodule.h"
 
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
 #include <nfd.h>
 
 #include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
 #include "Common/Config/Config.h"
+#include "Core/API/ScriptStats.h"
+#include "Core/Config/GraphicsSettings.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/ConfigManager.h"
 #include "Core/Host.h"
 #include "Core/System.h"
 #include "Scripting/Python/PyScriptingBackend.h"
+#include "Scripting/Python/PyWorker.h"
 #include "Scripting/Python/Utils/module.h"
 #include "Scripting/Python/Utils/as_py_func.h"
+#include "Scripting/Python/Utils/object_wrapper.h"
 #include "Scripting/ScriptList.h"
+#include "Scripting/ScriptingEngine.h"
 
 struct FileState
 {
-  // This is unused besides initializion of the module
+  PyTypeObject* worker_type;
+  PyScripting::PyScriptingBackend* backend;
+  // The workers started by this script, which are asked to stop when it ends.
+  std::vector<PyScripting::PyWorker*> workers;
 };
 
-static std::string scriptDir;
-
 static PyObject* get_game_id(PyObject* module, PyObject* args)
 {
   return Py_BuildValue("s", SConfig::GetInstance().GetGameID().c_str());
@@ -29,7 +40,7 @@ static PyObject* get_game_id(PyObject* module, PyObject* args)
 
 static PyObject* get_script_dir(PyObject* module, PyObject* args)
 {
-  return Py_BuildValue("s", scriptDir.c_str());
+  return Py_BuildValue("s", File::GetUserPath(D_SCRIPTS_IDX).c_str());
 }
 
 static PyObject* start_framedump(PyObject* module, PyObject* args)
@@ -177,7 +188,9 @@ static PyObject* cancel_script(PyObject* module, PyObject* args, PyObject* kwarg
   {
     // We queue the cancel so it doesn't happen before the script main() is over
     Core::QueueHostJob(
-        [filename](Core::System& system) { Scripts::g_scripts_to_stop.push_front(filename); });
+        [filename = std::string(filename)](Core::System& system) {
+          Scripts::g_scripts_to_stop.push_front(filename);
+        });
   }
 
   Py_RETURN_NONE;
@@ -195,8 +208,10 @@ static PyObject* activate_script(PyObject* module, PyObject* args, PyObject* kwa
   if (filename)
   {
     // We queue the cancel so it doesn't happen before the script main() is over
-     Core::QueueHostJob(
-        [filename](Core::System& system) { Scripts::g_scripts_to_start.push_front(filename); });
+    Core::QueueHostJob(
+        [filename = std::string(filename)](Core::System& system) {
+          Scripts::g_scripts_to_start.push_front(filename);
+        });
   }
 
   Py_RETURN_NONE;
@@ -216,14 +231,326 @@ static PyObject* get_script_id(PyObject* module, PyObject* args)
   return Py_BuildValue("i", (cur_instance->GetScriptId()));
 }
 
+static PyObject* get_script_stats(PyObject* module, PyObject* args)
+{
+  Py::Object result = Py::Wrap(PyDict_New());
+  if (result.IsNull())
+    return nullptr;
+  for (const auto& profile : API::GetScriptProfiler().GetProfiles())
+  {
+    Py::Object events = Py::Wrap(PyDict_New());
+    if (events.IsNull())
+      return nullptr;
+    for (const API::ScriptEventStats& stats : profile->GetStats())
+    {
+      Py::Object entry = Py::Wrap(Py_BuildValue(
+          "{s:K,s:d,s:d,s:d,s:K}", "callbacks", static_cast<unsigned long long>(stats.callbacks),
+          "total_time", DT_s(stats.total_time).count(), "p99_time", DT_s(stats.p99_time).count(),
+          "gil_wait_time", DT_s(stats.gil_wait_time).count(), "coroutine_resumes",
+          static_cast<unsigned long long>(stats.coroutine_resumes)));
+      if (entry.IsNull())
+        return nullptr;
+      Py::Object name = Py::Wrap(PyUnicode_FromStringAndSize(
+          stats.event_name.data(), static_cast<Py_ssize_t>(stats.event_name.size())));
+      if (name.IsNull() || PyDict_SetItem(events.Lend(), name.Lend(), entry.Lend()) < 0)
+        return nullptr;
+    }
+    if (PyDict_SetItemString(result.Lend(), profile->GetName().c_str(), events.Lend()) < 0)
+      return nullptr;
+  }
+  return result.Leak();
+}
+
+static PyObject* reset_script_stats(PyObject* module, PyObject* args)
+{
+  API::GetScriptProfiler().ResetAll();
+  Py_RETURN_NONE;
+}
+
+static PyObject* show_script_stats(PyObject* module, PyObject* args)
+{
+  int show;
+  if (!PyArg_ParseTuple(args, "p", &show))
+    return nullptr;
+  Config::SetBaseOrCurrent(Config::GFX_SHOW_SCRIPT_STATS, static_cast<bool>(show));
+  Py_RETURN_NONE;
+}
+
+static std::optional<std::string> PickleMessage(PyObject* obj)
+{
+  Py::Object pickle = Py::Wrap(PyImport_ImportModule("pickle"));
+  if (pickle.IsNull())
+    return std::nullopt;
+  Py::Object dumps = Py::Wrap(PyObject_GetAttrString(pickle.Lend(), "dumps"));
+  if (dumps.IsNull())
+    return std::nullopt;
+  Py::Object bytes = Py::Wrap(PyObject_CallFunctionObjArgs(dumps.Lend(), obj, nullptr));
+  if (bytes.IsNull())
+    return std::nullopt;
+  char* data;
+  Py_ssize_t size;
+  if (PyBytes_AsStringAndSize(bytes.Lend(), &data, &size) < 0)
+    return std::nullopt;
+  return std::string(data, static_cast<size_t>(size));
+}
+
+static PyObject* UnpickleMessage(const std::string& message)
+{
+  Py::Object pickle = Py::Wrap(PyImport_ImportModule("pickle"));
+  if (pickle.IsNull())
+    return nullptr;
+  Py::Object loads = Py::Wrap(PyObject_GetAttrString(pickle.Lend(), "loads"));
+  if (loads.IsNull())
+    return nullptr;
+  Py::Object bytes = Py::Wrap(
+      PyBytes_FromStringAndSize(message.data(), static_cast<Py_ssize_t>(message.size())));
+  if (bytes.IsNull())
+    return nullptr;
+  return PyObject_CallFunctionObjArgs(loads.Lend(), bytes.Lend(), nullptr);
+}
+
+// Parses an optional timeout in seconds, where None means waiting indefinitely.
+static bool ParseTimeout(PyObject* timeout_obj, std::optional<DT>* timeout)
+{
+  if (timeout_obj == Py_None)
+  {
+    timeout->reset();
+    return true;
+  }
+  const double seconds = PyFloat_AsDouble(timeout_obj);
+  if (seconds == -1.0 && PyErr_Occurred())
+    return false;
+  if (seconds < 0)
+  {
+    PyErr_SetString(PyExc_ValueError, "timeout must not be negative");
+    return false;
+  }
+  *timeout = std::chrono::duration_cast<DT>(DT_s(seconds));
+  return true;
+}
+
+// The parent script's handle to a worker.
+struct PyWorkerObject
+{
+  PyObject_HEAD
+  PyScripting::PyWorker* worker;
+};
+
+static PyObject* WorkerNew(PyTypeObject* type, PyObject* args, PyObject* kwargs)
+{
+  const char* filename;
+  static char* kwlist[] = {const_cast<char*>("filename"), nullptr};
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s", kwlist, &filename))
+    return nullptr;
+  if (Scripting::ScriptingBackend::PythonSubinterpretersDisabled())
+  {
+    PyErr_SetString(PyExc_RuntimeError, "workers require python subinterpreters to be enabled");
+    return nullptr;
+  }
+  PyScripting::PyScriptingBackend* backend = PyScripting::PyScriptingBackend::GetCurrent();
+  // Relative paths are relative to the starting script, so workers can be shipped next to it.
+  std::filesystem::path script_path(filename);
+  if (script_path.is_relative())
+    script_path = std::filesystem::path(backend->GetScriptPath()).parent_path() / script_path;
+  if (!std::filesystem::is_regular_file(script_path))
+  {
+    PyErr_Format(PyExc_FileNotFoundError, "worker script not found: %s",
+                 script_path.string().c_str());
+    return nullptr;
+  }
+
+  PyWorkerObject* self = reinterpret_cast<PyWorkerObject*>(type->tp_alloc(type, 0));
+  if (self == nullptr)
+    return nullptr;
+  self->worker = backend->StartWorker(script_path);
+  FileState* state = Py::GetState<FileState>(PyType_GetModule(type));
+  state->workers.push_back(self->worker);
+  return reinterpret_cast<PyObject*>(self);
+}
+
+static void WorkerDealloc(PyObject* self)
+{
+  PyTypeObject* type = Py_TYPE(self);
+  PyScripting::PyWorker* worker = reinterpret_cast<PyWorkerObject*>(self)->worker;
+  if (worker != nullptr)
+  {
+    FileState* state = Py::GetState<FileState>(PyType_GetModule(type));
+    std::erase(state->workers, worker);
+    state->backend->ReleaseWorker(worker);
+  }
+  type->tp_free(self);
+  Py_DECREF(type);
+}
+
+static PyObject* WorkerSend(PyObject* self, PyObject* obj)
+{
+  std::optional<std::string> message = PickleMessage(obj);
+  if (!message.has_value())
+    return nullptr;
+  reinterpret_cast<PyWorkerObject*>(self)->worker->Send(std::move(*message));
+  Py_RETURN_NONE;
+}
+
+static PyObject* WorkerPoll(PyObject* self, PyObject*)
+{
+  PyScripting::PyWorker* worker = reinterpret_cast<PyWorkerObject*>(self)->worker;
+  Py::Object messages = Py::Wrap(PyList_New(0));
+  if (messages.IsNull())
+    return nullptr;
+  while (std::optional<std::string> message = worker->Receive())
+  {
+    Py::Object obj = Py::Wrap(UnpickleMessage(*message));
+    if (obj.IsNull() || PyList_Append(messages.Lend(), obj.Lend()) < 0)
+      return nullptr;
+  }
+  return messages.Leak();
+}
+
+static PyObject* WorkerStop(PyObject* self, PyObject*)
+{
+  reinterpret_cast<PyWorkerObject*>(self)->worker->RequestStop();
+  Py_RETURN_NONE;
+}
+
+static PyObject* WorkerJoin(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+  PyObject* timeout_obj = Py_None;
+  static char* kwlist[] = {const_cast<char*>("timeout"), nullptr};
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O", kwlist, &timeout_obj))
+    return nullptr;
+  std::optional<DT> timeout;
+  if (!ParseTimeout(timeout_obj, &timeout))
+    return nullptr;
+  PyScripting::PyWorker* worker = reinterpret_cast<PyWorkerObject*>(self)->worker;
+  bool finished;
+  Py_BEGIN_ALLOW_THREADS
+  finished = worker->WaitUntilFinished(timeout);
+  Py_END_ALLOW_THREADS
+  return PyBool_FromLong(finished);
+}
+
+static PyObject* WorkerGetFinished(PyObject* self, void*)
+{
+  return PyBool_FromLong(reinterpret_cast<PyWorkerObject*>(self)->worker->IsFinished());
+}
+
+static PyObject* WorkerGetFilename(PyObject* self, void*)
+{
+  const std::string& path = reinterpret_cast<PyWorkerObject*>(self)->worker->GetScriptPath();
+  return PyUnicode_FromStringAndSize(path.data(), static_cast<Py_ssize_t>(path.size()));
+}
+
+static PyTypeObject* CreateWorkerType(PyObject* module)
+{
+  static PyMethodDef methods[] = {
+      {"send", WorkerSend, METH_O, ""},
+      {"poll", WorkerPoll, METH_NOARGS, ""},
+      {"stop", WorkerStop, METH_NOARGS, ""},
+      {"join", (PyCFunction) WorkerJoin, METH_VARARGS | METH_KEYWORDS, ""},
+      {nullptr, nullptr, 0, nullptr}  // Sentinel
+  };
+  static PyGetSetDef getset[] = {
+      {"finished", WorkerGetFinished, nullptr, nullptr, nullptr},
+      {"filename", WorkerGetFilename, nullptr, nullptr, nullptr},
+      {nullptr, nullptr, nullptr, nullptr, nullptr}  // Sentinel
+  };
+  static PyType_Slot slots[] = {
+      {Py_tp_new, reinterpret_cast<void*>(WorkerNew)},
+      {Py_tp_dealloc, reinterpret_cast<void*>(WorkerDealloc)},
+      {Py_tp_methods, methods},
+      {Py_tp_getset, getset},
+      {0, nullptr}  // Sentinel
+  };
+  static PyType_Spec spec = {
+      "dolphin_utils.Worker",
+      sizeof(PyWorkerObject),
+      0,
+      Py_TPFLAGS_DEFAULT,
+      slots,
+  };
+  return Py::AddTypeToModule(module, &spec);
+}
+
+static PyScripting::WorkerChannel* GetWorkerChannel()
+{
+  PyScripting::WorkerChannel* channel =
+      PyScripting::PyScriptingBackend::GetCurrent()->GetWorkerChannel();
+  if (channel == nullptr)
+    PyErr_SetString(PyExc_RuntimeError, "this script is not running as a worker");
+  return channel;
+}
+
+static PyObject* worker_send(PyObject* module, PyObject* obj)
+{
+  PyScripting::WorkerChannel* channel = GetWorkerChannel();
+  if (channel == nullptr)
+    return nullptr;
+  std::optional<std::string> message = PickleMessage(obj);
+  if (!message.has_value())
+    return nullptr;
+  channel->from_worker.Push(std::move(*message));
+  Py_RETURN_NONE;
+}
+
+static PyObject* worker_receive(PyObject* module, PyObject* args, PyObject* kwargs)
+{
+  PyObject* timeout_obj = Py_None;
+  static char* kwlist[] = {const_cast<char*>("timeout"), nullptr};
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O", kwlist, &timeout_obj))
+    return nullptr;
+  std::optional<DT> timeout;
+  if (!ParseTimeout(timeout_obj, &timeout))
+    return nullptr;
+  PyScripting::WorkerChannel* channel = GetWorkerChannel();
+  if (channel == nullptr)
+    return nullptr;
+
+  const TimePoint deadline = timeout.has_value() ? Clock::now() + *timeout : TimePoint::max();
+  std::string message;
+  // Messages sent before the stop request are still delivered.
+  while (!channel->to_worker.Pop(message))
+  {
+    if (channel->stop_requested)
+    {
+      PyErr_SetString(PyExc_EOFError, "the worker was asked to stop");
+      return nullptr;
+    }
+    const TimePoint now = Clock::now();
+    if (now >= deadline)
+    {
+      PyErr_SetString(PyExc_TimeoutError, "no message was received in time");
+      return nullptr;
+    }
+    Py_BEGIN_ALLOW_THREADS
+    if (timeout.has_value())
+      channel->to_worker_event.WaitFor(deadline - now);
+    else
+      channel->to_worker_event.Wait();
+    Py_END_ALLOW_THREADS
+  }
+  return UnpickleMessage(message);
+}
+
+static PyObject* worker_stop_requested(PyObject* module, PyObject* args)
+{
+  PyScripting::WorkerChannel* channel = GetWorkerChannel();
+  if (channel == nullptr)
+    return nullptr;
+  return PyBool_FromLong(channel->stop_requested);
+}
+
 static void setup_file_module(PyObject* module, FileState* state)
 {
-  // I don't think we need anything here yet
+  state->backend = PyScripting::PyScriptingBackend::GetCurrent();
+  state->worker_type = CreateWorkerType(module);
+  state->backend->AddCleanupFunc([state] {
+    for (PyScripting::PyWorker* worker : state->workers)
+      worker->RequestStop();
+  });
 }
 
 PyMODINIT_FUNC PyInit_dol_utils()
 {
-  scriptDir = File::GetUserPath(D_SCRIPTS_IDX);
   static PyMethodDef methods[] = {{"get_game_id", get_game_id, METH_NOARGS, ""},
                                   {"get_script_dir", get_script_dir, METH_NOARGS, ""},
                                   {"open_file", open_file, METH_NOARGS, ""},
@@ -242,6 +569,12 @@ PyMODINIT_FUNC PyInit_dol_utils()
                                   {"activate_script", (PyCFunction) activate_script, METH_VARARGS | METH_KEYWORDS, ""},
                                   {"get_script_name", get_script_name, METH_NOARGS, ""},
                                   {"get_script_id", get_script_id, METH_NOARGS, ""},
+                                  {"get_script_stats", get_script_stats, METH_NOARGS, ""},
+                                  {"reset_script_stats", reset_script_stats, METH_NOARGS, ""},
+                                  {"show_script_stats", show_script_stats, METH_VARARGS, ""},
+                                  {"worker_send", worker_send, METH_O, ""},
+                                  {"worker_receive", (PyCFunction) worker_receive, METH_VARARGS | METH_KEYWORDS, ""},
+                                  {"worker_stop_requested", worker_stop_requested, METH_NOARGS, ""},
                                   {nullptr, nullptr, 0, nullptr}};
   static PyModuleDef module_def =
       Py::MakeStatefulModuleDef<FileState, setup_file_module>("dolphin_utils", methods);
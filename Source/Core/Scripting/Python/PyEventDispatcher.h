@@ -0,0 +1,250 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Dispatches events emitted by an API::EventHub to the python code of one interpreter.
+// Modules register their python listeners here instead of on the event hub directly.
+// For every emitted event, the dispatcher first asks all of the interpreter's listeners
+// whether they have python work to do (without holding the GIL),
+// and then enters the interpreter once to run all of that work back to back.
+// The time spent doing so is recorded in the interpreter's API::ScriptProfile.
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <Python.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/SmallVector.h"
+#include "Core/API/Events.h"
+#include "Core/API/ScriptStats.h"
+#include "Scripting/Python/Utils/thread_state.h"
+
+namespace PyScripting
+{
+
+// Called without holding the GIL. Returns whether the listener needs to run python code
+// for the event. May do native work, e.g. counting frames or comparing memory.
+template <typename T>
+using NeedsPythonFunc = std::function<bool(const T&)>;
+// Called with the GIL held.
+template <typename T>
+using PythonListener = std::function<void(const T&)>;
+
+template <typename... Ts>
+class GenericPyEventDispatcher final
+{
+public:
+  GenericPyEventDispatcher(API::GenericEventHub<Ts...>& event_hub,
+                           std::shared_ptr<Py::InterpreterThreadStates> threadstates,
+                           std::shared_ptr<API::ScriptProfile> profile)
+      : m_event_hub(event_hub), m_threadstates(std::move(threadstates)),
+        m_profile(std::move(profile))
+  {
+  }
+
+  // The names of the dispatched events, in the order the profile expects them.
+  static std::vector<std::string_view> GetEventNames() { return {Ts::NAME...}; }
+
+  GenericPyEventDispatcher(const GenericPyEventDispatcher&) = delete;
+  GenericPyEventDispatcher& operator=(const GenericPyEventDispatcher&) = delete;
+
+  ~GenericPyEventDispatcher() { UnlistenAll(); }
+
+  // needs_python may be empty if the listener always needs to run python code.
+  template <typename T>
+  API::ListenerID<T> ListenEvent(NeedsPythonFunc<T> needs_python, PythonListener<T> listener)
+  {
+    Listeners<T>& listeners = GetListeners<T>();
+    std::lock_guard lock{listeners.mutex};
+    auto id = API::ListenerID<T>{listeners.next_id++};
+    auto entries = std::make_shared<std::vector<Entry<T>>>(*listeners.entries);
+    entries->push_back({id, std::move(needs_python), std::move(listener)});
+    listeners.entries = std::move(entries);
+    // The interpreter only listens on the event hub while it has listeners for that event.
+    if (!listeners.hub_listener.has_value())
+    {
+      listeners.hub_listener =
+          m_event_hub.template ListenEvent<T>([this](const T& event) { Dispatch(event); });
+    }
+    return id;
+  }
+
+  template <typename T>
+  bool UnlistenEvent(API::ListenerID<T> listener_id)
+  {
+    Listeners<T>& listeners = GetListeners<T>();
+    std::lock_guard lock{listeners.mutex};
+    auto entries = std::make_shared<std::vector<Entry<T>>>(*listeners.entries);
+    const auto it = std::find_if(entries->begin(), entries->end(), [&](const Entry<T>& entry) {
+      return entry.id.value == listener_id.value;
+    });
+    if (it == entries->end())
+      return false;
+    entries->erase(it);
+    listeners.entries = std::move(entries);
+    if (listeners.entries->empty() && listeners.hub_listener.has_value())
+    {
+      m_event_hub.template UnlistenEvent<T>(listeners.hub_listener.value());
+      listeners.hub_listener.reset();
+    }
+    return true;
+  }
+
+  // Called with the GIL held from within a listener for T.
+  template <typename T>
+  void CountCoroutineResumes(u64 count)
+  {
+    if (count != 0)
+      m_profile->RecordCoroutineResumes(EventIndex<T>(), count);
+  }
+
+  const std::shared_ptr<API::ScriptProfile>& GetProfile() const { return m_profile; }
+
+  // Whether the interpreter listens to any event. May be called from any thread.
+  bool HasListeners()
+  {
+    return std::apply([&](auto&... listeners) { return (HasHubListener(listeners) || ...); },
+                      m_listeners);
+  }
+
+  // Stops listening on the event hub. Emissions that are already in progress may still run
+  // until the event hub's listeners have been ticked.
+  void UnlistenAll()
+  {
+    std::apply([&](auto&... listeners) { (UnlistenHub(listeners), ...); }, m_listeners);
+  }
+
+private:
+  template <typename T>
+  struct Entry
+  {
+    API::ListenerID<T> id;
+    NeedsPythonFunc<T> needs_python;
+    PythonListener<T> listener;
+  };
+
+  template <typename T>
+  struct Listeners
+  {
+    std::mutex mutex;
+    // Immutable once published, replaced as a whole when listeners change.
+    std::shared_ptr<const std::vector<Entry<T>>> entries =
+        std::make_shared<std::vector<Entry<T>>>();
+    std::optional<API::ListenerID<T>> hub_listener;
+    u64 next_id = 0;
+  };
+
+  // More listeners than this on a single event of a single interpreter
+  // just take the GIL an additional time.
+  static constexpr size_t MAX_PENDING = 16;
+
+  template <typename T>
+  void Dispatch(const T& event)
+  {
+    std::shared_ptr<const std::vector<Entry<T>>> entries;
+    {
+      Listeners<T>& listeners = GetListeners<T>();
+      std::lock_guard lock{listeners.mutex};
+      entries = listeners.entries;
+    }
+
+    Common::SmallVector<const PythonListener<T>*, MAX_PENDING> pending;
+    for (const Entry<T>& entry : *entries)
+    {
+      if (entry.needs_python && !entry.needs_python(event))
+        continue;
+      if (pending.size() == MAX_PENDING)
+        RunPending(pending, event);
+      pending.push_back(&entry.listener);
+    }
+    RunPending(pending, event);
+  }
+
+  template <typename T>
+  void RunPending(Common::SmallVector<const PythonListener<T>*, MAX_PENDING>& pending,
+                  const T& event)
+  {
+    if (pending.empty())
+      return;
+    const TimePoint wait_start = Clock::now();
+    DT gil_wait_time;
+    Common::SmallVector<DT, MAX_PENDING> times;
+    {
+      Py::EnterInterpreter enter{*m_threadstates};
+      TimePoint start = Clock::now();
+      gil_wait_time = start - wait_start;
+      for (const PythonListener<T>* listener : pending)
+      {
+        (*listener)(event);
+        const TimePoint end = Clock::now();
+        times.push_back(end - start);
+        start = end;
+      }
+    }
+    m_profile->RecordCallbacks(EventIndex<T>(), gil_wait_time,
+                               std::span<const DT>(times.data(), times.size()));
+    pending.clear();
+  }
+
+  template <typename T>
+  void UnlistenHub(Listeners<T>& listeners)
+  {
+    std::lock_guard lock{listeners.mutex};
+    if (listeners.hub_listener.has_value())
+    {
+      m_event_hub.template UnlistenEvent<T>(listeners.hub_listener.value());
+      listeners.hub_listener.reset();
+    }
+  }
+
+  template <typename T>
+  static bool HasHubListener(Listeners<T>& listeners)
+  {
+    std::lock_guard lock{listeners.mutex};
+    return listeners.hub_listener.has_value();
+  }
+
+  template <typename T>
+  static constexpr size_t EventIndex()
+  {
+    // Counts the events before T, stopping at T.
+    size_t index = 0;
+    static_cast<void>(((std::is_same_v<T, Ts> || (++index, false)) || ...));
+    return index;
+  }
+
+  template <typename T>
+  Listeners<T>& GetListeners()
+  {
+    return std::get<Listeners<T>>(m_listeners);
+  }
+
+  API::GenericEventHub<Ts...>& m_event_hub;
+  std::shared_ptr<Py::InterpreterThreadStates> m_threadstates;
+  std::shared_ptr<API::ScriptProfile> m_profile;
+  std::tuple<Listeners<Ts>...> m_listeners;
+};
+
+template <typename THub>
+struct PyEventDispatcherForHub;
+template <typename... Ts>
+struct PyEventDispatcherForHub<API::GenericEventHub<Ts...>>
+{
+  using type = GenericPyEventDispatcher<Ts...>;
+};
+
+// dispatches all events of the global event hub
+using PyEventDispatcher = PyEventDispatcherForHub<API::EventHub>::type;
+
+}  // namespace PyScripting
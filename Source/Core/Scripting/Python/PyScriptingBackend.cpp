@@ -5,6 +5,7 @@
 #include "PyScriptingBackend.h"
 
 #include <Python.h>
+#include <algorithm>
 #include <string>
 
 #include "Common/FileUtil.h"
@@ -114,6 +115,43 @@ static void Init(std::filesystem::path script_filepath)
   }
 }
 
+// Must be called from within the main interpreter.
+// Afterwards the calling thread is in the new interpreter, and also holds the main interpreter's
+// GIL unless the new interpreter got its own GIL.
+static PyThreadState* NewSubinterpreter(bool* own_gil)
+{
+  *own_gil = false;
+  if (!Scripting::ScriptingBackend::PythonPerInterpreterGILEnabled())
+    return Py_NewInterpreter();
+
+#if PY_VERSION_HEX >= 0x030C0000
+  // Isolated interpreters can't share objects, and only allow extension modules
+  // declaring support for multiple interpreters with their own GIL.
+  const PyInterpreterConfig config = {
+      .use_main_obmalloc = 0,
+      .allow_fork = 0,
+      .allow_exec = 0,
+      .allow_threads = 1,
+      .allow_daemon_threads = 0,
+      .check_multi_interp_extensions = 1,
+      .gil = PyInterpreterConfig_OWN_GIL,
+  };
+  PyThreadState* threadstate = nullptr;
+  const PyStatus status = Py_NewInterpreterFromConfig(&threadstate, &config);
+  if (!PyStatus_Exception(status))
+  {
+    *own_gil = true;
+    return threadstate;
+  }
+  ERROR_LOG_FMT(SCRIPTING, "Failed to create an interpreter with its own GIL: {}",
+                status.err_msg != nullptr ? status.err_msg : "unknown error");
+#else
+  ERROR_LOG_FMT(SCRIPTING, "Interpreters with their own GIL require python 3.12 or newer");
+#endif
+  WARN_LOG_FMT(SCRIPTING, "Falling back to an interpreter sharing the main interpreter's GIL");
+  return Py_NewInterpreter();
+}
+
 static void ShutdownMainPythonInterpreter()
 {
   if (Py_FinalizeEx() != 0)
@@ -125,12 +163,13 @@ static void ShutdownMainPythonInterpreter()
 PyScriptingBackend::PyScriptingBackend(std::filesystem::path script_filepath,
                                        API::EventHub& event_hub, API::Gui& gui,
                                        API::GCManip& gc_manip, API::WiiButtonsManip& wii_buttons_manip,
-                                       API::WiiIRManip& wii_ir_manip, API::NunchuckButtonsManip& nunchuck_buttons_manip)
+                                       API::WiiIRManip& wii_ir_manip, API::NunchuckButtonsManip& nunchuck_buttons_manip,
+                                       std::shared_ptr<WorkerChannel> worker_channel)
     : m_event_hub(event_hub), m_gui(gui), m_gc_manip(gc_manip), m_wii_buttons_manip(wii_buttons_manip), m_wii_ir_manip(wii_ir_manip),
-      m_nunchuck_buttons_manip(nunchuck_buttons_manip)
+      m_nunchuck_buttons_manip(nunchuck_buttons_manip), m_worker_channel(std::move(worker_channel))
 {
   m_script_path = script_filepath.string();
-  std::lock_guard lock{s_bookkeeping_lock};
+  std::unique_lock lock{s_bookkeeping_lock};
   if (s_instances.empty())
   {
     s_main_threadstate = InitMainPythonInterpreter();
@@ -141,14 +180,32 @@ PyScriptingBackend::PyScriptingBackend(std::filesystem::path script_filepath,
   if (no_subinterpreters)
   {
     m_interp_threadstate = s_main_threadstate;
+    if (!s_main_threadstates)
+      s_main_threadstates = std::make_shared<Py::InterpreterThreadStates>(s_main_threadstate);
+    m_threadstates = s_main_threadstates;
+    if (!s_main_event_dispatcher)
+    {
+      // All scripts share the main interpreter's listeners, so their stats can't be told apart.
+      s_main_event_dispatcher = std::make_shared<PyEventDispatcher>(
+          m_event_hub, m_threadstates,
+          API::GetScriptProfiler().AddProfile("<all scripts>",
+                                              PyEventDispatcher::GetEventNames()));
+    }
+    m_event_dispatcher = s_main_event_dispatcher;
   }
   else
   {
-    m_interp_threadstate = Py_NewInterpreter();
-    PyThreadState_Swap(m_interp_threadstate);
+    m_interp_threadstate = NewSubinterpreter(&m_own_gil);
+    m_threadstates = std::make_shared<Py::InterpreterThreadStates>(m_interp_threadstate);
+    m_event_dispatcher = std::make_shared<PyEventDispatcher>(
+        m_event_hub, m_threadstates,
+        API::GetScriptProfiler().AddProfile(m_script_path, PyEventDispatcher::GetEventNames()));
   }
   u64 interp_id = PyInterpreterState_GetID(m_interp_threadstate->interp);
-  s_instances[interp_id] = this;
+  {
+    std::unique_lock instances_lock{s_instances_lock};
+    s_instances[interp_id] = this;
+  }
   m_script_id = int(interp_id);
 
   {
@@ -168,6 +225,12 @@ PyScriptingBackend::PyScriptingBackend(std::filesystem::path script_filepath,
     }
   }
 
+  // Workers run their whole script here, which must not keep other scripts from
+  // being started or stopped. Without subinterpreters all scripts share the main
+  // interpreter's thread state though, so their top-level code must not run concurrently.
+  if (!no_subinterpreters)
+    lock.unlock();
+
   Init(script_filepath);
 
   PyEval_SaveThread();
@@ -187,8 +250,9 @@ PyScriptingBackend::~PyScriptingBackend()
     // We cannot simply shut down the interpreter, so the modules will stay alive.
     // But we _do_ want to "stop" the modules, or else removing or reloading the script won't work.
     // We let modules define custom reset behaviour in a magic method "_dolphin_reset".
-    // Right now all we need to do is reset the event module, which just unregisters all events.
-    const char* modules_with_resets[] = {"dolphin_event"};
+    // Right now all we need to do is reset the event module, which just unregisters all events,
+    // and the memory module, which stops all memory watches.
+    const char* modules_with_resets[] = {"dolphin_event", "dolphin_memory"};
     for (const auto& module_name : modules_with_resets)
     {
       Py::Object module = Py::Wrap(PyImport_ImportModule(module_name));
@@ -214,6 +278,7 @@ PyScriptingBackend::~PyScriptingBackend()
   {
     for (const auto& cleanup_func : m_cleanups)
       cleanup_func();
+    m_event_dispatcher->UnlistenAll();
   }
 
   // Cleanup did remove listeners, but there may still be a concurrent iteration over the listeners happening.
@@ -229,11 +294,21 @@ PyScriptingBackend::~PyScriptingBackend()
   // application's entire lifetime. See also https://stackoverflow.com/a/7676916
   if (!Scripting::ScriptingBackend::PythonSubinterpretersDisabled())
   {
-    s_instances.erase(interp_id);
+    {
+      std::unique_lock instances_lock{s_instances_lock};
+      s_instances.erase(interp_id);
+    }
+    m_threadstates->DeleteOtherThreadStates();
     Py_EndInterpreter(m_interp_threadstate);
+    API::GetScriptProfiler().RemoveProfile(m_event_dispatcher->GetProfile());
   }
 
-  PyThreadState_Swap(s_main_threadstate);
+  // Ending an interpreter with its own GIL also destroys that GIL,
+  // while the shared GIL stays held by this thread.
+  if (m_own_gil)
+    PyEval_RestoreThread(s_main_threadstate);
+  else
+    PyThreadState_Swap(s_main_threadstate);
   if (s_instances.empty())
   {
     ShutdownMainPythonInterpreter();
@@ -252,7 +327,43 @@ PyScriptingBackend* PyScriptingBackend::GetCurrent()
 {
   PyInterpreterState* interp_state = PyThreadState_Get()->interp;
   u64 interp_id = PyInterpreterState_GetID(interp_state);
-  return s_instances[interp_id];
+  std::shared_lock instances_lock{s_instances_lock};
+  const auto it = s_instances.find(interp_id);
+  return it != s_instances.end() ? it->second : nullptr;
+}
+
+WorkerChannel* PyScriptingBackend::GetWorkerChannel()
+{
+  return m_worker_channel.get();
+}
+
+PyWorker* PyScriptingBackend::StartWorker(std::filesystem::path script_filepath)
+{
+  std::lock_guard lock{m_workers_mutex};
+  // Released workers that finished in the meantime don't need to be kept around anymore.
+  std::erase_if(m_workers, [](const std::unique_ptr<PyWorker>& worker) {
+    return worker->IsReleased() && worker->IsFinished();
+  });
+  m_workers.push_back(std::make_unique<PyWorker>(std::move(script_filepath), *this));
+  return m_workers.back().get();
+}
+
+void PyScriptingBackend::ReleaseWorker(PyWorker* worker)
+{
+  std::lock_guard lock{m_workers_mutex};
+  worker->Release();
+  if (worker->IsFinished())
+    std::erase_if(m_workers, [worker](const auto& owned) { return owned.get() == worker; });
+}
+
+bool PyScriptingBackend::HasEnded()
+{
+  // The top-level code runs in the constructor, so it has returned by now.
+  if (m_event_dispatcher->HasListeners())
+    return false;
+  std::lock_guard lock{m_workers_mutex};
+  return std::ranges::all_of(m_workers,
+                             [](const auto& worker) { return worker->IsFinished(); });
 }
 
 int PyScriptingBackend::GetScriptId()
@@ -270,6 +381,16 @@ API::EventHub* PyScriptingBackend::GetEventHub()
   return &m_event_hub;
 }
 
+PyEventDispatcher* PyScriptingBackend::GetEventDispatcher()
+{
+  return m_event_dispatcher.get();
+}
+
+Py::InterpreterThreadStates* PyScriptingBackend::GetThreadStates()
+{
+  return m_threadstates.get();
+}
+
 API::Gui* PyScriptingBackend::GetGui()
 {
   return &m_gui;
@@ -302,6 +423,9 @@ void PyScriptingBackend::AddCleanupFunc(std::function<void()> cleanup_func)
 
 std::map<u64, PyScriptingBackend*> PyScriptingBackend::s_instances;
 PyThreadState* PyScriptingBackend::s_main_threadstate;
+std::shared_mutex PyScriptingBackend::s_instances_lock;
 std::mutex PyScriptingBackend::s_bookkeeping_lock;
+std::shared_ptr<Py::InterpreterThreadStates> PyScriptingBackend::s_main_threadstates;
+std::shared_ptr<PyEventDispatcher> PyScriptingBackend::s_main_event_dispatcher;
 
 }  // namespace PyScripting
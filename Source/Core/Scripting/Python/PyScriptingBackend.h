@@ -7,11 +7,18 @@
 #include <filesystem>
 #include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
 #include <Python.h>
 
 #include "Core/API/Controller.h"
 #include "Core/API/Events.h"
 #include "Core/API/Gui.h"
+#include "Scripting/Python/PyEventDispatcher.h"
+#include "Scripting/Python/PyWorker.h"
+#include "Scripting/Python/Utils/thread_state.h"
 
 namespace PyScripting
 {
@@ -22,10 +29,16 @@ public:
   PyScriptingBackend(std::filesystem::path script_filepath, API::EventHub& event_hub, API::Gui& gui,
                      API::GCManip& gc_manip, API::WiiButtonsManip& wii_buttons_manip,
                      API::WiiIRManip& wii_ir_manip,
-                     API::NunchuckButtonsManip& nunchuck_buttons_manip);
+                     API::NunchuckButtonsManip& nunchuck_buttons_manip,
+                     std::shared_ptr<WorkerChannel> worker_channel = nullptr);
   ~PyScriptingBackend();
   static PyScriptingBackend* GetCurrent();
   API::EventHub* GetEventHub();
+  // Python listeners should listen to events through this instead of the event hub,
+  // so all python work for an event is done with a single GIL acquisition.
+  PyEventDispatcher* GetEventDispatcher();
+  // For entering this script's interpreter from threads other than the one that created it.
+  Py::InterpreterThreadStates* GetThreadStates();
   API::Gui* GetGui();
   API::GCManip* GetGCManip();
   API::WiiButtonsManip* GetWiiButtonsManip();
@@ -34,7 +47,17 @@ public:
   void AddCleanupFunc(std::function<void()> cleanup_func);
   std::string GetScriptPath();
   int GetScriptId();
-  
+  // The channel to the script that started this one if it runs as a worker, otherwise null.
+  WorkerChannel* GetWorkerChannel();
+  // Starts a worker that is owned by this script.
+  PyWorker* StartWorker(std::filesystem::path script_filepath);
+  // Called once nothing refers to the worker anymore. Asks it to stop, and destroys it right away
+  // if it already finished. Otherwise it is waited for when this script shuts down.
+  void ReleaseWorker(PyWorker* worker);
+  // Whether the script has nothing left to do: Its top-level code returned or failed, and it
+  // neither listens to or awaits any event nor has workers still running.
+  // May be called from any thread.
+  bool HasEnded();
 
   // this class somewhat is a wrapper around a python interpreter state,
   // and that isn't copyable, so this class isn't copyable either.
@@ -46,20 +69,36 @@ public:
 
 private:
   static std::map<u64, PyScriptingBackend*> s_instances;
+  // Interpreters with their own GIL look themselves up concurrently while other interpreters
+  // are being created or deleted. Modifying s_instances requires both locks.
+  static std::shared_mutex s_instances_lock;
   static PyThreadState* s_main_threadstate;
   // creation and deletion of this class handles the bookkeeping of python's
   // main- and sub-interpreters. None of that can safely run concurrently.
   static std::mutex s_bookkeeping_lock;
+  // Without subinterpreters all scripts share the main interpreter and its modules.
+  static std::shared_ptr<Py::InterpreterThreadStates> s_main_threadstates;
+  static std::shared_ptr<PyEventDispatcher> s_main_event_dispatcher;
   PyThreadState* m_interp_threadstate;
+  // Whether the interpreter has its own GIL instead of sharing the main interpreter's.
+  bool m_own_gil = false;
+  std::shared_ptr<Py::InterpreterThreadStates> m_threadstates;
   API::EventHub& m_event_hub;
+  std::shared_ptr<PyEventDispatcher> m_event_dispatcher;
   API::Gui& m_gui;
   API::GCManip& m_gc_manip;
   API::WiiButtonsManip& m_wii_buttons_manip;
   API::WiiIRManip& m_wii_ir_manip;
   API::NunchuckButtonsManip& m_nunchuck_buttons_manip;
+  std::shared_ptr<WorkerChannel> m_worker_channel;
   std::vector<std::function<void()>> m_cleanups;
   std::string m_script_path;
   int m_script_id;
+  // Guards m_workers against HasEnded.
+  std::mutex m_workers_mutex;
+  // Declared last, so that workers still running are waited for after the destructor's body,
+  // which holds s_bookkeeping_lock that the workers need to shut down.
+  std::vector<std::unique_ptr<PyWorker>> m_workers;
 };
 
 }  // namespace PyScripting
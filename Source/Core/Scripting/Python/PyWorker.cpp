@@ -0,0 +1,102 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Scripting/Python/PyWorker.h"
+
+#include <chrono>
+#include <utility>
+
+#include "Common/Logging/Log.h"
+#include "Common/Thread.h"
+#include "Scripting/Python/PyScriptingBackend.h"
+
+namespace PyScripting
+{
+
+constexpr DT STOP_WARNING_INTERVAL = std::chrono::seconds(5);
+
+PyWorker::PyWorker(std::filesystem::path script_filepath, PyScriptingBackend& parent)
+    : m_script_path(script_filepath.string()), m_channel(std::make_shared<WorkerChannel>())
+{
+  m_thread = std::thread([script_filepath = std::move(script_filepath), channel = m_channel,
+                          &event_hub = *parent.GetEventHub(), &gui = *parent.GetGui(),
+                          &gc_manip = *parent.GetGCManip(),
+                          &wii_buttons_manip = *parent.GetWiiButtonsManip(),
+                          &wii_ir_manip = *parent.GetWiiIRManip(),
+                          &nunchuck_buttons_manip = *parent.GetNunchuckButtonsManip()] {
+    Common::SetCurrentThreadName("Script Worker");
+    {
+      // Runs the whole script, and tears its interpreter down once it's done.
+      PyScriptingBackend backend(script_filepath, event_hub, gui, gc_manip, wii_buttons_manip,
+                                 wii_ir_manip, nunchuck_buttons_manip, channel);
+    }
+    channel->finished = true;
+    channel->finished_event.Set();
+  });
+}
+
+PyWorker::~PyWorker()
+{
+  RequestStop();
+  // The worker's interpreter must be torn down before the parent's script is considered stopped,
+  // so workers that ignore stop requests stall it. Make that visible instead of hanging silently.
+  while (!WaitUntilFinished(STOP_WARNING_INTERVAL))
+  {
+    WARN_LOG_FMT(SCRIPTING, "Still waiting for worker {} to stop. Workers should return once "
+                            "utils.worker_stop_requested() is true.",
+                 m_script_path);
+  }
+  m_thread.join();
+}
+
+void PyWorker::Send(std::string message)
+{
+  m_channel->to_worker.Push(std::move(message));
+  m_channel->to_worker_event.Set();
+}
+
+std::optional<std::string> PyWorker::Receive()
+{
+  std::string message;
+  if (!m_channel->from_worker.Pop(message))
+    return std::nullopt;
+  return message;
+}
+
+void PyWorker::RequestStop()
+{
+  m_channel->stop_requested = true;
+  m_channel->to_worker_event.Set();
+}
+
+bool PyWorker::IsFinished() const
+{
+  return m_channel->finished;
+}
+
+void PyWorker::Release()
+{
+  m_released = true;
+  RequestStop();
+}
+
+bool PyWorker::WaitUntilFinished(std::optional<DT> timeout)
+{
+  if (!timeout.has_value())
+  {
+    while (!IsFinished())
+      m_channel->finished_event.Wait();
+    return true;
+  }
+  const TimePoint deadline = Clock::now() + *timeout;
+  while (!IsFinished())
+  {
+    const TimePoint now = Clock::now();
+    if (now >= deadline)
+      return false;
+    m_channel->finished_event.WaitFor(deadline - now);
+  }
+  return true;
+}
+
+}  // namespace PyScripting
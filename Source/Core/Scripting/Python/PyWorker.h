@@ -0,0 +1,75 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Workers run a script in their own interpreter on their own thread, for work that would
+// otherwise stall emulation, e.g. searching, planning or file I/O.
+// A worker and the script that started it exchange messages through a pair of
+// single-producer single-consumer queues. Each queue end is only ever used while holding
+// the GIL of the interpreter it belongs to, which makes it single-threaded.
+// Messages are pickled, because python objects cannot be shared between interpreters.
+
+#pragma once
+
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+
+#include "Common/CommonTypes.h"
+#include "Common/Event.h"
+#include "Common/SPSCQueue.h"
+
+namespace PyScripting
+{
+
+class PyScriptingBackend;
+
+struct WorkerChannel
+{
+  Common::SPSCQueue<std::string, false> to_worker;
+  Common::SPSCQueue<std::string, false> from_worker;
+  // Set whenever a message is sent to the worker or the worker is asked to stop.
+  Common::Event to_worker_event;
+  Common::Event finished_event;
+  std::atomic<bool> stop_requested = false;
+  std::atomic<bool> finished = false;
+};
+
+class PyWorker
+{
+public:
+  // Starts running the script on a new thread,
+  // with access to the same emulator APIs as the parent script.
+  // Workers are owned by their parent's PyScriptingBackend, see StartWorker.
+  PyWorker(std::filesystem::path script_filepath, PyScriptingBackend& parent);
+  // Asks the worker to stop and joins its thread, logging while it takes long.
+  // Must not be called with the GIL held unless the worker already finished.
+  ~PyWorker();
+
+  PyWorker(const PyWorker&) = delete;
+  PyWorker& operator=(const PyWorker&) = delete;
+
+  WorkerChannel& GetChannel() { return *m_channel; }
+  const std::string& GetScriptPath() const { return m_script_path; }
+
+  // Called from the parent script's side with its GIL held.
+  void Send(std::string message);
+  std::optional<std::string> Receive();
+  void RequestStop();
+  bool IsFinished() const;
+  // Asks the worker to stop, because the parent script can't refer to it anymore.
+  void Release();
+  bool IsReleased() const { return m_released; }
+  // Must not be called with the GIL held. Returns whether the worker finished in time.
+  bool WaitUntilFinished(std::optional<DT> timeout);
+
+private:
+  std::string m_script_path;
+  std::shared_ptr<WorkerChannel> m_channel;
+  std::thread m_thread;
+  bool m_released = false;
+};
+
+}  // namespace PyScripting
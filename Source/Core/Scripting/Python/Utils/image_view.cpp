@@ -0,0 +1,37 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "image_view.h"
+
+#include <cstring>
+
+namespace Py
+{
+
+PyObject* MakeImageView(const u8* data, u32 width, u32 height, u32 stride)
+{
+  const Py_ssize_t row_size = static_cast<Py_ssize_t>(width) * 4;
+  PyObject* bytes = PyBytes_FromStringAndSize(nullptr, row_size * height);
+  if (bytes == nullptr)
+    return nullptr;
+  char* pixels = PyBytes_AS_STRING(bytes);
+  if (stride == row_size)
+  {
+    std::memcpy(pixels, data, row_size * height);
+  }
+  else
+  {
+    for (u32 y = 0; y < height; ++y)
+      std::memcpy(pixels + y * row_size, data + static_cast<size_t>(y) * stride, row_size);
+  }
+
+  PyObject* flat_view = PyMemoryView_FromObject(bytes);
+  Py_DECREF(bytes);
+  if (flat_view == nullptr)
+    return nullptr;
+  PyObject* view = PyObject_CallMethod(flat_view, "cast", "s(IIi)", "B", height, width, 4);
+  Py_DECREF(flat_view);
+  return view;
+}
+
+}  // namespace Py
@@ -0,0 +1,21 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Handing images to python without tying their lifetime to the source memory.
+
+#pragma once
+
+#include <Python.h>
+
+#include "Common/CommonTypes.h"
+
+namespace Py
+{
+
+// Returns a new reference to a read-only memoryview of the given RGBA image,
+// shaped (height, width, 4), or nullptr with a python exception set.
+// The pixels are copied into a bytes object that the view and everything exported from it
+// (slices, numpy arrays) keep alive, so they stay valid after the source memory is reused.
+PyObject* MakeImageView(const u8* data, u32 width, u32 height, u32 stride);
+
+}  // namespace Py
@@ -39,7 +39,8 @@ static int SetupModuleWithState(PyObject* module)
   *state_ptr = new TState();
 
   TSetup(module, *state_ptr);
-  return 0;
+  // setup functions may fail, e.g. when creating the module's types
+  return PyErr_Occurred() ? -1 : 0;
 }
 
 template <typename TState, FuncOnState<TState> TSetup>
@@ -47,7 +48,13 @@ PyModuleDef MakeStatefulModuleDef(const char* name, PyMethodDef func_defs[])
 {
   auto func = SetupModuleWithState<TState, TSetup>;
   static PyModuleDef_Slot slots_with_exec[] = {
-      {Py_mod_exec, (void*) func}, {0, nullptr} // Sentinel
+      {Py_mod_exec, (void*) func},
+#if PY_VERSION_HEX >= 0x030C0000
+      // All state lives in the module state and in thread-safe emulator objects,
+      // so every interpreter may run its modules under its own GIL.
+      {Py_mod_multiple_interpreters, Py_MOD_PER_INTERPRETER_GIL_SUPPORTED},
+#endif
+      {0, nullptr} // Sentinel
   };
   static PyModuleDef moduleDefinition{
       PyModuleDef_HEAD_INIT,
@@ -69,4 +76,21 @@ static TState* GetState(PyObject* module)
   return *static_cast<TState**>(PyModule_GetState(module));
 }
 
+// Creates a heap type from the given spec and adds it to the module.
+// Heap types are created per module instance, so every (sub-)interpreter
+// gets its own type object. The returned reference is borrowed from the
+// module's attribute, which keeps the type alive for the module's lifetime.
+inline PyTypeObject* AddTypeToModule(PyObject* module, PyType_Spec* spec)
+{
+  PyObject* type = PyType_FromModuleAndSpec(module, spec, nullptr);
+  if (type == nullptr)
+    return nullptr;
+  const int result = PyModule_AddType(module, reinterpret_cast<PyTypeObject*>(type));
+  // PyModule_AddType takes its own reference.
+  Py_DECREF(type);
+  if (result < 0)
+    return nullptr;
+  return reinterpret_cast<PyTypeObject*>(type);
+}
+
 }  // namespace Py
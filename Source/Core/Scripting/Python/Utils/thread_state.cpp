@@ -0,0 +1,76 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "thread_state.h"
+
+namespace Py
+{
+
+static PyThreadState* GetCurrentThreadState()
+{
+#if PY_VERSION_HEX >= 0x030D0000
+  return PyThreadState_GetUnchecked();
+#else
+  return _PyThreadState_UncheckedGet();
+#endif
+}
+
+// Marks that the calling thread already was in the interpreter when entering it,
+// so leaving it must not do anything.
+static PyThreadState* const ALREADY_ENTERED = reinterpret_cast<PyThreadState*>(1);
+
+InterpreterThreadStates::InterpreterThreadStates(PyThreadState* creator_threadstate)
+    : m_interp(creator_threadstate->interp),
+      m_creator_threadstate(creator_threadstate), m_creator_thread(std::this_thread::get_id())
+{
+}
+
+PyThreadState* InterpreterThreadStates::GetThreadStateForCurrentThread()
+{
+  const std::thread::id thread = std::this_thread::get_id();
+  if (thread == m_creator_thread)
+    return m_creator_threadstate;
+  std::lock_guard lock{m_mutex};
+  auto it = m_threadstates.find(thread);
+  if (it == m_threadstates.end())
+  {
+    // Creating a thread state doesn't require holding the interpreter's GIL.
+    it = m_threadstates.emplace(thread, PyThreadState_New(m_interp)).first;
+  }
+  return it->second;
+}
+
+PyThreadState* InterpreterThreadStates::Enter()
+{
+  PyThreadState* const previous = GetCurrentThreadState();
+  // E.g. an event caused by the interpreter's own python code, like a memory breakpoint.
+  if (previous != nullptr && previous->interp == m_interp)
+    return ALREADY_ENTERED;
+  PyThreadState* const threadstate = GetThreadStateForCurrentThread();
+  if (previous != nullptr)
+    PyEval_SaveThread();
+  PyEval_RestoreThread(threadstate);
+  return previous;
+}
+
+void InterpreterThreadStates::Leave(PyThreadState* previous)
+{
+  if (previous == ALREADY_ENTERED)
+    return;
+  PyEval_SaveThread();
+  if (previous != nullptr)
+    PyEval_RestoreThread(previous);
+}
+
+void InterpreterThreadStates::DeleteOtherThreadStates()
+{
+  std::lock_guard lock{m_mutex};
+  for (const auto& [thread, threadstate] : m_threadstates)
+  {
+    PyThreadState_Clear(threadstate);
+    PyThreadState_Delete(threadstate);
+  }
+  m_threadstates.clear();
+}
+
+}  // namespace Py
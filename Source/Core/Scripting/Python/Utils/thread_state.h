@@ -0,0 +1,72 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Entering an interpreter from arbitrary threads.
+// Python requires every OS thread to use its own thread state,
+// and with per-interpreter GILs several threads may be running python code at the same time,
+// each of them in a different interpreter. Threads running python code of one interpreter
+// may also cause events that need to run python code of another interpreter.
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include <Python.h>
+
+namespace Py
+{
+
+// The thread states of one interpreter, one per OS thread that has entered it.
+class InterpreterThreadStates
+{
+public:
+  // The given thread state is used for the thread that created the interpreter.
+  explicit InterpreterThreadStates(PyThreadState* creator_threadstate);
+
+  InterpreterThreadStates(const InterpreterThreadStates&) = delete;
+  InterpreterThreadStates& operator=(const InterpreterThreadStates&) = delete;
+
+  PyInterpreterState* GetInterpreter() const { return m_interp; }
+
+  // Makes the interpreter's thread state of the calling thread the current one,
+  // taking the interpreter's GIL. A different interpreter the calling thread is currently in
+  // is left (releasing its GIL) and has to be restored by passing the returned value to Leave.
+  [[nodiscard]] PyThreadState* Enter();
+  void Leave(PyThreadState* previous);
+
+  // Deletes the thread states created for other threads, which needs to be done before
+  // ending the interpreter. Must be called from within the interpreter using the creating
+  // thread's thread state, with no other thread being in it.
+  void DeleteOtherThreadStates();
+
+private:
+  PyThreadState* GetThreadStateForCurrentThread();
+
+  PyInterpreterState* const m_interp;
+  PyThreadState* const m_creator_threadstate;
+  const std::thread::id m_creator_thread;
+  std::mutex m_mutex;
+  std::map<std::thread::id, PyThreadState*> m_threadstates;
+};
+
+// RAII helper for InterpreterThreadStates::Enter and Leave.
+class EnterInterpreter
+{
+public:
+  explicit EnterInterpreter(InterpreterThreadStates& threadstates)
+      : m_threadstates(threadstates), m_previous(threadstates.Enter())
+  {
+  }
+  ~EnterInterpreter() { m_threadstates.Leave(m_previous); }
+
+  EnterInterpreter(const EnterInterpreter&) = delete;
+  EnterInterpreter& operator=(const EnterInterpreter&) = delete;
+
+private:
+  InterpreterThreadStates& m_threadstates;
+  PyThreadState* m_previous;
+};
+
+}  // namespace Py
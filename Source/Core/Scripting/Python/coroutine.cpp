@@ -48,10 +48,12 @@ void HandleCoroutine(const Py::Object module, const Py::Object coro, const Py::O
                          "(error: wrong magic string to identify as dolphin-native event)");
     return;
   }
-  // `args_tuple` is unused:
-  // right now there are no events that take in arguments.
-  // If there were, say `await frameadvance(5)` to wait 5 frames,
-  // those arguments would be passed as a tuple via `args_tuple`.
+  if (!PyTuple_Check(args_tuple))
+  {
+    ERROR_LOG_FMT(SCRIPTING, "A coroutine was yielded to the emulator that it cannot process. "
+                         "(error: event arguments were not a tuple)");
+    return;
+  }
 
   auto scheduler_opt = GetCoroutineScheduler(event_name);
   if (!scheduler_opt.has_value())
@@ -59,8 +61,10 @@ void HandleCoroutine(const Py::Object module, const Py::Object coro, const Py::O
     ERROR_LOG_FMT(SCRIPTING, "An unknown event was tried to be awaited: {}", event_name);
     return;
   }
-  std::function<void(const Py::Object, const Py::Object)> scheduler = scheduler_opt.value();
-  scheduler(module, coro);
+  // The arguments the event was awaited with, e.g. `(5,)` for `await frameadvance(5)`.
+  const CoroutineScheduler scheduler = scheduler_opt.value();
+  if (!scheduler(module, coro, args_tuple))
+    PyErr_Print();
 }
 
 }  // namespace PyScripting
@@ -32,6 +32,29 @@ void StopAllScripts()
   g_scripts_started = false;
 }
 
+void ApplyQueuedScriptChanges()
+{
+  while (!g_scripts_to_start.empty())
+  {
+    const std::string file_path = g_scripts_to_start.front();
+    g_scripts_to_start.pop_front();
+    if (g_scripts.find(file_path) == g_scripts.end())
+      g_scripts[file_path] = g_scripts_started ? new Scripting::ScriptingBackend(file_path) : nullptr;
+  }
+
+  while (!g_scripts_to_stop.empty())
+  {
+    const std::string file_path = g_scripts_to_stop.front();
+    g_scripts_to_stop.pop_front();
+    auto it = g_scripts.find(file_path);
+    if (it != g_scripts.end())
+    {
+      delete it->second;
+      g_scripts.erase(it);
+    }
+  }
+}
+
 std::unordered_map<std::string, Scripting::ScriptingBackend*> g_scripts = {};
 bool g_scripts_started = false;
 std::list<std::string> g_scripts_to_start = {};
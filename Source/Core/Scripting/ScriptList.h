@@ -14,6 +14,10 @@ namespace Scripts
 
 void StartPendingScripts();
 void StopAllScripts();
+// Starts and stops the scripts queued in g_scripts_to_start and g_scripts_to_stop.
+// Must be called on the host thread. Frontends that show scripts in their own UI,
+// like DolphinQt, process these queues themselves instead.
+void ApplyQueuedScriptChanges();
 
 // extern so that different translation units can access a global instance of these vars
 // i.e. DolphinLib needs to access these variables even though they're housed in the Scripting unit
@@ -44,6 +44,11 @@ ScriptingBackend::~ScriptingBackend() {
   }
 }
 
+bool ScriptingBackend::HasEnded() const
+{
+  return m_state == nullptr || static_cast<PyScripting::PyScriptingBackend*>(m_state)->HasEnded();
+}
+
 bool ScriptingBackend::s_disable_python_subinterpreters = false;
 void ScriptingBackend::DisablePythonSubinterpreters()
 {
@@ -54,6 +59,16 @@ bool ScriptingBackend::PythonSubinterpretersDisabled()
   return s_disable_python_subinterpreters;
 }
 
+bool ScriptingBackend::s_python_per_interpreter_gil = false;
+void ScriptingBackend::EnablePythonPerInterpreterGIL()
+{
+  s_python_per_interpreter_gil = true;
+}
+bool ScriptingBackend::PythonPerInterpreterGILEnabled()
+{
+  return s_python_per_interpreter_gil && !s_disable_python_subinterpreters;
+}
+
 ScriptingBackend::ScriptingBackend(ScriptingBackend&& other)
 {
   m_state = other.m_state;
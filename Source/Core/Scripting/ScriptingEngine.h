@@ -15,8 +15,15 @@ public:
   ScriptingBackend(std::filesystem::path script_filepath);
   ~ScriptingBackend();
 
+  // Whether the script finished its top-level code and doesn't wait for anything anymore.
+  bool HasEnded() const;
+
   static void DisablePythonSubinterpreters();
   static bool PythonSubinterpretersDisabled();
+  // Gives every subinterpreter its own GIL, so scripts can run python code in parallel.
+  // Requires python 3.12 or newer, and extension modules supporting it.
+  static void EnablePythonPerInterpreterGIL();
+  static bool PythonPerInterpreterGILEnabled();
 
   ScriptingBackend(const ScriptingBackend&) = delete;
   ScriptingBackend& operator=(const ScriptingBackend&) = delete;
@@ -24,6 +31,7 @@ public:
   ScriptingBackend& operator=(ScriptingBackend&&);
 private:
   static bool s_disable_python_subinterpreters;
+  static bool s_python_per_interpreter_gil;
   // We cannot name the actual used python scripting backend here,
   // as that would transitively include the Python.h header, which we don't want.
   // TODO help! how can I do this better??
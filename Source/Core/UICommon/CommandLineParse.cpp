@@ -115,6 +115,11 @@ std::unique_ptr<optparse::OptionParser> CreateParser(ParserOptions options)
       .dest("no_python_subinterpreters")
       .set_default("0")
       .help("Disables python subinterpreters. Makes some python libraries like numpy work, but cannot run multiple scripts at the same time.");
+  parser->add_option("--python-per-interpreter-gil")
+      .action("store_true")
+      .dest("python_per_interpreter_gil")
+      .set_default("0")
+      .help("Gives every script its own GIL, so scripts can run python code in parallel. Requires python 3.12 or newer, and all imported extension modules need to support it.");
 
   if (options == ParserOptions::IncludeGUIOptions)
   {
@@ -0,0 +1,84 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/FrameDrawnReadback.h"
+
+#include "Common/Logging/Log.h"
+
+#include "Core/API/Events.h"
+
+#include "VideoCommon/AbstractGfx.h"
+#include "VideoCommon/AbstractStagingTexture.h"
+#include "VideoCommon/AbstractTexture.h"
+
+namespace VideoCommon
+{
+FrameDrawnReadback::FrameDrawnReadback() = default;
+FrameDrawnReadback::~FrameDrawnReadback() = default;
+
+void FrameDrawnReadback::QueueFrame(const AbstractTexture* texture,
+                                    const MathUtil::Rectangle<int>& rect)
+{
+  if (!API::GetEventHub().HasListeners<API::Events::FrameDrawn>())
+  {
+    // Frames queued for listeners that are gone by now aren't of interest to anyone.
+    DiscardPendingFrames();
+    return;
+  }
+
+  Slot& slot = m_slots[m_next_slot];
+  if (slot.pending)
+    EmitFrame(slot);
+
+  if (!CheckSlotTexture(slot, rect.GetWidth(), rect.GetHeight()))
+    return;
+
+  slot.texture->CopyFromTexture(texture, rect, 0, 0, slot.texture->GetRect());
+  slot.pending = true;
+  m_next_slot = (m_next_slot + 1) % RING_SIZE;
+}
+
+bool FrameDrawnReadback::CheckSlotTexture(Slot& slot, u32 width, u32 height)
+{
+  std::unique_ptr<AbstractStagingTexture>& tex = slot.texture;
+  if (tex && tex->GetWidth() == width && tex->GetHeight() == height)
+    return true;
+
+  tex.reset();
+  tex = g_gfx->CreateStagingTexture(StagingTextureType::Readback,
+                                    TextureConfig(width, height, 1, 1, 1,
+                                                  AbstractTextureFormat::RGBA8, 0,
+                                                  AbstractTextureType::Texture_2DArray));
+  if (!tex)
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to create staging texture for frame readback.");
+    return false;
+  }
+  return true;
+}
+
+void FrameDrawnReadback::EmitFrame(Slot& slot)
+{
+  slot.pending = false;
+  AbstractStagingTexture& tex = *slot.texture;
+  tex.Flush();
+  if (!tex.Map())
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to map texture for frame readback.");
+    return;
+  }
+  // The mapped memory is only handed out for the duration of the event,
+  // listeners have to copy what they want to keep.
+  API::GetEventHub().EmitEvent(API::Events::FrameDrawn{
+      static_cast<int>(tex.GetWidth()), static_cast<int>(tex.GetHeight()),
+      static_cast<int>(tex.GetMappedStride()),
+      reinterpret_cast<const u8*>(tex.GetMappedPointer())});
+  tex.Unmap();
+}
+
+void FrameDrawnReadback::DiscardPendingFrames()
+{
+  for (Slot& slot : m_slots)
+    slot.pending = false;
+}
+}  // namespace VideoCommon
@@ -0,0 +1,52 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <memory>
+
+#include "Common/CommonTypes.h"
+#include "Common/MathUtil.h"
+
+class AbstractStagingTexture;
+class AbstractTexture;
+
+namespace VideoCommon
+{
+// Reads presented frames back to the CPU for API::Events::FrameDrawn listeners.
+// Every frame is copied into the next staging texture of a small ring, and is only mapped
+// once the ring wraps around to it again. By then the GPU had a few frames worth of time
+// to finish the copy, so presenting never waits for the frame that was just rendered.
+// The downside is that listeners receive frames a few presents late.
+class FrameDrawnReadback
+{
+public:
+  FrameDrawnReadback();
+  ~FrameDrawnReadback();
+
+  // Queues a readback of the given region and emits FrameDrawn for the oldest queued frame
+  // if its slot in the ring is needed for the new one. Does nothing without listeners.
+  void QueueFrame(const AbstractTexture* texture, const MathUtil::Rectangle<int>& rect);
+
+private:
+  static constexpr size_t RING_SIZE = 3;
+
+  struct Slot
+  {
+    std::unique_ptr<AbstractStagingTexture> texture;
+    // Set when the texture holds a frame that hasn't been emitted yet.
+    bool pending = false;
+  };
+
+  // Checks that the slot's staging texture exists and is the correct size.
+  bool CheckSlotTexture(Slot& slot, u32 width, u32 height);
+
+  void EmitFrame(Slot& slot);
+  void DiscardPendingFrames();
+
+  std::array<Slot, RING_SIZE> m_slots;
+  // The slot the next frame gets copied to. If it is pending, it holds the oldest frame.
+  size_t m_next_slot = 0;
+};
+}  // namespace VideoCommon
@@ -4,11 +4,16 @@
 #include "VideoCommon/PerformanceMetrics.h"
 
 #include <algorithm>
+#include <filesystem>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <vector>
 
 #include <imgui.h>
 #include <implot.h>
 
+#include "Core/API/ScriptStats.h"
 #include "Core/Config/GraphicsSettings.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/VideoInterface.h"
@@ -316,5 +321,70 @@ void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
     ImGui::End();
   }
 
+  if (Config::Get(Config::GFX_SHOW_SCRIPT_STATS))
+    DrawImGuiScriptStats(backbuffer_scale);
+
   ImGui::PopStyleVar(2);
 }
+
+void PerformanceMetrics::DrawImGuiScriptStats(const float backbuffer_scale)
+{
+  const std::vector<std::shared_ptr<API::ScriptProfile>> profiles =
+      API::GetScriptProfiler().GetProfiles();
+  if (profiles.empty())
+    return;
+
+  const float window_padding = 8.f * backbuffer_scale;
+  const ImVec2& display_size = ImGui::GetIO().DisplaySize;
+
+  // Position in the bottom-right corner of the screen, out of the way of the other stats.
+  ImGui::SetNextWindowPos(
+      ImVec2(display_size.x - window_padding, display_size.y - window_padding),
+      ImGuiCond_Always, ImVec2(1.0f, 1.0f));
+  ImGui::SetNextWindowBgAlpha(0.7f);
+
+  const auto imgui_flags = ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoSavedSettings |
+                           ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoNav |
+                           ImGuiWindowFlags_NoMove | ImGuiWindowFlags_AlwaysAutoResize |
+                           ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoInputs;
+  if (ImGui::Begin("ScriptStats", nullptr, imgui_flags))
+  {
+    for (const std::shared_ptr<API::ScriptProfile>& profile : profiles)
+    {
+      const std::vector<API::ScriptEventStats> stats = profile->GetStats();
+      ImGui::TextUnformatted(
+          std::filesystem::path(profile->GetName()).filename().string().c_str());
+      if (stats.empty() ||
+          !ImGui::BeginTable(profile->GetName().c_str(), 6, ImGuiTableFlags_SizingFixedFit))
+      {
+        continue;
+      }
+      ImGui::TableSetupColumn("Event");
+      ImGui::TableSetupColumn("Calls");
+      ImGui::TableSetupColumn("Total");
+      ImGui::TableSetupColumn("p99");
+      ImGui::TableSetupColumn("GIL wait");
+      ImGui::TableSetupColumn("Resumes");
+      ImGui::TableHeadersRow();
+      for (const API::ScriptEventStats& event_stats : stats)
+      {
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::Text("%.*s", static_cast<int>(event_stats.event_name.size()),
+                    event_stats.event_name.data());
+        ImGui::TableNextColumn();
+        ImGui::Text("%llu", static_cast<unsigned long long>(event_stats.callbacks));
+        ImGui::TableNextColumn();
+        ImGui::Text("%.1lfms", DT_ms(event_stats.total_time).count());
+        ImGui::TableNextColumn();
+        ImGui::Text("%.0lfus", DT_us(event_stats.p99_time).count());
+        ImGui::TableNextColumn();
+        ImGui::Text("%.1lfms", DT_ms(event_stats.gil_wait_time).count());
+        ImGui::TableNextColumn();
+        ImGui::Text("%llu", static_cast<unsigned long long>(event_stats.coroutine_resumes));
+      }
+      ImGui::EndTable();
+    }
+  }
+  ImGui::End();
+}
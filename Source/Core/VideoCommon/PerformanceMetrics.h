@@ -45,6 +45,8 @@ public:
   void DrawImGuiStats(const float backbuffer_scale);
 
 private:
+  void DrawImGuiScriptStats(const float backbuffer_scale);
+
   PerformanceTracker m_fps_counter{"render_times.txt"};
   PerformanceTracker m_vps_counter{"vblank_times.txt"};
   PerformanceTracker m_speed_counter{std::nullopt, 1000000};
@@ -16,6 +16,7 @@
 
 #include "Present.h"
 #include "VideoCommon/AbstractGfx.h"
+#include "VideoCommon/FrameDrawnReadback.h"
 #include "VideoCommon/FrameDumper.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/OnScreenUI.h"
@@ -205,6 +206,7 @@ void Presenter::ViSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height,
     if (!Config::Get(Config::MAIN_REMOVE_UI_DELAY))
       Present();
     ProcessFrameDumping(ticks);
+    ProcessFrameDrawnReadback();
 
     AfterPresentEvent::Trigger(present_info);
   }
@@ -225,6 +227,7 @@ void Presenter::ImmediateSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_
   if (!Config::Get(Config::MAIN_REMOVE_UI_DELAY))
     Present();
   ProcessFrameDumping(ticks);
+  ProcessFrameDrawnReadback();
 
   AfterPresentEvent::Trigger(present_info);
 }
@@ -294,6 +297,19 @@ void Presenter::ProcessFrameDumping(u64 ticks) const
   }
 }
 
+void Presenter::ProcessFrameDrawnReadback()
+{
+  if (!m_xfb_entry)
+    return;
+  if (!m_frame_drawn_readback)
+  {
+    if (!API::GetEventHub().HasListeners<API::Events::FrameDrawn>())
+      return;
+    m_frame_drawn_readback = std::make_unique<FrameDrawnReadback>();
+  }
+  m_frame_drawn_readback->QueueFrame(m_xfb_entry->texture.get(), m_xfb_rect);
+}
+
 void Presenter::SetBackbuffer(int backbuffer_width, int backbuffer_height)
 {
   const bool is_first = m_backbuffer_width == 0 && m_backbuffer_height == 0;
@@ -23,6 +23,7 @@ enum class DolphinKey;
 
 namespace VideoCommon
 {
+class FrameDrawnReadback;
 class OnScreenUI;
 class PostProcessing;
 
@@ -104,6 +105,7 @@ private:
   bool FetchXFB(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u64 ticks);
 
   void ProcessFrameDumping(u64 ticks) const;
+  void ProcessFrameDrawnReadback();
 
   void OnBackBufferSizeChanged();
 
@@ -153,6 +155,7 @@ private:
 
   std::unique_ptr<VideoCommon::PostProcessing> m_post_processor;
   std::unique_ptr<VideoCommon::OnScreenUI> m_onscreen_ui;
+  std::unique_ptr<VideoCommon::FrameDrawnReadback> m_frame_drawn_readback;
 
   u64 m_frame_count = 0;
   u64 m_present_count = 0;
@@ -0,0 +1,77 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <optional>
+#include <random>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/PowerPC/AddressIntervalIndex.h"
+
+#include "Benchmark.h"
+
+namespace
+{
+using Interval = AddressIntervalIndex::Interval;
+
+// What BreakPoints and MemChecks did before they had an index.
+std::optional<size_t> FindFirstOverlapLinear(const std::vector<Interval>& intervals, u32 start,
+                                             u32 end)
+{
+  for (size_t i = 0; i < intervals.size(); ++i)
+  {
+    if (intervals[i].end >= start && end >= intervals[i].start)
+      return i;
+  }
+  return std::nullopt;
+}
+}  // namespace
+
+void Benchmark::RunAddressIntervalIndex()
+{
+  constexpr int ITERATIONS = 1000000;
+  constexpr u32 MEM1_START = 0x80000000;
+  constexpr u32 MEM1_SIZE = 0x01800000;
+
+  std::mt19937 rng(0);
+  std::uniform_int_distribution<u32> address_dist(0, MEM1_SIZE / 4 - 1);
+  std::uniform_int_distribution<u32> size_dist(1, 64);
+
+  fmt::print("lookup cost for 4-byte queries in MEM1:\n");
+  for (const bool wide_range : {false, true})
+  {
+    for (const int num_ranges : {10, 100, 500})
+    {
+      std::vector<Interval> intervals;
+      for (int i = 0; i < num_ranges; ++i)
+      {
+        const u32 start = MEM1_START + address_dist(rng) * 4;
+        intervals.push_back({start, start + size_dist(rng) * 4 - 1});
+      }
+      // A range over all of MEM1 after the others, e.g. a memcheck on a large buffer.
+      if (wide_range)
+        intervals.push_back({MEM1_START, MEM1_START + MEM1_SIZE - 1});
+      AddressIntervalIndex index;
+      index.Rebuild(intervals);
+
+      std::vector<u32> queries(ITERATIONS);
+      for (u32& query : queries)
+        query = MEM1_START + address_dist(rng) * 4;
+
+      u64 hits = 0;
+      const double index_ns = MeasureNs(ITERATIONS, [&](int i) {
+        hits += index.FindFirstOverlap(queries[i], queries[i] + 3).has_value();
+      });
+      const double linear_ns = MeasureNs(ITERATIONS, [&](int i) {
+        hits += FindFirstOverlapLinear(intervals, queries[i], queries[i] + 3).has_value();
+      });
+      fmt::print("{:3} ranges{}  index {:.1f} ns  linear {:.1f} ns\n", num_ranges,
+                 wide_range ? " + wide" : "", index_ns, linear_ns);
+
+      // Keeps the lookups from being optimized out.
+      fmt::print("checksum {}\n", hits);
+    }
+  }
+}
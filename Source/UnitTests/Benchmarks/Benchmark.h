@@ -0,0 +1,24 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+
+namespace Benchmark
+{
+// Returns the average time one call to `func` took, in nanoseconds.
+template <typename Func>
+double MeasureNs(int iterations, Func func)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; ++i)
+    func(i);
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+void RunAddressIntervalIndex();
+void RunEvents();
+void RunSavestate();
+}  // namespace Benchmark
@@ -0,0 +1,16 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/Core.h"
+
+#include "Benchmark.h"
+
+int main()
+{
+  Core::DeclareAsHostThread();
+
+  Benchmark::RunAddressIntervalIndex();
+  Benchmark::RunEvents();
+  Benchmark::RunSavestate();
+  return 0;
+}
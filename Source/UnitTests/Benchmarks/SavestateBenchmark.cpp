@@ -0,0 +1,148 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/ChunkFile.h"
+#include "Common/CommonTypes.h"
+
+#include "Benchmark.h"
+
+namespace
+{
+// Stands in for the emulated machine. Most of a savestate is RAM, with many small values around
+// it, so the passes over it cost about what State's DoState passes cost for the copying part.
+class FakeMachine
+{
+public:
+  FakeMachine(u32 mem1_size, u32 mem2_size)
+      : m_mem1(mem1_size, 0x11), m_mem2(mem2_size, 0x22), m_l1_cache(0x40000, 0x33)
+  {
+  }
+
+  void DoState(PointerWrap& p)
+  {
+    p.DoArray(m_mem1.data(), static_cast<u32>(m_mem1.size()));
+    p.DoArray(m_mem2.data(), static_cast<u32>(m_mem2.size()));
+    p.DoArray(m_l1_cache.data(), static_cast<u32>(m_l1_cache.size()));
+    for (u32& value : m_registers)
+      p.Do(value);
+  }
+
+private:
+  std::vector<u8> m_mem1;
+  std::vector<u8> m_mem2;
+  std::vector<u8> m_l1_cache;
+  std::array<u32, 0x4000> m_registers{};
+};
+
+// State::SaveToBuffer: measures the state, then writes it.
+void SaveToBuffer(FakeMachine& machine, std::vector<u8>& buffer)
+{
+  u8* ptr = nullptr;
+  PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
+  machine.DoState(p_measure);
+  const size_t buffer_size = reinterpret_cast<size_t>(ptr);
+  buffer.resize(buffer_size);
+
+  ptr = buffer.data();
+  PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
+  machine.DoState(p);
+}
+
+// State::SaveToReusedBuffer: writes into the existing buffer and only measures if it's too small.
+size_t SaveToReusedBuffer(FakeMachine& machine, std::vector<u8>& buffer)
+{
+  u8* ptr = buffer.data();
+  PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Write);
+  machine.DoState(p);
+  size_t state_size = static_cast<size_t>(ptr - buffer.data());
+
+  if (p.IsMeasureMode())
+  {
+    buffer.resize(state_size);
+    ptr = buffer.data();
+    PointerWrap p_retry(&ptr, state_size, PointerWrap::Mode::Write);
+    machine.DoState(p_retry);
+    state_size = static_cast<size_t>(ptr - buffer.data());
+  }
+  return state_size;
+}
+
+void LoadFromBuffer(FakeMachine& machine, const u8* data, size_t size)
+{
+  u8* ptr = const_cast<u8*>(data);
+  PointerWrap p(&ptr, size, PointerWrap::Mode::Read);
+  machine.DoState(p);
+}
+
+// A python bytes object: a fresh allocation the state gets copied into, without zeroing it first.
+struct Bytes
+{
+  Bytes(const u8* source, size_t source_size)
+      : data(std::make_unique_for_overwrite<u8[]>(source_size)), size(source_size)
+  {
+    std::memcpy(data.get(), source, size);
+  }
+
+  std::unique_ptr<u8[]> data;
+  size_t size;
+};
+}  // namespace
+
+void Benchmark::RunSavestate()
+{
+  constexpr int ITERATIONS = 50;
+
+  struct Console
+  {
+    const char* name;
+    u32 mem1_size;
+    u32 mem2_size;
+  };
+
+  constexpr std::array consoles{Console{"GameCube", 0x01800000, 0},
+                                 Console{"Wii", 0x01800000, 0x04000000}};
+
+  fmt::print("savestate round-trips per second, buffer handling and copies only:\n");
+  for (const Console& console : consoles)
+  {
+    FakeMachine machine(console.mem1_size, console.mem2_size);
+
+    // save_to_bytes and load_from_bytes before the state buffer was reused: a measured save into
+    // a new buffer, copied into bytes, then copied twice into a new buffer for loading.
+    const double old_bytes_ns = MeasureNs(ITERATIONS, [&](int) {
+      std::vector<u8> save_buffer;
+      SaveToBuffer(machine, save_buffer);
+      const Bytes bytes(save_buffer.data(), save_buffer.size());
+
+      std::vector<u8> load_buffer(bytes.size, 0);
+      load_buffer.assign(bytes.data.get(), bytes.data.get() + bytes.size);
+      LoadFromBuffer(machine, load_buffer.data(), load_buffer.size());
+    });
+
+    // save_to_bytes and load_from_bytes now: the module's reused buffer is copied into bytes,
+    // which are loaded from directly.
+    std::vector<u8> module_buffer;
+    const double bytes_ns = MeasureNs(ITERATIONS, [&](int) {
+      const size_t size = SaveToReusedBuffer(machine, module_buffer);
+      const Bytes bytes(module_buffer.data(), size);
+      LoadFromBuffer(machine, bytes.data.get(), bytes.size);
+    });
+
+    // SavestateBuffer.save() and load().
+    std::vector<u8> state_buffer;
+    const double buffer_ns = MeasureNs(ITERATIONS, [&](int) {
+      const size_t size = SaveToReusedBuffer(machine, state_buffer);
+      LoadFromBuffer(machine, state_buffer.data(), size);
+    });
+
+    fmt::print("{:8}  bytes before {:.1f}  bytes {:.1f}  SavestateBuffer {:.1f}\n", console.name,
+               1e9 / old_bytes_ns, 1e9 / bytes_ns, 1e9 / buffer_ns);
+  }
+}
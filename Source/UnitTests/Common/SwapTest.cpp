@@ -1,6 +1,9 @@
 // Copyright 2017 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "Common/Swap.h"
@@ -12,3 +15,48 @@ TEST(Swap, SwapByValue)
   EXPECT_EQ(0x12345678u, Common::swap32(0x78563412));
   EXPECT_EQ(0x123456789abcdef0ull, Common::swap64(0xf0debc9a78563412ull));
 }
+
+template <typename T>
+static void TestSwapArray(void (*swap_array)(void*, const void*, size_t))
+{
+  // Cover the SIMD paths as well as the scalar tails.
+  for (size_t count = 0; count < 67; ++count)
+  {
+    std::vector<T> src(count);
+    for (size_t i = 0; i < count; ++i)
+      src[i] = static_cast<T>(0x0123456789abcdefull * (i + 1));
+
+    std::vector<T> dst(count);
+    swap_array(dst.data(), src.data(), count);
+    for (size_t i = 0; i < count; ++i)
+      EXPECT_EQ(Common::FromBigEndian(src[i]), dst[i]);
+
+    std::vector<T> in_place = src;
+    swap_array(in_place.data(), in_place.data(), count);
+    EXPECT_EQ(dst, in_place);
+  }
+}
+
+TEST(Swap, SwapArray)
+{
+  TestSwapArray<u16>(Common::SwapArray16);
+  TestSwapArray<u32>(Common::SwapArray32);
+  TestSwapArray<u64>(Common::SwapArray64);
+}
+
+TEST(Swap, SwapArrayUnaligned)
+{
+  std::array<u8, 35> src;
+  for (size_t i = 0; i < src.size(); ++i)
+    src[i] = static_cast<u8>(i);
+
+  std::array<u8, 35> dst{};
+  Common::SwapArray32(dst.data() + 1, src.data() + 1, 8);
+  for (size_t i = 0; i < 8; ++i)
+  {
+    EXPECT_EQ(src[1 + i * 4 + 0], dst[1 + i * 4 + 3]);
+    EXPECT_EQ(src[1 + i * 4 + 1], dst[1 + i * 4 + 2]);
+    EXPECT_EQ(src[1 + i * 4 + 2], dst[1 + i * 4 + 1]);
+    EXPECT_EQ(src[1 + i * 4 + 3], dst[1 + i * 4 + 0]);
+  }
+}
@@ -0,0 +1,104 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/API/Events.h"
+
+namespace
+{
+struct TestEvent
+{
+  u32 value;
+};
+struct OtherEvent
+{
+};
+
+using TestEventHub = API::GenericEventHub<TestEvent, OtherEvent>;
+}  // namespace
+
+TEST(Events, HasListeners)
+{
+  TestEventHub hub;
+  EXPECT_FALSE(hub.HasListeners<TestEvent>());
+
+  const auto id = hub.ListenEvent<TestEvent>([&](const TestEvent&) {});
+  EXPECT_TRUE(hub.HasListeners<TestEvent>());
+  EXPECT_FALSE(hub.HasListeners<OtherEvent>());
+
+  EXPECT_TRUE(hub.UnlistenEvent(id));
+  EXPECT_FALSE(hub.HasListeners<TestEvent>());
+  EXPECT_FALSE(hub.UnlistenEvent(id));
+
+  hub.ListenEventOnce<TestEvent>([&](const TestEvent&) {});
+  EXPECT_TRUE(hub.HasListeners<TestEvent>());
+  hub.EmitEvent(TestEvent{0});
+  EXPECT_FALSE(hub.HasListeners<TestEvent>());
+}
+
+TEST(Events, EmitInListenOrder)
+{
+  TestEventHub hub;
+  std::vector<u32> calls;
+  hub.ListenEvent<TestEvent>([&](const TestEvent& evt) { calls.push_back(evt.value); });
+  hub.ListenEventOnce<TestEvent>([&](const TestEvent& evt) { calls.push_back(evt.value + 100); });
+  hub.ListenEvent<TestEvent>([&](const TestEvent& evt) { calls.push_back(evt.value + 10); });
+
+  hub.EmitEvent(TestEvent{1});
+  hub.EmitEvent(TestEvent{2});
+  EXPECT_EQ(calls, (std::vector<u32>{1, 11, 101, 2, 12}));
+}
+
+TEST(Events, ModifyListenersDuringEmit)
+{
+  TestEventHub hub;
+  int first_calls = 0;
+  int added_calls = 0;
+  API::ListenerID<TestEvent> first_id;
+  first_id = hub.ListenEvent<TestEvent>([&](const TestEvent&) {
+    ++first_calls;
+    // Changes only apply to the next emission.
+    hub.UnlistenEvent(first_id);
+    hub.ListenEvent<TestEvent>([&](const TestEvent&) { ++added_calls; });
+  });
+
+  hub.EmitEvent(TestEvent{0});
+  EXPECT_EQ(first_calls, 1);
+  EXPECT_EQ(added_calls, 0);
+
+  hub.EmitEvent(TestEvent{0});
+  EXPECT_EQ(first_calls, 1);
+  EXPECT_EQ(added_calls, 1);
+}
+
+TEST(Events, TickWaitsForConcurrentEmissions)
+{
+  TestEventHub hub;
+  std::atomic<bool> entered = false;
+  std::atomic<bool> release = false;
+  std::atomic<bool> finished = false;
+  const auto id = hub.ListenEvent<TestEvent>([&](const TestEvent&) {
+    entered = true;
+    while (!release)
+      std::this_thread::yield();
+    finished = true;
+  });
+
+  std::thread emitter([&] { hub.EmitEvent(TestEvent{0}); });
+  while (!entered)
+    std::this_thread::yield();
+  hub.UnlistenEvent(id);
+
+  std::thread releaser([&] { release = true; });
+  hub.TickAllListeners();
+  EXPECT_TRUE(finished);
+
+  releaser.join();
+  emitter.join();
+}
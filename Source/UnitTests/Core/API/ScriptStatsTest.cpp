@@ -0,0 +1,68 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/API/ScriptStats.h"
+
+using namespace std::chrono_literals;
+
+TEST(ScriptStats, HistogramPercentiles)
+{
+  API::DurationHistogram histogram;
+  EXPECT_EQ(histogram.GetPercentile(0.99), DT::zero());
+
+  // 1us to 1000us, so the exact p50 is 500us and the exact p99 is 990us.
+  for (int i = 1; i <= 1000; ++i)
+    histogram.Add(std::chrono::microseconds(i));
+  EXPECT_EQ(histogram.GetCount(), 1000u);
+
+  const DT p50 = histogram.GetPercentile(0.5);
+  EXPECT_GE(p50, 500us);
+  EXPECT_LE(p50, 500us * 5 / 4);
+  const DT p99 = histogram.GetPercentile(0.99);
+  EXPECT_GE(p99, 990us);
+  EXPECT_LE(p99, 990us * 5 / 4);
+  EXPECT_GE(histogram.GetPercentile(1.0), 1000us);
+
+  histogram.Reset();
+  EXPECT_EQ(histogram.GetCount(), 0u);
+}
+
+TEST(ScriptStats, HistogramExtremes)
+{
+  API::DurationHistogram histogram;
+  histogram.Add(DT::zero());
+  histogram.Add(std::chrono::hours(10));
+  EXPECT_EQ(histogram.GetPercentile(0.5), DT::zero());
+  // Longer than the largest bucket, but still counted.
+  EXPECT_GT(histogram.GetPercentile(1.0), std::chrono::minutes(30));
+}
+
+TEST(ScriptStats, ProfileOnlyReportsEventsWithWork)
+{
+  API::ScriptProfile profile("script.py", {"first", "second", "third"});
+  EXPECT_TRUE(profile.GetStats().empty());
+
+  const std::vector<DT> times = {10us, 20us};
+  profile.RecordCallbacks(1, 5us, times);
+  profile.RecordCoroutineResumes(2, 3);
+
+  const std::vector<API::ScriptEventStats> stats = profile.GetStats();
+  ASSERT_EQ(stats.size(), 2u);
+  EXPECT_EQ(stats[0].event_name, "second");
+  EXPECT_EQ(stats[0].callbacks, 2u);
+  EXPECT_EQ(stats[0].total_time, DT(30us));
+  EXPECT_EQ(stats[0].gil_wait_time, DT(5us));
+  EXPECT_GE(stats[0].p99_time, DT(20us));
+  EXPECT_EQ(stats[1].event_name, "third");
+  EXPECT_EQ(stats[1].callbacks, 0u);
+  EXPECT_EQ(stats[1].coroutine_resumes, 3u);
+
+  profile.Reset();
+  EXPECT_TRUE(profile.GetStats().empty());
+}
@@ -0,0 +1,151 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <picojson.h>
+
+#include "Core/Core.h"
+#include "Core/Debugger/CallTracer.h"
+#include "Core/System.h"
+
+using Core::CallTraceEvent;
+using Core::CallTraceEventType;
+
+namespace
+{
+struct TraceEvent
+{
+  std::string name;
+  std::string phase;
+  double ts;
+};
+
+std::vector<TraceEvent>
+FormatAndParse(const std::vector<CallTraceEvent>& events,
+               const std::unordered_map<u32, std::string>& function_names = {})
+{
+  // One tick per microsecond.
+  const std::string json =
+      Core::CallTracer::FormatChromeTrace(events, 1'000'000, function_names);
+
+  picojson::value root;
+  EXPECT_EQ("", picojson::parse(root, json));
+  std::vector<TraceEvent> result;
+  for (const picojson::value& event : root.get("traceEvents").get<picojson::array>())
+  {
+    result.push_back({event.get("name").get<std::string>(), event.get("ph").get<std::string>(),
+                      event.get("ts").get<double>()});
+  }
+  return result;
+}
+}  // namespace
+
+TEST(CallTracer, ClassifiesBranches)
+{
+  EXPECT_TRUE(Core::CallTracer::IsCall(UGeckoInstruction{0x48000101}));    // bl
+  EXPECT_FALSE(Core::CallTracer::IsCall(UGeckoInstruction{0x48000100}));   // b
+  EXPECT_TRUE(Core::CallTracer::IsCall(UGeckoInstruction{0x4e800421}));    // bctrl
+  EXPECT_FALSE(Core::CallTracer::IsCall(UGeckoInstruction{0x4e800420}));   // bctr
+  EXPECT_TRUE(Core::CallTracer::IsCall(UGeckoInstruction{0x4e800021}));    // blrl
+  EXPECT_TRUE(Core::CallTracer::IsReturn(UGeckoInstruction{0x4e800020}));  // blr
+  EXPECT_FALSE(Core::CallTracer::IsReturn(UGeckoInstruction{0x4e800021}));
+  EXPECT_FALSE(Core::CallTracer::IsReturn(UGeckoInstruction{0x4c000064}));  // rfi
+}
+
+TEST(CallTracer, PairsCallsWithReturns)
+{
+  const std::vector<TraceEvent> trace = FormatAndParse({
+      {10, 0x80003000, 0x80004000, CallTraceEventType::Call},
+      {20, 0x80004010, 0x80005000, CallTraceEventType::Call},
+      {30, 0x80005020, 0x80004014, CallTraceEventType::Return},
+      {40, 0x80004030, 0x80003004, CallTraceEventType::Return},
+  });
+
+  ASSERT_EQ(4u, trace.size());
+  EXPECT_EQ("80004000", trace[0].name);
+  EXPECT_EQ("B", trace[0].phase);
+  EXPECT_EQ(10.0, trace[0].ts);
+  EXPECT_EQ("80005000", trace[1].name);
+  EXPECT_EQ("B", trace[1].phase);
+  EXPECT_EQ("80005000", trace[2].name);
+  EXPECT_EQ("E", trace[2].phase);
+  EXPECT_EQ(30.0, trace[2].ts);
+  EXPECT_EQ("80004000", trace[3].name);
+  EXPECT_EQ("E", trace[3].phase);
+  EXPECT_EQ(40.0, trace[3].ts);
+}
+
+TEST(CallTracer, NamesFunctions)
+{
+  const std::vector<TraceEvent> trace = FormatAndParse(
+      {
+          {10, 0x80003000, 0x80004000, CallTraceEventType::Call},
+          {20, 0x80004010, 0x80005000, CallTraceEventType::Call},
+      },
+      {{0x80004000, "main \"loop\""}});
+
+  ASSERT_EQ(4u, trace.size());
+  EXPECT_EQ("main \"loop\"", trace[0].name);
+  EXPECT_EQ("80005000", trace[1].name);
+  EXPECT_EQ("main \"loop\"", trace[3].name);
+}
+
+TEST(CallTracer, HandlesUnbalancedEvents)
+{
+  const std::vector<TraceEvent> trace = FormatAndParse({
+      // Return from a call made before recording started.
+      {10, 0x80003000, 0x80002004, CallTraceEventType::Return},
+      {20, 0x80003010, 0x80004000, CallTraceEventType::Call},
+      // Tail call into a function that returns straight to 0x80003014.
+      {30, 0x80004010, 0x80005000, CallTraceEventType::Call},
+      {40, 0x80006000, 0x80003014, CallTraceEventType::Return},
+      // Still running at the end.
+      {50, 0x80003020, 0x80007000, CallTraceEventType::Call},
+  });
+
+  ASSERT_EQ(6u, trace.size());
+  EXPECT_EQ("B", trace[0].phase);
+  EXPECT_EQ("B", trace[1].phase);
+  EXPECT_EQ("80005000", trace[2].name);
+  EXPECT_EQ("E", trace[2].phase);
+  EXPECT_EQ("80004000", trace[3].name);
+  EXPECT_EQ("E", trace[3].phase);
+  EXPECT_EQ(40.0, trace[3].ts);
+  EXPECT_EQ("80007000", trace[4].name);
+  EXPECT_EQ("B", trace[4].phase);
+  EXPECT_EQ("E", trace[5].phase);
+  EXPECT_EQ(50.0, trace[5].ts);
+}
+
+TEST(CallTracer, OverwritesOldestEvents)
+{
+  Core::DeclareAsCPUThread();
+  {
+    auto& system = Core::System::GetInstance();
+    const Core::CPUThreadGuard guard(system);
+    Core::CallTracer call_tracer(system.GetCoreTiming());
+
+    call_tracer.Start(guard, 3);
+    EXPECT_TRUE(call_tracer.IsActive());
+    for (u32 i = 0; i < 6; ++i)
+      Core::CallTracer::HitCall(&call_tracer, 0x80003000 + i * 4, 0x80004000);
+
+    // The capacity was rounded up to 4.
+    const std::vector<CallTraceEvent> events = call_tracer.GetEvents(guard);
+    ASSERT_EQ(4u, events.size());
+    EXPECT_EQ(0x80003008u, events.front().origin);
+    EXPECT_EQ(0x80003014u, events.back().origin);
+    EXPECT_EQ(2u, call_tracer.GetDroppedCount(guard));
+
+    call_tracer.Stop(guard);
+    EXPECT_FALSE(call_tracer.IsActive());
+    call_tracer.Clear(guard);
+    EXPECT_TRUE(call_tracer.GetEvents(guard).empty());
+  }
+  Core::UndeclareAsCPUThread();
+}
@@ -0,0 +1,134 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <bit>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Swap.h"
+#include "Core/CheatSearch.h"
+#include "Core/CheatSearchKernels.h"
+
+namespace
+{
+constexpr std::array<Cheats::CompareType, 6> COMPARE_TYPES = {
+    Cheats::CompareType::Equal,       Cheats::CompareType::NotEqual,
+    Cheats::CompareType::Less,        Cheats::CompareType::LessOrEqual,
+    Cheats::CompareType::Greater,     Cheats::CompareType::GreaterOrEqual,
+};
+
+template <typename T>
+void StoreBigEndian(u8* dest, T value)
+{
+  value = Common::FromBigEndian(value);
+  std::memcpy(dest, &value, sizeof(T));
+}
+
+// Compares the SIMD kernels against the scalar ones on random memory that has a lot of
+// equal values, including for blocks that aren't full.
+template <typename T>
+void CheckKernelsMatchScalar()
+{
+  std::mt19937 rng(1234);
+  // Few distinct bytes make equal and nearly equal values likely.
+  std::uniform_int_distribution<int> byte_dist(0, 3);
+  std::vector<u8> values(Cheats::SCAN_BLOCK_SIZE * sizeof(T) + sizeof(T));
+  std::vector<u8> last_values(values.size());
+
+  for (int round = 0; round < 50; ++round)
+  {
+    for (u8& byte : values)
+      byte = static_cast<u8>(byte_dist(rng) * 0x3F);
+    for (size_t i = 0; i < values.size(); ++i)
+      last_values[i] = byte_dist(rng) == 0 ? static_cast<u8>(byte_dist(rng)) : values[i];
+    T operand;
+    std::memcpy(&operand, values.data() + (round % 8) * sizeof(T), sizeof(T));
+    if (round % 2 == 0)
+      operand = Common::FromBigEndian(operand);
+
+    for (const Cheats::CompareType compare_type : COMPARE_TYPES)
+    {
+      for (const bool against_last : {false, true})
+      {
+        for (const bool aligned : {false, true})
+        {
+          const auto kernel = Cheats::GetScanKernel<T>(compare_type, against_last, aligned);
+          const auto scalar = Cheats::GetScalarScanKernel<T>(compare_type, against_last, aligned);
+          for (const size_t count : {size_t(1), size_t(37), Cheats::SCAN_BLOCK_SIZE})
+          {
+            EXPECT_EQ(kernel(values.data(), last_values.data(), operand, count),
+                      scalar(values.data(), last_values.data(), operand, count))
+                << "compare type " << static_cast<int>(compare_type) << ", against last "
+                << against_last << ", aligned " << aligned << ", count " << count;
+          }
+        }
+      }
+    }
+  }
+}
+}  // namespace
+
+TEST(CheatSearchKernels, CompareAgainstValue)
+{
+  std::array<u8, 4 * 4> memory{};
+  StoreBigEndian<u32>(memory.data(), 5);
+  StoreBigEndian<u32>(memory.data() + 4, 100);
+  StoreBigEndian<u32>(memory.data() + 8, 0x80000000);
+  StoreBigEndian<u32>(memory.data() + 12, 100);
+
+  const auto equal = Cheats::GetScanKernel<u32>(Cheats::CompareType::Equal, false, true);
+  EXPECT_EQ(equal(memory.data(), nullptr, 100, 4), 0b1010u);
+  const auto greater = Cheats::GetScanKernel<u32>(Cheats::CompareType::Greater, false, true);
+  EXPECT_EQ(greater(memory.data(), nullptr, 5, 4), 0b1110u);
+  // The same memory is negative when read as signed.
+  const auto less = Cheats::GetScanKernel<s32>(Cheats::CompareType::Less, false, true);
+  EXPECT_EQ(less(memory.data(), nullptr, 0, 4), 0b0100u);
+}
+
+TEST(CheatSearchKernels, CompareAgainstLastValue)
+{
+  std::array<u8, 4 * 2> memory{};
+  std::array<u8, 4 * 2> last{};
+  StoreBigEndian<s16>(memory.data(), 10);
+  StoreBigEndian<s16>(last.data(), 9);
+  StoreBigEndian<s16>(memory.data() + 2, 10);
+  StoreBigEndian<s16>(last.data() + 2, 10);
+  StoreBigEndian<s16>(memory.data() + 4, -1);
+  StoreBigEndian<s16>(last.data() + 4, 0);
+  StoreBigEndian<s16>(memory.data() + 6, 12);
+  StoreBigEndian<s16>(last.data() + 6, 9);
+
+  const auto changed = Cheats::GetScanKernel<s16>(Cheats::CompareType::NotEqual, true, true);
+  EXPECT_EQ(changed(memory.data(), last.data(), 0, 4), 0b1101u);
+  const auto increased = Cheats::GetScanKernel<s16>(Cheats::CompareType::Greater, true, true);
+  EXPECT_EQ(increased(memory.data(), last.data(), 0, 4), 0b1001u);
+  const auto increased_by = Cheats::GetScanKernel<s16>(Cheats::CompareType::Equal, true, true);
+  EXPECT_EQ(increased_by(memory.data(), last.data(), 1, 4), 0b0001u);
+  EXPECT_EQ(increased_by(memory.data(), last.data(), -1, 4), 0b0100u);
+}
+
+TEST(CheatSearchKernels, Unaligned)
+{
+  const std::array<u8, 6> memory = {0x00, 0x12, 0x34, 0x12, 0x34, 0x12};
+  const auto equal = Cheats::GetScanKernel<u16>(Cheats::CompareType::Equal, false, false);
+  EXPECT_EQ(equal(memory.data(), nullptr, 0x1234, 5), 0b01010u);
+}
+
+TEST(CheatSearchKernels, MatchScalar)
+{
+  CheckKernelsMatchScalar<u8>();
+  CheckKernelsMatchScalar<u16>();
+  CheckKernelsMatchScalar<u32>();
+  CheckKernelsMatchScalar<u64>();
+  CheckKernelsMatchScalar<s8>();
+  CheckKernelsMatchScalar<s16>();
+  CheckKernelsMatchScalar<s32>();
+  CheckKernelsMatchScalar<s64>();
+  CheckKernelsMatchScalar<float>();
+  CheckKernelsMatchScalar<double>();
+}
@@ -0,0 +1,51 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/CheatSearch.h"
+#include "Core/CheatSearchKernels.h"
+#include "Core/CompactCheatSearch.h"
+
+TEST(CompactCheatSearch, UnalignedLastValueAcrossBlocks)
+{
+  constexpr u32 BASE = 0x80000000;
+  constexpr size_t VALUE_COUNT = Cheats::SCAN_BLOCK_SIZE * 2;
+  std::vector<u8> memory(VALUE_COUNT + sizeof(u32) - 1, 0);
+  const std::vector<const u8*> range_memory{memory.data()};
+
+  Cheats::CompactSearchSession session({{BASE, memory.size()}}, Cheats::DataType::U32, false);
+  ASSERT_EQ(Cheats::SearchErrorCode::Success, session.RunSearch(range_memory));
+  ASSERT_EQ(VALUE_COUNT, session.GetResultCount());
+
+  // Changes the first three bytes of the first value of the second block, which are also the
+  // last bytes of the last values of the first block.
+  const size_t changed = Cheats::SCAN_BLOCK_SIZE;
+  for (size_t i = changed; i < changed + 3; ++i)
+    memory[i] = 0xFF;
+
+  session.SetFilterType(Cheats::FilterType::CompareAgainstLastValue);
+  session.SetCompareType(Cheats::CompareType::Equal);
+  ASSERT_TRUE(session.SetValue(Cheats::SearchValue{u32(0)}));
+  ASSERT_EQ(Cheats::SearchErrorCode::Success, session.RunSearch(range_memory));
+
+  // Every value containing a changed byte is gone.
+  std::vector<u32> addresses;
+  std::vector<Cheats::SearchValue> values;
+  session.GetResults(0, VALUE_COUNT, &addresses, &values);
+  EXPECT_EQ(VALUE_COUNT - 6, session.GetResultCount());
+  ASSERT_EQ(VALUE_COUNT - 6, addresses.size());
+  for (const u32 address : addresses)
+  {
+    const size_t index = address - BASE;
+    EXPECT_TRUE(index + 3 < changed || index >= changed + 3) << index;
+  }
+
+  // The values that are left compare against the current memory again.
+  memory[changed + 3] = 0xFF;
+  ASSERT_EQ(Cheats::SearchErrorCode::Success, session.RunSearch(range_memory));
+  EXPECT_EQ(VALUE_COUNT - 7, session.GetResultCount());
+}
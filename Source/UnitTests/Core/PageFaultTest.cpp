@@ -1,10 +1,15 @@
 // Copyright 2014 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <chrono>
+#include <vector>
+
 #include <fmt/format.h>
 
 #include "Common/CommonTypes.h"
+#include "Common/MemArena.h"
+#include "Common/MemoryUtil.h"
 #include "Common/ScopeGuard.h"
 #include "Common/Timer.h"
 #include "Core/Core.h"
@@ -69,6 +74,32 @@ static void ASAN_DISABLE perform_invalid_access(void* data)
   *(volatile int*)data = 5;
 }
 
+static int ASAN_DISABLE perform_read(const void* data)
+{
+  return *(const volatile int*)data;
+}
+
+// Records the faulting addresses and lifts the protection of the faulting page, like a backpatched
+// memcheck access that continues through the slow path.
+class ProtectedPageFakeJit : public PageFaultFakeJit
+{
+public:
+  ProtectedPageFakeJit(Core::System& system, size_t page_size)
+      : PageFaultFakeJit(system), m_page_size(page_size)
+  {
+  }
+
+  bool HandleFault(uintptr_t access_address, SContext* ctx) override
+  {
+    m_faults.push_back(access_address);
+    void* page = reinterpret_cast<void*>(access_address & ~(m_page_size - 1));
+    return Common::UnWriteProtectMemory(page, m_page_size, /*allowExecute*/ false);
+  }
+
+  size_t m_page_size;
+  std::vector<uintptr_t> m_faults;
+};
+
 TEST(PageFault, PageFault)
 {
   if (!EMM::IsExceptionHandlerSupported())
@@ -109,3 +140,51 @@ TEST(PageFault, PageFault)
 
   system.GetJitInterface().SetJit(nullptr);
 }
+
+TEST(PageFault, ProtectedArenaPages)
+{
+  if (!EMM::IsExceptionHandlerSupported())
+    GTEST_SKIP() << "Skipping PageFault test because exception handler is unsupported.";
+
+  const size_t page_size = std::max<size_t>(PAGE_GRAN, Common::GetPageSize());
+  const size_t size = page_size * 3;
+
+  Common::MemArena arena;
+  arena.GrabSHMSegment(size, "dolphin-emu-pagefault");
+  u8* const region = arena.ReserveMemoryRegion(size);
+  ASSERT_NE(region, nullptr);
+  u8* const base = static_cast<u8*>(arena.MapInMemoryRegion(0, size, region));
+  ASSERT_EQ(base, region);
+  Common::ScopeGuard arena_guard([&] {
+    arena.UnmapFromMemoryRegion(base, size);
+    arena.ReleaseMemoryRegion();
+    arena.ReleaseSHMSegment();
+  });
+
+  // The first page is covered by a write memcheck and the second one by a read memcheck.
+  ASSERT_TRUE(arena.ProtectInMemoryRegion(base, page_size, true));
+  ASSERT_TRUE(arena.ProtectInMemoryRegion(base + page_size, page_size, false));
+
+  EMM::InstallExceptionHandler();
+  Common::ScopeGuard handler_guard([] { EMM::UninstallExceptionHandler(); });
+  Core::DeclareAsCPUThread();
+  Common::ScopeGuard cpu_thread_guard([] { Core::UndeclareAsCPUThread(); });
+
+  auto& system = Core::System::GetInstance();
+  auto unique_jit = std::make_unique<ProtectedPageFakeJit>(system, page_size);
+  auto& jit = *unique_jit;
+  system.GetJitInterface().SetJit(std::move(unique_jit));
+  Common::ScopeGuard jit_guard([&] { system.GetJitInterface().SetJit(nullptr); });
+
+  perform_read(base);
+  EXPECT_TRUE(jit.m_faults.empty());
+  perform_invalid_access(base);
+  perform_read(base + page_size);
+  perform_invalid_access(base + page_size * 2);
+
+  const std::vector<uintptr_t> expected_faults{reinterpret_cast<uintptr_t>(base),
+                                               reinterpret_cast<uintptr_t>(base + page_size)};
+  EXPECT_EQ(jit.m_faults, expected_faults);
+  EXPECT_EQ(perform_read(base), 5);
+  EXPECT_EQ(perform_read(base + page_size * 2), 5);
+}
@@ -0,0 +1,132 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "Core/PowerPC/AddressIntervalIndex.h"
+
+using Interval = AddressIntervalIndex::Interval;
+
+static std::optional<size_t> FindFirstOverlapLinear(const std::vector<Interval>& intervals,
+                                                    u32 start, u32 end)
+{
+  for (size_t i = 0; i < intervals.size(); ++i)
+  {
+    if (intervals[i].end >= start && end >= intervals[i].start)
+      return i;
+  }
+  return std::nullopt;
+}
+
+TEST(AddressIntervalIndex, Empty)
+{
+  AddressIntervalIndex index;
+  EXPECT_TRUE(index.IsEmpty());
+  EXPECT_FALSE(index.FindFirstOverlap(0, 0xFFFFFFFF));
+
+  index.Rebuild({{0x80000000, 0x80000003}});
+  EXPECT_FALSE(index.IsEmpty());
+  index.Clear();
+  EXPECT_TRUE(index.IsEmpty());
+  EXPECT_FALSE(index.FindFirstOverlap(0x80000000, 0x80000000));
+}
+
+TEST(AddressIntervalIndex, Lookup)
+{
+  AddressIntervalIndex index;
+  index.Rebuild({{0x80003000, 0x80003003}, {0x80001000, 0x80001FFF}, {0x80003002, 0x80003002}});
+
+  EXPECT_EQ(1u, index.FindFirstOverlap(0x80001000, 0x80001000));
+  EXPECT_EQ(1u, index.FindFirstOverlap(0x80001FFC, 0x80002003));
+  EXPECT_EQ(0u, index.FindFirstOverlap(0x80003002, 0x80003002));
+  EXPECT_EQ(0u, index.FindFirstOverlap(0x80002FFE, 0x80003001));
+  EXPECT_EQ(0u, index.FindFirstOverlap(0x80000000, 0x8FFFFFFF));
+
+  // Same page as a range, but outside of it.
+  EXPECT_FALSE(index.FindFirstOverlap(0x80003004, 0x80003007));
+  EXPECT_FALSE(index.FindFirstOverlap(0x80002000, 0x80002FFF));
+  EXPECT_FALSE(index.FindFirstOverlap(0x80000000, 0x80000FFF));
+}
+
+TEST(AddressIntervalIndex, AddressSpaceEdges)
+{
+  AddressIntervalIndex index;
+  index.Rebuild({{0, 0}, {0xFFFFFFFC, 0xFFFFFFFF}});
+
+  EXPECT_EQ(0u, index.FindFirstOverlap(0, 3));
+  EXPECT_EQ(1u, index.FindFirstOverlap(0xFFFFFFFF, 0xFFFFFFFF));
+  EXPECT_EQ(0u, index.FindFirstOverlap(0, 0xFFFFFFFF));
+  EXPECT_FALSE(index.FindFirstOverlap(1, 0xFFFFFFFB));
+}
+
+TEST(AddressIntervalIndex, NestedRanges)
+{
+  AddressIntervalIndex index;
+  // A large range before small ones must still be found behind them.
+  index.Rebuild({{0x80400000, 0x80400003},
+                 {0x80410000, 0x80410003},
+                 {0x80000000, 0x817FFFFF},
+                 {0x80420000, 0x80420003}});
+
+  EXPECT_EQ(1u, index.FindFirstOverlap(0x80410000, 0x80410003));
+  EXPECT_EQ(2u, index.FindFirstOverlap(0x80430000, 0x80430003));
+  EXPECT_EQ(2u, index.FindFirstOverlap(0x80420000, 0x80420003));
+  EXPECT_FALSE(index.FindFirstOverlap(0x81800000, 0x81800003));
+}
+
+TEST(AddressIntervalIndex, MatchesLinearSearch)
+{
+  std::mt19937 rng(1234);
+  std::uniform_int_distribution<u32> address_dist(0x80000000, 0x80100000);
+  std::uniform_int_distribution<u32> size_dist(1, 0x2000);
+
+  for (int round = 0; round < 20; ++round)
+  {
+    std::vector<Interval> intervals(round * 10);
+    for (Interval& interval : intervals)
+    {
+      interval.start = address_dist(rng);
+      interval.end = interval.start + size_dist(rng) - 1;
+    }
+
+    AddressIntervalIndex index;
+    index.Rebuild(intervals);
+    for (int query = 0; query < 1000; ++query)
+    {
+      const u32 start = address_dist(rng);
+      const u32 end = start + (query % 2 == 0 ? 3 : size_dist(rng));
+      EXPECT_EQ(FindFirstOverlapLinear(intervals, start, end), index.FindFirstOverlap(start, end))
+          << "round " << round << ", query " << start << "-" << end;
+    }
+  }
+}
+
+TEST(AddressIntervalIndex, WideRangesMatchLinearSearch)
+{
+  std::mt19937 rng(5678);
+  std::uniform_int_distribution<u32> address_dist(0x80000000, 0x80100000);
+  std::uniform_int_distribution<u32> size_dist(1, 0x2000);
+
+  // A few ranges covering most of the others, at varying positions.
+  std::vector<Interval> intervals(200);
+  for (size_t i = 0; i < intervals.size(); ++i)
+  {
+    Interval& interval = intervals[i];
+    interval.start = address_dist(rng);
+    interval.end = interval.start + (i % 50 == 7 ? 0x80000 : size_dist(rng)) - 1;
+  }
+
+  AddressIntervalIndex index;
+  index.Rebuild(intervals);
+  for (int query = 0; query < 10000; ++query)
+  {
+    const u32 start = address_dist(rng);
+    const u32 end = start + (query % 2 == 0 ? 3 : size_dist(rng));
+    EXPECT_EQ(FindFirstOverlapLinear(intervals, start, end), index.FindFirstOverlap(start, end))
+        << "query " << start << "-" << end;
+  }
+}
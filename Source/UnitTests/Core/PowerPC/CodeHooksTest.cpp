@@ -0,0 +1,75 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "Core/Core.h"
+#include "Core/PowerPC/CodeHooks.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+class CodeHooksTest : public testing::Test
+{
+protected:
+  void SetUp() override { Core::DeclareAsCPUThread(); }
+  void TearDown() override
+  {
+    m_code_hooks.Clear();
+    Core::UndeclareAsCPUThread();
+  }
+
+  CodeHooks& m_code_hooks = Core::System::GetInstance().GetPowerPC().GetCodeHooks();
+  PowerPC::PowerPCState& m_ppc_state = Core::System::GetInstance().GetPPCState();
+};
+
+TEST_F(CodeHooksTest, RunsHooksAtAddressInOrder)
+{
+  std::vector<int> calls;
+  m_code_hooks.Add(0x80003100, [&](PowerPC::PowerPCState&) { calls.push_back(1); });
+  m_code_hooks.Add(0x80003104, [&](PowerPC::PowerPCState&) { calls.push_back(2); });
+  m_code_hooks.Add(0x80003100, [&](PowerPC::PowerPCState&) { calls.push_back(3); });
+
+  EXPECT_TRUE(m_code_hooks.HasHook(0x80003100));
+  EXPECT_FALSE(m_code_hooks.HasHook(0x80003108));
+
+  m_code_hooks.Run(0x80003100);
+  EXPECT_EQ((std::vector<int>{1, 3}), calls);
+  m_code_hooks.Run(0x80003108);
+  EXPECT_EQ((std::vector<int>{1, 3}), calls);
+}
+
+TEST_F(CodeHooksTest, HooksSeeAndModifyState)
+{
+  m_code_hooks.Add(0x80003100, [](PowerPC::PowerPCState& ppc_state) {
+    EXPECT_EQ(0x80003100u, ppc_state.pc);
+    ppc_state.gpr[3] += 1;
+    // Doesn't redirect execution.
+    ppc_state.pc = 0x80004000;
+  });
+
+  m_ppc_state.pc = 0x80003100;
+  m_ppc_state.gpr[3] = 41;
+  m_code_hooks.Run(0x80003100);
+  EXPECT_EQ(42u, m_ppc_state.gpr[3]);
+  EXPECT_EQ(0x80003100u, m_ppc_state.pc);
+}
+
+TEST_F(CodeHooksTest, HooksCanRemoveThemselves)
+{
+  int first_calls = 0;
+  int second_calls = 0;
+  CodeHooks::HookID first_id = 0;
+  first_id = m_code_hooks.Add(0x80003100, [&](PowerPC::PowerPCState&) {
+    ++first_calls;
+    EXPECT_TRUE(m_code_hooks.Remove(first_id));
+  });
+  m_code_hooks.Add(0x80003100, [&](PowerPC::PowerPCState&) { ++second_calls; });
+
+  m_code_hooks.Run(0x80003100);
+  m_code_hooks.Run(0x80003100);
+  EXPECT_EQ(1, first_calls);
+  EXPECT_EQ(2, second_calls);
+  EXPECT_FALSE(m_code_hooks.Remove(first_id));
+}
@@ -0,0 +1,115 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdint>
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include "Core/PowerPC/Expression.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+using Compare = Expression::InlineCondition::Compare;
+using OperandType = Expression::InlineCondition::OperandType;
+
+static double Evaluate(std::string_view text)
+{
+  const std::optional<Expression> expression = Expression::TryParse(text);
+  EXPECT_TRUE(expression.has_value()) << text;
+  return expression ? expression->Evaluate(Core::System::GetInstance()) : 0;
+}
+
+TEST(Expression, Evaluate)
+{
+  auto& ppc_state = Core::System::GetInstance().GetPPCState();
+  ppc_state.gpr[3] = 0x80001234;
+  ppc_state.gpr[4] = 0xFFFFFFFF;
+  ppc_state.gpr[5] = 7;
+  ppc_state.ps[1].SetPS0(2.5);
+
+  EXPECT_EQ(1, Evaluate("r3 == 0x80001234 && r4 > 10"));
+  EXPECT_EQ(0, Evaluate("r3 == 0x80001234 && r5 > 10"));
+  EXPECT_EQ(7, Evaluate("r3 != 0 && r5"));
+  EXPECT_EQ(7, Evaluate("r6 || r5"));
+  EXPECT_EQ(0, Evaluate("r6 || r6"));
+  EXPECT_EQ(-1, Evaluate("s32(r4)"));
+  EXPECT_EQ(-1, Evaluate("s8(255)"));
+  EXPECT_EQ(10, Evaluate("f1 * 4"));
+  EXPECT_EQ(3, Evaluate("r5 % 4"));
+  EXPECT_EQ(28, Evaluate("r5 << 2"));
+  EXPECT_EQ(0, Evaluate("unknown_variable"));
+  EXPECT_EQ(2, Evaluate("r5, 2"));
+}
+
+TEST(Expression, EvaluateAssignment)
+{
+  auto& ppc_state = Core::System::GetInstance().GetPPCState();
+  ppc_state.gpr[3] = 1;
+
+  EXPECT_EQ(5, Evaluate("r3 = 5"));
+  EXPECT_EQ(5u, ppc_state.gpr[3]);
+}
+
+TEST(Expression, InfinityToInt)
+{
+  // Like expr.h, bitwise operators turn infinities into the largest integers of the same sign.
+  EXPECT_EQ(static_cast<double>(INT64_MAX), Evaluate("(1 / 0) | 0"));
+  EXPECT_EQ(static_cast<double>(-INT64_MAX), Evaluate("(-1 / 0) | 0"));
+  // Assignments aren't compiled, so this goes through expr_eval.
+  EXPECT_EQ(static_cast<double>(-INT64_MAX), Evaluate("r3 = 0, (-1 / 0) | 0"));
+}
+
+TEST(Expression, NaNVariable)
+{
+  auto& system = Core::System::GetInstance();
+  auto& ppc_state = system.GetPPCState();
+  ppc_state.gpr[6] = 0;
+  ppc_state.ps[2].SetPS0(std::numeric_limits<double>::quiet_NaN());
+
+  // f2 is skipped by the && but still counts, as it does for expr_eval.
+  const std::optional<Expression> expression = Expression::TryParse("r6 && f2 > 1");
+  ASSERT_TRUE(expression.has_value());
+  EXPECT_EQ(0, expression->Evaluate(system));
+  EXPECT_TRUE(expression->HasNaNVariable(system));
+
+  ppc_state.ps[2].SetPS0(2.0);
+  EXPECT_FALSE(expression->HasNaNVariable(system));
+  EXPECT_FALSE(Expression::TryParse("r6 && r3")->HasNaNVariable(system));
+}
+
+TEST(Expression, InlineCondition)
+{
+  const auto condition = Expression::TryParse("r3 == 0x80001234 && lr > 10")->GetInlineCondition();
+  ASSERT_TRUE(condition.has_value());
+  ASSERT_EQ(1u, condition->clauses.size());
+  ASSERT_EQ(2u, condition->clauses[0].size());
+  EXPECT_EQ(OperandType::GPR, condition->clauses[0][0].lhs.type);
+  EXPECT_EQ(3u, condition->clauses[0][0].lhs.value);
+  EXPECT_EQ(Compare::Equal, condition->clauses[0][0].compare);
+  EXPECT_EQ(OperandType::Immediate, condition->clauses[0][0].rhs.type);
+  EXPECT_EQ(0x80001234u, condition->clauses[0][0].rhs.value);
+  EXPECT_EQ(OperandType::SPR, condition->clauses[0][1].lhs.type);
+  EXPECT_EQ(Compare::Greater, condition->clauses[0][1].compare);
+}
+
+TEST(Expression, InlineConditionNegated)
+{
+  const auto condition = Expression::TryParse("!(r3 == 1 && pc < r4)")->GetInlineCondition();
+  ASSERT_TRUE(condition.has_value());
+  ASSERT_EQ(2u, condition->clauses.size());
+  ASSERT_EQ(1u, condition->clauses[0].size());
+  ASSERT_EQ(1u, condition->clauses[1].size());
+  EXPECT_EQ(Compare::NotEqual, condition->clauses[0][0].compare);
+  EXPECT_EQ(OperandType::PC, condition->clauses[1][0].lhs.type);
+  EXPECT_EQ(Compare::GreaterOrEqual, condition->clauses[1][0].compare);
+}
+
+TEST(Expression, NoInlineCondition)
+{
+  EXPECT_FALSE(Expression::TryParse("f1 > 2")->GetInlineCondition());
+  EXPECT_FALSE(Expression::TryParse("read_u32(r3) == 1")->GetInlineCondition());
+  EXPECT_FALSE(Expression::TryParse("r3 == -1")->GetInlineCondition());
+  EXPECT_FALSE(Expression::TryParse("r3 + 1 == 2")->GetInlineCondition());
+  EXPECT_FALSE(Expression::TryParse("r3 = 1")->GetInlineCondition());
+}
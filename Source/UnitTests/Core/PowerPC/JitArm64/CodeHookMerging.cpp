@@ -0,0 +1,76 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+
+#include "Common/ScopeGuard.h"
+#include "Core/Core.h"
+#include "Core/PowerPC/CodeHooks.h"
+#include "Core/PowerPC/JitArm64/Jit.h"
+#include "Core/PowerPC/PPCAnalyst.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+class TestJitArm64 : public JitArm64
+{
+public:
+  explicit TestJitArm64(Core::System& system) : JitArm64(system) {}
+
+  // Sets up the JIT state as if the first of the given instructions was being compiled.
+  template <size_t N>
+  bool CanMergeAfter(std::array<PPCAnalyst::CodeOp, N>& ops, int count)
+  {
+    js.op = ops.data();
+    js.instructionsLeft = N - 1;
+    return CanMergeNextInstructions(count);
+  }
+};
+
+PPCAnalyst::CodeOp MakeOp(u32 address, u32 inst)
+{
+  PPCAnalyst::CodeOp op;
+  op.address = address;
+  op.inst.hex = inst;
+  return op;
+}
+}  // namespace
+
+// Merged instructions are compiled without their own code hook call, and the JITs keep CA and CR
+// results in host flags across them, which a hook call would clobber.
+TEST(JitArm64, DoesNotMergeAcrossCodeHooks)
+{
+  Core::DeclareAsCPUThread();
+  Common::ScopeGuard cpu_thread_guard([] { Core::UndeclareAsCPUThread(); });
+
+  auto& system = Core::System::GetInstance();
+  CodeHooks& code_hooks = system.GetPowerPC().GetCodeHooks();
+  Common::ScopeGuard code_hooks_guard([&] { code_hooks.Clear(); });
+  TestJitArm64 jit(system);
+
+  std::array addc_adde{MakeOp(0x80003000, 0x7c632014),   // addc r3, r3, r4
+                       MakeOp(0x80003004, 0x7ca53114)};  // adde r5, r5, r6
+  std::array cmpw_bne{MakeOp(0x80003100, 0x7c032000),   // cmpw r3, r4
+                      MakeOp(0x80003104, 0x4082fffc)};  // bne -4
+  std::array lwzx_dcbt{MakeOp(0x80003200, 0x7c63202e),  // lwzx r3, r3, r4
+                       MakeOp(0x80003204, 0x7c001a2c),  // dcbt r0, r3
+                       MakeOp(0x80003208, 0x7c001a2c)};
+
+  EXPECT_TRUE(jit.CanMergeAfter(addc_adde, 1));
+  EXPECT_TRUE(jit.CanMergeAfter(cmpw_bne, 1));
+  EXPECT_TRUE(jit.CanMergeAfter(lwzx_dcbt, 2));
+
+  code_hooks.Add(0x80003004, [](PowerPC::PowerPCState&) {});
+  code_hooks.Add(0x80003104, [](PowerPC::PowerPCState&) {});
+  code_hooks.Add(0x80003208, [](PowerPC::PowerPCState&) {});
+
+  // Applies without debugging enabled, unlike breakpoints.
+  ASSERT_FALSE(jit.IsDebuggingEnabled());
+  EXPECT_FALSE(jit.CanMergeAfter(addc_adde, 1));
+  EXPECT_FALSE(jit.CanMergeAfter(cmpw_bne, 1));
+  EXPECT_TRUE(jit.CanMergeAfter(lwzx_dcbt, 1));
+  EXPECT_FALSE(jit.CanMergeAfter(lwzx_dcbt, 2));
+}
@@ -0,0 +1,95 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <Python.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Scripting/Python/Utils/image_view.h"
+
+namespace
+{
+class ImageViewTest : public testing::Test
+{
+protected:
+  static void SetUpTestSuite()
+  {
+    if (!Py_IsInitialized())
+      Py_InitializeEx(0);
+  }
+
+  void SetUp() override
+  {
+    m_gil = PyGILState_Ensure();
+    m_globals = PyDict_New();
+    PyDict_SetItemString(m_globals, "__builtins__", PyEval_GetBuiltins());
+  }
+
+  void TearDown() override
+  {
+    Py_DECREF(m_globals);
+    PyGILState_Release(m_gil);
+  }
+
+  // Runs the given statements and returns whether they raised no exception.
+  bool Run(const char* code)
+  {
+    PyObject* result = PyRun_String(code, Py_file_input, m_globals, m_globals);
+    if (result == nullptr)
+    {
+      PyErr_Print();
+      return false;
+    }
+    Py_DECREF(result);
+    return true;
+  }
+
+  PyGILState_STATE m_gil;
+  PyObject* m_globals = nullptr;
+};
+}  // namespace
+
+TEST_F(ImageViewTest, ShapeAndPadding)
+{
+  // 2x2 pixels with 4 bytes of padding after each row.
+  const std::vector<u8> frame = {0, 1, 2,  3,  4,  5,  6,  7,  0xEE, 0xEE, 0xEE, 0xEE,
+                                 8, 9, 10, 11, 12, 13, 14, 15, 0xEE, 0xEE, 0xEE, 0xEE};
+  PyObject* view = Py::MakeImageView(frame.data(), 2, 2, 12);
+  ASSERT_NE(nullptr, view);
+  PyDict_SetItemString(m_globals, "data", view);
+  Py_DECREF(view);
+
+  EXPECT_TRUE(Run("assert data.readonly\n"
+                  "assert data.shape == (2, 2, 4)\n"
+                  "assert data.tobytes() == bytes(range(16))\n"
+                  "assert data.tolist()[1][0] == [8, 9, 10, 11]\n"
+                  "assert data[1, 1, 2] == 14\n"));
+}
+
+TEST_F(ImageViewTest, OutlivesSourceMemory)
+{
+  std::vector<u8> frame(2 * 2 * 4);
+  for (size_t i = 0; i < frame.size(); ++i)
+    frame[i] = static_cast<u8>(i);
+
+  // Like a listener that keeps parts of the frame after its callback returned.
+  PyObject* view = Py::MakeImageView(frame.data(), 2, 2, 8);
+  ASSERT_NE(nullptr, view);
+  PyDict_SetItemString(m_globals, "data", view);
+  Py_DECREF(view);
+  ASSERT_TRUE(Run("row = data.cast('B')[8:]\n"
+                  "exported = memoryview(row)[:4]\n"
+                  "del data\n"));
+
+  // The event data is reused for the next frame.
+  std::ranges::fill(frame, 0xFF);
+  frame.clear();
+  frame.shrink_to_fit();
+
+  EXPECT_TRUE(Run("assert row.tobytes() == bytes(range(8, 16))\n"
+                  "assert exported.tolist() == [8, 9, 10, 11]\n"));
+}
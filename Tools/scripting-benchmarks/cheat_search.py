@@ -0,0 +1,28 @@
+# Benchmark for memory.CheatSearch.
+# Measures the first search over all of RAM, which has to compare every value,
+# and repeated searches comparing against the last values.
+# Put this file into the Scripts folder and run it in Dolphin while a game is running.
+# Results are printed to the script output / log.
+
+import time
+
+from dolphin import event, memory
+
+ITERATIONS = 20
+
+for value_type in ("u8", "u16", "u32", "f32", "u64"):
+    search = memory.CheatSearch(value_type)
+    start = time.perf_counter()
+    for _ in range(ITERATIONS):
+        search.reset()
+        search.search("!=", 0)
+    first = (time.perf_counter() - start) / ITERATIONS
+
+    search.snapshot()
+    start = time.perf_counter()
+    for _ in range(ITERATIONS):
+        await event.frameadvance()
+        search.search_last("==")
+    repeated = (time.perf_counter() - start) / ITERATIONS
+    print(f"{value_type}: first search {first * 1e3:7.2f} ms, "
+          f"search_last {repeated * 1e3:7.2f} ms/frame incl. frame, {len(search)} results")
@@ -0,0 +1,51 @@
+# Microbenchmark comparing dict-based controller inputs to the fixed-layout input objects.
+# Run it as a script in Dolphin while a game is running.
+# Results are printed to the script output / log.
+
+import time
+
+from dolphin import controller, event
+
+ITERATIONS = 100000
+
+inputs_dict = {"A": True, "StickX": 200, "StickY": 128, "CStickX": 128, "CStickY": 128}
+inputs_state = controller.GCPadState(**inputs_dict)
+
+
+def dict_get_set():
+    inputs = controller.get_gc_buttons(0)
+    inputs["A"] = not inputs["A"]
+    controller.set_gc_buttons(0, inputs)
+
+
+def dict_set():
+    controller.set_gc_buttons(0, inputs_dict)
+
+
+def state_get_set():
+    inputs = controller.get_gc_state(0, inputs_state)
+    inputs.A = not inputs.A
+    controller.set_gc_state(0, inputs)
+
+
+def state_set():
+    controller.set_gc_state(0, inputs_state)
+
+
+def measure(name, func):
+    start = time.perf_counter()
+    for _ in range(ITERATIONS):
+        func()
+    elapsed = time.perf_counter() - start
+    per_call_ns = elapsed / ITERATIONS * 1e9
+    print(f"{name:>18}: {per_call_ns:8.0f} ns per call")
+    return per_call_ns
+
+
+await event.frameadvance()
+dict_get_set_ns = measure("dict get+set", dict_get_set)
+dict_set_ns = measure("dict set", dict_set)
+state_get_set_ns = measure("GCPadState get+set", state_get_set)
+state_set_ns = measure("GCPadState set", state_set)
+print(f"get+set {dict_get_set_ns / state_get_set_ns:.1f}x, "
+      f"set {dict_set_ns / state_set_ns:.1f}x faster with GCPadState")
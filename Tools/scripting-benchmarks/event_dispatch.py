@@ -0,0 +1,71 @@
+# Benchmark for the per-frame cost of dispatching events to several scripts at once.
+# Each worker script listens to frameadvance and framebegin with callbacks,
+# awaits frameadvance and watches memory, i.e. every emitted event has python work
+# in every interpreter.
+# Put this file into the Scripts folder (workers are written next to it) and
+# run it in Dolphin while a game is running with the emulation speed set to unlimited.
+# Results are printed to the script output / log.
+
+import os
+import time
+
+from dolphin import event, utils
+
+SCRIPT_COUNTS = (1, 4, 16)
+WARMUP_FRAMES = 30
+FRAMES = 600
+
+WORKER_CODE = """
+from dolphin import event, memory
+
+frames = 0
+
+@event.on_frameadvance
+def on_frameadvance():
+    global frames
+    frames += 1
+
+@event.on_framebegin
+def on_framebegin():
+    pass
+
+watch = memory.watch([(0x80000000, "u32")], lambda changes: None)
+
+while True:
+    await event.frameadvance()
+"""
+
+script_dir = os.path.dirname(utils.get_script_name())
+
+
+def worker_path(i):
+    return os.path.join(script_dir, f"event_dispatch_worker_{i}.py")
+
+
+async def measure_frames():
+    start = time.perf_counter()
+    await event.frameadvance(FRAMES)
+    return time.perf_counter() - start
+
+
+baseline = await measure_frames()
+print(f" 0 scripts: {baseline / FRAMES * 1e6:9.1f} us/frame")
+
+for count in SCRIPT_COUNTS:
+    for i in range(count):
+        with open(worker_path(i), "w") as f:
+            f.write(WORKER_CODE)
+        utils.activate_script(worker_path(i))
+    await event.frameadvance(WARMUP_FRAMES)
+
+    elapsed = await measure_frames()
+    print(f"{count:2} scripts: {elapsed / FRAMES * 1e6:9.1f} us/frame, "
+          f"{(elapsed - baseline) / FRAMES / count * 1e6:7.1f} us/frame per script")
+
+    for i in range(count):
+        utils.cancel_script(worker_path(i))
+    await event.frameadvance(WARMUP_FRAMES)
+
+for i in range(max(SCRIPT_COUNTS)):
+    if os.path.exists(worker_path(i)):
+        os.remove(worker_path(i))
@@ -0,0 +1,58 @@
+# Benchmark for the per-frame cost of drawing a HUD of many lines and labels.
+# Compares redrawing everything every frame with single draw calls, with the batched
+# draw functions, and drawing it once into a retained layer.
+# Run it in Dolphin while a game is running with the emulation speed set to unlimited.
+# Results are printed to the script output / log.
+
+import time
+
+from dolphin import event, gui
+
+LABELS = 200
+LINES = 100
+POINTS_PER_LINE = 32
+FRAMES = 600
+
+texts = [((10 + (i % 4) * 150, 10 + (i // 4) * 12), 0xFFFFFFFF, f"label {i}")
+         for i in range(LABELS)]
+polylines = [[(x * 10.0, 300.0 + y + (x % 2) * 5) for x in range(POINTS_PER_LINE)]
+             for y in range(LINES)]
+
+
+def draw_single():
+    for (pos, color, text) in texts:
+        gui.draw_text(pos, color, text)
+    for points in polylines:
+        gui.draw_polyline(points, 0xFF00FF00)
+
+
+def draw_batched():
+    gui.draw_texts(texts)
+    gui.draw_polylines(polylines, 0xFF00FF00)
+
+
+async def measure(draw):
+    start = time.perf_counter()
+    for _ in range(FRAMES):
+        if draw is not None:
+            draw()
+        await event.frameadvance()
+    return time.perf_counter() - start
+
+
+baseline = await measure(None)
+print(f"nothing: {baseline / FRAMES * 1e6:9.1f} us/frame")
+
+for (name, draw) in (("single", draw_single), ("batched", draw_batched)):
+    elapsed = await measure(draw)
+    print(f"{name}: {elapsed / FRAMES * 1e6:9.1f} us/frame, "
+          f"{(elapsed - baseline) / FRAMES * 1e6:7.1f} us/frame over nothing")
+
+layer = gui.Layer("benchmark")
+layer.draw_texts(texts)
+layer.draw_polylines(polylines, 0xFF00FF00)
+layer.commit()
+elapsed = await measure(None)
+print(f"layer: {elapsed / FRAMES * 1e6:9.1f} us/frame, "
+      f"{(elapsed - baseline) / FRAMES * 1e6:7.1f} us/frame over nothing")
+layer.remove()
@@ -0,0 +1,54 @@
+# Benchmark for the emulation speed with many memory breakpoints installed, as used by
+# tracing setups that watch hundreds of ranges generated from symbol maps.
+# The breakpoints neither log nor break, so the frame time only grows by the cost of
+# looking up memchecks on the accesses that take the slow path.
+# Run it in Dolphin while a game is running with the emulation speed set to unlimited.
+# Results are printed to the script output / log.
+
+import time
+
+from dolphin import debug, event
+
+WATCH_COUNTS = (0, 10, 100, 500)
+WARMUP_FRAMES = 30
+FRAMES = 600
+# Spread the watched ranges over MEM1, skipping the exception vectors and the OS globals.
+RANGE_START = 0x80004000
+RANGE_END = 0x81800000
+WATCH_SIZE = 4
+
+
+def watch_addresses(count):
+    stride = (RANGE_END - RANGE_START) // max(count, 1) & ~0x3
+    return [RANGE_START + i * stride for i in range(count)]
+
+
+async def measure_frames():
+    start = time.perf_counter()
+    await event.frameadvance(FRAMES)
+    return time.perf_counter() - start
+
+
+baseline = None
+for count in WATCH_COUNTS:
+    addresses = watch_addresses(count)
+    for address in addresses:
+        debug.set_memory_breakpoint({
+            "Start": address,
+            "End": address + WATCH_SIZE - 1,
+            "BreakOnRead": True,
+            "BreakOnWrite": True,
+            "LogOnHit": False,
+            "BreakOnHit": False,
+        })
+
+    await event.frameadvance(WARMUP_FRAMES)
+    elapsed = await measure_frames()
+    ms_per_frame = elapsed / FRAMES * 1e3
+    if baseline is None:
+        baseline = ms_per_frame
+    print(f"{count:>4} watches: {ms_per_frame:8.3f} ms per frame "
+          f"({ms_per_frame / baseline:.2f}x the time without watches)")
+
+    for address in addresses:
+        debug.remove_memory_breakpoint(address)
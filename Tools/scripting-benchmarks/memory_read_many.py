@@ -0,0 +1,58 @@
+# Microbenchmark comparing per-call memory reads to batched reads.
+# Run it as a script in Dolphin while a game is running.
+# Results are printed to the script output / log.
+
+import struct
+import time
+
+from dolphin import event, memory
+
+NUM_FIELDS = 300
+ITERATIONS = 200
+BASE_ADDR = 0x80000000
+
+reads = [(BASE_ADDR + 4 * i, "u32" if i % 2 == 0 else "f32") for i in range(NUM_FIELDS)]
+plan = memory.ReadPlan(reads)
+buffer = bytearray(plan.size)
+
+
+def per_call():
+    for addr, kind in reads:
+        if kind == "u32":
+            memory.read_u32(addr)
+        else:
+            memory.read_f32(addr)
+
+
+def read_many_list():
+    memory.read_many(reads)
+
+
+def read_many_plan():
+    plan.read()
+
+
+def read_into_buffer():
+    plan.read_into(buffer)
+    struct.unpack_from(plan.format, buffer)
+
+
+def measure(name, func):
+    start = time.perf_counter()
+    for _ in range(ITERATIONS):
+        func()
+    elapsed = time.perf_counter() - start
+    per_frame_us = elapsed / ITERATIONS * 1e6
+    print(f"{name:>20}: {per_frame_us:10.1f} us per {NUM_FIELDS} fields")
+    return per_frame_us
+
+
+await event.frameadvance()
+baseline = measure("read_u32/read_f32", per_call)
+for name, func in [
+    ("read_many(list)", read_many_list),
+    ("ReadPlan.read", read_many_plan),
+    ("ReadPlan.read_into", read_into_buffer),
+]:
+    us = measure(name, func)
+    print(f"{'':>20}  {baseline / us:.1f}x faster than per-call reads")
@@ -0,0 +1,54 @@
+# Microbenchmark comparing savestates round-tripped through bytes
+# to savestates kept in a reusable SavestateBuffer.
+# Run it as a script in Dolphin while a game is running.
+# Results are printed to the script output / log.
+
+import time
+
+from dolphin import event, savestate
+
+ITERATIONS = 200
+
+
+def via_bytes():
+    state = savestate.save_to_bytes()
+    savestate.load_from_bytes(state)
+
+
+state_buffer = savestate.SavestateBuffer()
+
+
+def via_buffer():
+    state_buffer.save()
+    state_buffer.load()
+
+
+def measure(name, func):
+    func()  # warm up, e.g. to size the buffers
+    start = time.perf_counter()
+    for _ in range(ITERATIONS):
+        func()
+    elapsed = time.perf_counter() - start
+    per_second = ITERATIONS / elapsed
+    print(f"{name:>16}: {per_second:10.1f} savestate round-trips per second")
+    return per_second
+
+
+await event.frameadvance()
+baseline = measure("bytes", via_bytes)
+per_second = measure("SavestateBuffer", via_buffer)
+print(f"{'':>16}  {per_second / baseline:.2f}x the round-trips of bytes")
+
+# Delta savestates relative to a RAM snapshot taken right before.
+base = savestate.RamSnapshot()
+delta_buffer = savestate.SavestateBuffer(base=base)
+
+
+def via_delta():
+    delta_buffer.save()
+    delta_buffer.load()
+
+
+per_second = measure("delta", via_delta)
+print(f"{'':>16}  {per_second / baseline:.2f}x the round-trips of bytes")
+print(f"{'':>16}  {len(delta_buffer)} bytes instead of {len(state_buffer)} bytes")
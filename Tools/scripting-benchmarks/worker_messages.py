@@ -0,0 +1,52 @@
+# Benchmark for exchanging messages with a worker script.
+# Measures the round trip of a single message while emulation is running,
+# and the throughput of many small messages sent at once.
+# Put this file into the Scripts folder (the worker is written next to it) and
+# run it in Dolphin while a game is running with the emulation speed set to unlimited.
+# Results are printed to the script output / log.
+
+import os
+import time
+
+from dolphin import event, utils
+
+ROUND_TRIPS = 1000
+BATCH = 100000
+
+WORKER_CODE = """
+from dolphin import utils
+
+try:
+    while True:
+        utils.worker_send(utils.worker_receive())
+except EOFError:
+    pass
+"""
+
+worker_path = os.path.join(os.path.dirname(utils.get_script_name()), "worker_messages_worker.py")
+with open(worker_path, "w") as f:
+    f.write(WORKER_CODE)
+
+worker = utils.Worker(worker_path)
+
+start = time.perf_counter()
+for i in range(ROUND_TRIPS):
+    worker.send(i)
+    while not worker.poll():
+        time.sleep(0)  # lets the worker run if it shares the GIL
+elapsed = time.perf_counter() - start
+print(f"round trip:  {elapsed / ROUND_TRIPS * 1e6:9.1f} us/message")
+
+start = time.perf_counter()
+for i in range(BATCH):
+    worker.send(i)
+received = 0
+while received < BATCH:
+    received += len(worker.poll())
+    await event.frameadvance()
+elapsed = time.perf_counter() - start
+print(f"throughput:  {BATCH / elapsed:9.0f} messages/s")
+
+worker.stop()
+worker.join(timeout=5)
+os.remove(worker_path)
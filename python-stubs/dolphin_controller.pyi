@@ -4,7 +4,9 @@ Module for programmatic inputs.
 Currently, only for GameCube, Wiimote, Nunchuck buttons and Wii IR (pointing).
 No acceleration or other extensions data yet.
 """
+from collections.abc import Iterable
 from typing import TypedDict, type_check_only
+from typing_extensions import Buffer
 
 
 @type_check_only
@@ -54,6 +56,69 @@ class NunchuckInputs(TypedDict):
     StickY: int  # 0-255, 128 is neutral
 
 
+class GCPadState:
+    """
+    Fixed-layout GameCube controller input, an alternative to GCInputs dicts.
+    Its fields are stored natively, so converting it from and to the emulated
+    controller's input is just a copy. Prefer it over dicts when setting inputs in tight loops.
+    The constructor takes the same keys as GCInputs as keyword arguments.
+    """
+    def __init__(self, **inputs) -> None: ...
+    Left: bool
+    Right: bool
+    Down: bool
+    Up: bool
+    Z: bool
+    R: bool
+    L: bool
+    A: bool
+    B: bool
+    X: bool
+    Y: bool
+    Start: bool
+    Buttons: int  # all button bits at once
+    StickX: int  # 0-255, 128 is neutral
+    StickY: int  # 0-255, 128 is neutral
+    CStickX: int  # 0-255, 128 is neutral
+    CStickY: int  # 0-255, 128 is neutral
+    TriggerLeft: int  # 0-255
+    TriggerRight: int  # 0-255
+    AnalogA: int  # 0-255
+    AnalogB: int  # 0-255
+    Connected: bool
+
+
+class WiiButtonsState:
+    """
+    Fixed-layout Wii controller button input, an alternative to WiiInputs dicts.
+    The constructor takes the same keys as WiiInputs as keyword arguments.
+    """
+    def __init__(self, **inputs) -> None: ...
+    Left: bool
+    Right: bool
+    Down: bool
+    Up: bool
+    Plus: bool
+    Minus: bool
+    One: bool
+    Two: bool
+    A: bool
+    B: bool
+    Home: bool
+    Buttons: int  # all button bits at once
+
+
+GC_TIMELINE_FORMAT: str
+"""
+`struct` format of a single packed GameCube timeline input:
+button bits, StickX, StickY, CStickX, CStickY, TriggerLeft, TriggerRight,
+AnalogA, AnalogB, Connected, one byte of padding.
+"""
+
+WII_BUTTONS_TIMELINE_FORMAT: str
+"""`struct` format of a single packed Wii buttons timeline input: the button bits."""
+
+
 def get_gc_buttons(controller_id: int, /) -> GCInputs:
     """
     Retrieves the current input map for the given GameCube controller.
@@ -63,7 +128,7 @@ def get_gc_buttons(controller_id: int, /) -> GCInputs:
     """
 
 
-def set_gc_buttons(controller_id: int, inputs: GCInputs, /) -> None:
+def set_gc_buttons(controller_id: int, inputs: GCInputs | GCPadState, /) -> None:
     """
     Sets the current input map for the given GameCube controller.
     The override will hold for the current frame.
@@ -73,6 +138,56 @@ def set_gc_buttons(controller_id: int, inputs: GCInputs, /) -> None:
     """
 
 
+def get_gc_state(controller_id: int, out: GCPadState | None = None, /) -> GCPadState:
+    """
+    Like get_gc_buttons, but returns a GCPadState instead of a dictionary.
+
+    :param controller_id: 0-based index of the controller
+    :param out: optional GCPadState to fill and return instead of creating a new one
+    :return: the current inputs
+    """
+
+
+def set_gc_state(controller_id: int, inputs: GCPadState | GCInputs, /) -> None:
+    """
+    Like set_gc_buttons, but with less call overhead. Fastest with a GCPadState.
+
+    :param controller_id: 0-based index of the controller
+    :param inputs: the inputs to set
+    """
+
+
+def set_gc_timeline(
+    controller_id: int, inputs: Buffer | Iterable[GCInputs | GCPadState], /,
+) -> int:
+    """
+    Plays back the given inputs on the given GameCube controller, one input per frame,
+    starting with the current frame. Replaces any timeline already playing on that controller.
+    Inputs set with set_gc_buttons take precedence over the timeline.
+
+    :param controller_id: 0-based index of the controller
+    :param inputs: inputs, or packed records in the GC_TIMELINE_FORMAT format
+    :return: number of frames in the timeline
+    """
+
+
+def clear_gc_timeline(controller_id: int, /) -> None:
+    """
+    Stops playing back the timeline of the given GameCube controller.
+
+    :param controller_id: 0-based index of the controller
+    """
+
+
+def get_gc_timeline_position(controller_id: int, /) -> int | None:
+    """
+    Retrieves the index of the timeline input currently played back on the given GameCube controller.
+
+    :param controller_id: 0-based index of the controller
+    :return: index into the timeline, or None if no timeline is playing
+    """
+
+
 def get_wii_buttons(controller_id: int, /) -> WiiInputs:
     """
     Retrieves the current input map for the given Wii controller.
@@ -82,7 +197,7 @@ def get_wii_buttons(controller_id: int, /) -> WiiInputs:
     """
 
 
-def set_wii_buttons(controller_id: int, inputs: WiiInputs, /) -> None:
+def set_wii_buttons(controller_id: int, inputs: WiiInputs | WiiButtonsState, /) -> None:
     """
     Sets the current input map for the given Wii controller.
     The override will hold for the current frame.
@@ -92,6 +207,58 @@ def set_wii_buttons(controller_id: int, inputs: WiiInputs, /) -> None:
     """
 
 
+def get_wii_buttons_state(
+    controller_id: int, out: WiiButtonsState | None = None, /,
+) -> WiiButtonsState:
+    """
+    Like get_wii_buttons, but returns a WiiButtonsState instead of a dictionary.
+
+    :param controller_id: 0-based index of the controller
+    :param out: optional WiiButtonsState to fill and return instead of creating a new one
+    :return: the current inputs
+    """
+
+
+def set_wii_buttons_state(controller_id: int, inputs: WiiButtonsState | WiiInputs, /) -> None:
+    """
+    Like set_wii_buttons, but with less call overhead. Fastest with a WiiButtonsState.
+
+    :param controller_id: 0-based index of the controller
+    :param inputs: the inputs to set
+    """
+
+
+def set_wii_buttons_timeline(
+    controller_id: int, inputs: Buffer | Iterable[WiiInputs | WiiButtonsState], /,
+) -> int:
+    """
+    Plays back the given button inputs on the given Wii controller, one input per frame,
+    starting with the current frame. Replaces any timeline already playing on that controller.
+    Inputs set with set_wii_buttons take precedence over the timeline.
+
+    :param controller_id: 0-based index of the controller
+    :param inputs: inputs, or packed records in the WII_BUTTONS_TIMELINE_FORMAT format
+    :return: number of frames in the timeline
+    """
+
+
+def clear_wii_buttons_timeline(controller_id: int, /) -> None:
+    """
+    Stops playing back the button timeline of the given Wii controller.
+
+    :param controller_id: 0-based index of the controller
+    """
+
+
+def get_wii_buttons_timeline_position(controller_id: int, /) -> int | None:
+    """
+    Retrieves the index of the timeline input currently played back on the given Wii controller.
+
+    :param controller_id: 0-based index of the controller
+    :return: index into the timeline, or None if no timeline is playing
+    """
+
+
 def set_wii_ircamera_transform(
     controller_id: int, x: float, y: float,
     z: float = -2, pitch: float = 0, yaw: float = 0, roll: float = 0, /,
@@ -42,3 +42,32 @@ def remove_memory_breakpoint(addr: int, /) -> None:
     
     :param addr: address of the breakpoint to remove
     """
+
+
+def start_call_trace(capacity: int = 1048576, /) -> None:
+    """
+    Starts recording guest function calls and returns, discarding previously recorded ones.
+    Once capacity events were recorded, the oldest ones are overwritten.
+    The JIT only records calls while debugging is enabled (Options > Enable Debugging UI).
+    
+    :param capacity: number of events to keep, rounded up to a power of two. \
+        Must be between 1 and 2**28. Each event takes 24 bytes, \
+        and MemoryError is raised if they can't be allocated.
+    """
+
+
+def stop_call_trace() -> None:
+    """
+    Stops recording guest function calls. Recorded calls are kept until the next start_call_trace.
+    """
+
+
+def export_call_trace(path: str, /) -> None:
+    """
+    Writes the recorded calls to path as a Chrome trace (JSON), named after the loaded symbols.
+    It can be opened with chrome://tracing, https://ui.perfetto.dev or https://speedscope.app.
+    Timestamps are in microseconds of emulated time, at the granularity of JIT blocks.
+    
+    :param path: file to write the trace to
+    :raises OSError: if the file could not be written
+    """
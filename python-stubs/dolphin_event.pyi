@@ -5,15 +5,39 @@ The odd-looking Protocol classes are just a lot of syntax to essentially describ
 the callback's signature. See https://www.python.org/dev/peps/pep-0544/#callback-protocols
 """
 from collections.abc import Callable
-from typing import Protocol, type_check_only
+from typing import Literal, Protocol, type_check_only
 
 
 def on_frameadvance(callback: Callable[[], None] | None) -> None:
     """Registers a callback to be called every time the game has rendered a new frame."""
 
 
-async def frameadvance() -> None:
-    """Awaitable event that completes once the game has rendered a new frame."""
+async def frameadvance(count: int = 1) -> None:
+    """
+    Awaitable event that completes once the game has rendered a new frame.
+    Frames are counted natively, so awaiting many frames at once is
+    a lot cheaper than awaiting single frames in a loop.
+
+    :param count: number of frames to wait for, at least 1
+    :raises ValueError: if count is below 1 or doesn't fit into 32 bits
+    """
+
+
+async def until(address: int, type: Literal["u8", "u16", "u32", "u64", "s8", "s16", "s32", "s64", "f32", "f64"],
+                op: Literal["==", "!=", "<", "<=", ">", ">=", "&"], value: int | float) -> int | float:
+    """
+    Awaitable event that completes on the first frame advance where
+    the value at the given address compares to the given value as requested.
+    The condition is checked natively every frame,
+    so the script only gets resumed once the condition is met.
+    Operator "&" is met if any of the given value's bits are set.
+
+    :param address: address to read from
+    :param type: type of the value to read
+    :param op: comparison operator, with the read value on the left hand side
+    :param value: value to compare against
+    :return: the value read from memory that met the condition
+    """
 	
 
 def on_framebegin(callback: Callable[[], None] | None) -> None:
@@ -27,6 +51,35 @@ async def framebegin() -> None:
 
 
 
+@type_check_only
+class _FrameDrawnCallback(Protocol):
+    def __call__(self, width: int, height: int, data: memoryview) -> None:
+        """
+        Example callback stub for on_framedrawn.
+
+        :param width: width of the frame in pixels
+        :param height: height of the frame in pixels
+        :param data: read-only view of the frame's RGBA pixels, shaped (height, width, 4).
+                     It stays valid after the callback, as do slices and arrays made from it.
+        """
+
+
+def on_framedrawn(callback: _FrameDrawnCallback | None) -> None:
+    """
+    Registers a callback to be called with the pixels of every presented frame.
+    Frames are read back from the GPU asynchronously, so they arrive a few frames late
+    and the callback runs on the video thread.
+
+    :param callback:
+    :return:
+    """
+
+
+async def framedrawn() -> tuple[int, int, memoryview]:
+    """Awaitable event that completes once the pixels of a presented frame have been read back."""
+
+
+
 @type_check_only
 class _CodebreakpointCallback(Protocol):
     def __call__(self, addr: int) -> None:
@@ -50,6 +103,20 @@ async def codebreakpoint() -> tuple[int,]:
     """Awaitable event that completes once a previously added code breakpoint is hit."""
 
 
+def on_codebreakpoint_at(address: int, callback: _CodebreakpointCallback | None, end: int | None = None) -> None:
+    """
+    Registers a callback to be called every time a previously added code breakpoint
+    within the given address range is hit.
+    Hits outside of all registered ranges are filtered out natively,
+    which is a lot faster than filtering them in an on_codebreakpoint callback.
+    Each address range can have one callback, independent of on_codebreakpoint.
+
+    :param address: address to register the callback for, or the start of the address range
+    :param callback: callback to register, or None to remove the callback for this address range
+    :param end: inclusive end of the address range. Defaults to just the given address
+    """
+
+
 @type_check_only
 class _MemorybreakpointCallback(Protocol):
     def __call__(self, is_write: bool, addr: int, value: int) -> None:
@@ -75,6 +142,20 @@ async def memorybreakpoint() -> tuple[bool, int, int]:
     """Awaitable event that completes once a previously added memory breakpoint is hit."""
 
 
+def on_memorybreakpoint_at(address: int, callback: _MemorybreakpointCallback | None, end: int | None = None) -> None:
+    """
+    Registers a callback to be called every time a previously added memory breakpoint
+    is hit by an access within the given address range.
+    Hits outside of all registered ranges are filtered out natively,
+    which is a lot faster than filtering them in an on_memorybreakpoint callback.
+    Each address range can have one callback, independent of on_memorybreakpoint.
+
+    :param address: address to register the callback for, or the start of the address range
+    :param callback: callback to register, or None to remove the callback for this address range
+    :param end: inclusive end of the address range. Defaults to just the given address
+    """
+
+
 @type_check_only
 class _SaveStateCallback(Protocol):
     def __call__(self, is_slot: bool, slot: int, /) -> None:
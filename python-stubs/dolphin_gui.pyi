@@ -5,9 +5,14 @@ All colors are in ARGB.
 All positions are (x, y) with (0, 0) being top left. X is the horizontal axis.
 """
 
-from typing_extensions import TypeAlias
+from collections.abc import Iterable
+
+from typing_extensions import Buffer, TypeAlias
 
 Position: TypeAlias = tuple[float, float]
+Points: TypeAlias = Iterable[Position] | Buffer
+"""Either (x, y) pairs, or a buffer of float32 x/y pairs."""
+TextEntry: TypeAlias = tuple[Position, int, str]
 
 
 def add_osd_message(message: str, duration_ms: int = 2000, color: int = 0xFFFFFF30) -> None:
@@ -103,7 +108,7 @@ def draw_text(pos: Position, color: int, text: str) -> None:
 
 
 def draw_polyline(
-    points: list[Position],
+    points: Points,
     color: int,
     closed: bool = False,
     thickness: float = 1,
@@ -111,8 +116,102 @@ def draw_polyline(
     """Draws a line through a list of points."""
 
 
-def draw_convex_poly_filled(points: list[Position], color: int) -> None:
+def draw_convex_poly_filled(points: Points, color: int) -> None:
     """
     Draws a convex polygon through a list of points.
     Points should be defined in clockwise order.
     """
+
+
+def draw_polylines(
+    polylines: Iterable[Points],
+    color: int,
+    closed: bool = False,
+    thickness: float = 1,
+) -> None:
+    """Draws multiple lines, each through a list of points, all in the same style."""
+
+
+def draw_texts(texts: Iterable[TextEntry]) -> None:
+    """Draws multiple texts, each given as (pos, color, text)."""
+
+
+class Layer:
+    """
+    A named set of draw commands that stays visible across frames.
+    Commands drawn onto a layer only become visible once it is committed,
+    and stay visible until the layer is committed again, removed, or the script ends.
+    Layers are drawn in ascending order,
+    before everything drawn with the module-level draw functions.
+    Committing a layer replaces any layer with the same name that the same script
+    committed before. Layers of other scripts are not affected.
+    """
+
+    def __init__(self, name: str, order: int = 0) -> None: ...
+
+    @property
+    def name(self) -> str: ...
+
+    @property
+    def order(self) -> int: ...
+
+    def __len__(self) -> int:
+        """:return: The number of recorded draw commands."""
+
+    def clear(self) -> None:
+        """Removes all recorded draw commands. Does not affect what is currently visible."""
+
+    def commit(self) -> None:
+        """Makes the currently recorded draw commands visible, replacing the previous ones."""
+
+    def remove(self) -> None:
+        """Stops drawing this layer."""
+
+    def draw_line(self, a: Position, b: Position, color: int, thickness: float = 1) -> None: ...
+
+    def draw_rect(
+        self, a: Position, b: Position, color: int, rounding: float = 0, thickness: float = 1,
+    ) -> None: ...
+
+    def draw_rect_filled(
+        self, a: Position, b: Position, color: int, rounding: float = 0,
+    ) -> None: ...
+
+    def draw_quad(
+        self, a: Position, b: Position, c: Position, d: Position, color: int,
+        thickness: float = 1,
+    ) -> None: ...
+
+    def draw_quad_filled(
+        self, a: Position, b: Position, c: Position, d: Position, color: int,
+    ) -> None: ...
+
+    def draw_triangle(
+        self, a: Position, b: Position, c: Position, color: int, thickness: float = 1,
+    ) -> None: ...
+
+    def draw_triangle_filled(self, a: Position, b: Position, c: Position, color: int) -> None: ...
+
+    def draw_circle(
+        self, center: Position, radius: float, color: int,
+        num_segments: int | None = None, thickness: float = 1,
+    ) -> None: ...
+
+    def draw_circle_filled(
+        self, center: Position, radius: float, color: int, num_segments: int | None = None,
+    ) -> None: ...
+
+    def draw_text(self, pos: Position, color: int, text: str) -> None: ...
+
+    def draw_polyline(
+        self, points: Points, color: int, closed: bool = False, thickness: float = 1,
+    ) -> None: ...
+
+    def draw_convex_poly_filled(self, points: Points, color: int) -> None: ...
+
+    def draw_polylines(
+        self, polylines: Iterable[Points], color: int, closed: bool = False,
+        thickness: float = 1,
+    ) -> None: ...
+
+    def draw_texts(self, texts: Iterable[TextEntry]) -> None: ...
@@ -1,4 +1,8 @@
 """Module for interacting with the emulated machine's memory."""
+from collections.abc import Callable, Iterable, Sequence
+from typing import Literal
+
+from typing_extensions import Buffer, TypeAlias
 
 
 def read_u8(addr: int, /) -> int:
@@ -101,6 +105,317 @@ def read_bytes(addr: int, size: int, /) -> bytearray:
     """
 
 
+def read_u16_array(addr: int, out: Buffer, /) -> None:
+    """
+    Reads consecutive 2-byte unsigned integers into a writable buffer, converted to host byte order.
+    The number of values is determined by the buffer's size, e.g. bytearray,
+    array.array or a numpy array of a matching type.
+    This is much faster than reading the values one by one.
+
+    :param addr: memory address to start reading from
+    :param out: writable buffer to store the values in
+    """
+
+
+def read_u32_array(addr: int, out: Buffer, /) -> None:
+    """
+    Reads consecutive 4-byte unsigned integers into a writable buffer, converted to host byte order.
+    The number of values is determined by the buffer's size, e.g. bytearray,
+    array.array or a numpy array of a matching type.
+    This is much faster than reading the values one by one.
+
+    :param addr: memory address to start reading from
+    :param out: writable buffer to store the values in
+    """
+
+
+def read_u64_array(addr: int, out: Buffer, /) -> None:
+    """
+    Reads consecutive 8-byte unsigned integers into a writable buffer, converted to host byte order.
+    The number of values is determined by the buffer's size, e.g. bytearray,
+    array.array or a numpy array of a matching type.
+    This is much faster than reading the values one by one.
+
+    :param addr: memory address to start reading from
+    :param out: writable buffer to store the values in
+    """
+
+
+def read_s16_array(addr: int, out: Buffer, /) -> None:
+    """
+    Reads consecutive 2-byte signed integers into a writable buffer, converted to host byte order.
+    The number of values is determined by the buffer's size, e.g. bytearray,
+    array.array or a numpy array of a matching type.
+    This is much faster than reading the values one by one.
+
+    :param addr: memory address to start reading from
+    :param out: writable buffer to store the values in
+    """
+
+
+def read_s32_array(addr: int, out: Buffer, /) -> None:
+    """
+    Reads consecutive 4-byte signed integers into a writable buffer, converted to host byte order.
+    The number of values is determined by the buffer's size, e.g. bytearray,
+    array.array or a numpy array of a matching type.
+    This is much faster than reading the values one by one.
+
+    :param addr: memory address to start reading from
+    :param out: writable buffer to store the values in
+    """
+
+
+def read_s64_array(addr: int, out: Buffer, /) -> None:
+    """
+    Reads consecutive 8-byte signed integers into a writable buffer, converted to host byte order.
+    The number of values is determined by the buffer's size, e.g. bytearray,
+    array.array or a numpy array of a matching type.
+    This is much faster than reading the values one by one.
+
+    :param addr: memory address to start reading from
+    :param out: writable buffer to store the values in
+    """
+
+
+def read_f32_array(addr: int, out: Buffer, /) -> None:
+    """
+    Reads consecutive 4-byte floating point numbers into a writable buffer, converted to host byte order.
+    The number of values is determined by the buffer's size, e.g. bytearray,
+    array.array or a numpy array of a matching type.
+    This is much faster than reading the values one by one.
+
+    :param addr: memory address to start reading from
+    :param out: writable buffer to store the values in
+    """
+
+
+def read_f64_array(addr: int, out: Buffer, /) -> None:
+    """
+    Reads consecutive 8-byte floating point numbers into a writable buffer, converted to host byte order.
+    The number of values is determined by the buffer's size, e.g. bytearray,
+    array.array or a numpy array of a matching type.
+    This is much faster than reading the values one by one.
+
+    :param addr: memory address to start reading from
+    :param out: writable buffer to store the values in
+    """
+
+
+def write_u16_array(addr: int, values: Buffer, /) -> None:
+    """
+    Writes consecutive 2-byte unsigned integers from a buffer holding them in host byte order,
+    e.g. bytearray, array.array or a numpy array of a matching type.
+    This is much faster than writing the values one by one.
+
+    :param addr: memory address to start writing to
+    :param values: buffer containing the values to write
+    """
+
+
+def write_u32_array(addr: int, values: Buffer, /) -> None:
+    """
+    Writes consecutive 4-byte unsigned integers from a buffer holding them in host byte order,
+    e.g. bytearray, array.array or a numpy array of a matching type.
+    This is much faster than writing the values one by one.
+
+    :param addr: memory address to start writing to
+    :param values: buffer containing the values to write
+    """
+
+
+def write_u64_array(addr: int, values: Buffer, /) -> None:
+    """
+    Writes consecutive 8-byte unsigned integers from a buffer holding them in host byte order,
+    e.g. bytearray, array.array or a numpy array of a matching type.
+    This is much faster than writing the values one by one.
+
+    :param addr: memory address to start writing to
+    :param values: buffer containing the values to write
+    """
+
+
+def write_s16_array(addr: int, values: Buffer, /) -> None:
+    """
+    Writes consecutive 2-byte signed integers from a buffer holding them in host byte order,
+    e.g. bytearray, array.array or a numpy array of a matching type.
+    This is much faster than writing the values one by one.
+
+    :param addr: memory address to start writing to
+    :param values: buffer containing the values to write
+    """
+
+
+def write_s32_array(addr: int, values: Buffer, /) -> None:
+    """
+    Writes consecutive 4-byte signed integers from a buffer holding them in host byte order,
+    e.g. bytearray, array.array or a numpy array of a matching type.
+    This is much faster than writing the values one by one.
+
+    :param addr: memory address to start writing to
+    :param values: buffer containing the values to write
+    """
+
+
+def write_s64_array(addr: int, values: Buffer, /) -> None:
+    """
+    Writes consecutive 8-byte signed integers from a buffer holding them in host byte order,
+    e.g. bytearray, array.array or a numpy array of a matching type.
+    This is much faster than writing the values one by one.
+
+    :param addr: memory address to start writing to
+    :param values: buffer containing the values to write
+    """
+
+
+def write_f32_array(addr: int, values: Buffer, /) -> None:
+    """
+    Writes consecutive 4-byte floating point numbers from a buffer holding them in host byte order,
+    e.g. bytearray, array.array or a numpy array of a matching type.
+    This is much faster than writing the values one by one.
+
+    :param addr: memory address to start writing to
+    :param values: buffer containing the values to write
+    """
+
+
+def write_f64_array(addr: int, values: Buffer, /) -> None:
+    """
+    Writes consecutive 8-byte floating point numbers from a buffer holding them in host byte order,
+    e.g. bytearray, array.array or a numpy array of a matching type.
+    This is much faster than writing the values one by one.
+
+    :param addr: memory address to start writing to
+    :param values: buffer containing the values to write
+    """
+
+
+ValueType: TypeAlias = Literal["u8", "u16", "u32", "u64", "s8", "s16", "s32", "s64", "f32", "f64"]
+
+
+class ReadPlan:
+    """
+    A precompiled list of reads that can be performed repeatedly.
+    Parsing the reads happens once on construction,
+    and all reads of the plan are performed under a single CPU lock.
+    """
+
+    def __init__(self, reads: Iterable[tuple[int, ValueType]], /) -> None:
+        """
+        :param reads: iterable of (address, type) tuples, \
+            where type is the suffix of the respective read_* function, e.g. "u32"
+        """
+
+    @property
+    def format(self) -> str:
+        """Format string of the packed values as understood by python's struct module."""
+
+    @property
+    def size(self) -> int:
+        """Number of bytes required to hold all packed values."""
+
+    def __len__(self) -> int:
+        """Number of reads in this plan."""
+
+    def read(self) -> tuple[int | float, ...]:
+        """
+        Performs all reads of this plan.
+
+        :return: tuple of the read values, in the order of the plan's reads
+        """
+
+    def read_into(self, buffer: Buffer, /) -> None:
+        """
+        Performs all reads of this plan and writes the values, packed in host byte order,
+        into a writable buffer of at least `size` bytes.
+        The layout is described by `format`, e.g. for use with struct.unpack_from.
+
+        :param buffer: writable buffer to store the read values in
+        """
+
+
+def read_many(reads: ReadPlan | Iterable[tuple[int, ValueType]], /) -> tuple[int | float, ...]:
+    """
+    Performs multiple reads at once under a single CPU lock.
+    This is much cheaper than calling the individual read_* functions
+    if many values need to be read. For reads that are repeated every frame,
+    consider compiling them once into a ReadPlan.
+
+    :param reads: read plan or iterable of (address, type) tuples, \
+        where type is the suffix of the respective read_* function, e.g. "u32"
+    :return: tuple of the read values, in the order of the reads
+    """
+
+
+class RamView:
+    """
+    Read-only, zero-copy view of a physical memory region.
+    Supports the buffer protocol, so it can be used with memoryview, struct.unpack_from,
+    numpy.frombuffer and similar without copying any memory.
+    Values are in the emulated machine's byte order (big endian).
+
+    The view stays safe to access even after the emulation shut down,
+    but it then shows stale contents.
+    The contents are only consistent while the emulation is paused
+    or from within callbacks of events emitted by the emulation thread, like frameadvance.
+    """
+
+    def __len__(self) -> int:
+        """Size of the memory region in bytes."""
+
+    def __buffer__(self, flags: int, /) -> memoryview:
+        """Exports the memory region as a read-only buffer."""
+
+
+def ram_view(region: Literal["mem1", "mem2"], /) -> RamView:
+    """
+    Creates a read-only, zero-copy view of a physical memory region.
+    Index 0 of the view corresponds to physical address 0 of the region,
+    e.g. 0x80000000 and 0x00000000 for mem1, or 0x90000000 and 0x10000000 for mem2.
+
+    :param region: "mem1" for the main memory, or "mem2" for the Wii's extended memory
+    :return: view of the memory region
+    """
+
+
+class PointerPath:
+    """
+    A chain of pointer dereferences, parsed once and resolved natively.
+    Paths can be given as a string like "[[0x809C18F8]+0x20]+0x14",
+    where brackets denote reading a pointer at that address,
+    or as a base address and a list of offsets, where each offset is added
+    after reading a pointer: PointerPath(0x809C18F8, [0x20, 0x14]).
+    """
+
+    def __init__(self, path: str | int, offsets: Sequence[int] | None = None, /,
+                 *, cache: bool = False) -> None:
+        """
+        :param path: either a path string, or a base address if offsets are given
+        :param offsets: offsets added after each pointer dereference
+        :param cache: remember the resolved address until the emulation advances
+                      or memory gets written through this module
+        :raises ValueError: if the path is malformed or a number does not fit into 32 bits
+        """
+
+    def resolve(self) -> int | None:
+        """
+        Follows the pointer chain.
+
+        :return: the resolved address, or None if any pointer along the way is invalid
+        """
+
+    def read(self, type: ValueType, /) -> int | float | None:
+        """
+        Follows the pointer chain and reads a value at the resolved address,
+        all within a single synchronization with the emulation.
+
+        :param type: type of the value to read, e.g. "u32" or "f32"
+        :return: the value, or None if any pointer along the way is invalid
+        """
+
+    def invalidate(self) -> None:
+        """Forgets the cached resolved address, if any."""
+
+
 def invalidate_icache(addr: int, size: int, /) -> None:
     """
     Invalidates JIT cached code between the address and address + size, \
@@ -228,4 +543,115 @@ def is_memory_accessible() -> bool:
 	False means the memory isn't accessible.
 	Trying to read/write the memory while it's not accessible
 	may result in Dolphin crashing
-	"""
\ No newline at end of file
+	"""
+
+
+WatchChanges: TypeAlias = list[tuple[int, int | float | None]]
+
+
+class MemoryWatch:
+    """
+    A set of watched memory locations, created by watch().
+    Changes are computed natively, so only values that actually changed
+    need to be processed in python.
+    """
+
+    def poll(self) -> WatchChanges:
+        """
+        Reads all watched locations right now.
+        Polling also resets what counts as changed for the per-frame callback.
+
+        :return: list of (index, value) tuples for the entries that changed since the last poll, \
+            where value is None if a pointer along the entry's pointer path is invalid
+        """
+
+    def close(self) -> None:
+        """Stops delivering changes to the callback."""
+
+    def __len__(self) -> int:
+        """Number of watched entries."""
+
+
+def watch(entries: Iterable[tuple[int | PointerPath, ValueType]],
+          callback: Callable[[WatchChanges], None] | None = None, /) -> MemoryWatch:
+    """
+    Watches a set of memory locations.
+    At the end of every frame, all locations are read at once
+    and the callback is invoked with only the entries that changed, if any.
+    The first delivery contains all entries.
+
+    :param entries: iterable of (address or PointerPath, type) tuples, \
+        where type is the suffix of the respective read_* function, e.g. "u32"
+    :param callback: invoked with a list of (index, value) tuples, index being \
+        the entry's position in entries. If None, changes can only be retrieved with poll()
+    :return: the watch, which can be closed to stop the callback
+    """
+
+
+CompareOp: TypeAlias = Literal["==", "!=", "<", "<=", ">", ">="]
+
+
+class CheatSearch:
+    """
+    Searches emulated RAM for values, like the Cheat Search in the GUI.
+    Results are kept as a bitmap plus a copy of the searched memory,
+    so every search costs about the same no matter how many results are left,
+    and the first search over all of RAM doesn't build a huge list.
+    """
+
+    def __init__(self, type: ValueType, ranges: Iterable[tuple[int, int]] | None = None, *,
+                 aligned: bool = True) -> None:
+        """
+        :param type: the type of the searched values, \
+            the suffix of the respective read_* function, e.g. "u32"
+        :param ranges: iterable of (start address, length) tuples, which must lie in MEM1 or MEM2. \
+            Defaults to all of MEM1 and, in Wii mode, MEM2
+        :param aligned: only search addresses that are a multiple of the type's size
+        """
+
+    def search(self, op: CompareOp, value: int | float, /) -> int:
+        """
+        Keeps the results whose current value compares to the given value.
+        The first search of a session searches all addresses.
+
+        :return: the number of results left
+        """
+
+    def search_last(self, op: CompareOp = "!=", delta: int | float = 0, /) -> int:
+        """
+        Keeps the results whose current value compares to their value as of the last search,
+        plus delta. E.g. search_last("==", 1) keeps values that increased by exactly 1.
+        Requires a previous search.
+
+        :return: the number of results left
+        """
+
+    def snapshot(self) -> int:
+        """
+        Remembers the current values of all results without filtering them,
+        e.g. to start a session with search_last().
+
+        :return: the number of results
+        """
+
+    def reset(self) -> None:
+        """Discards all results, so the next search searches all addresses again."""
+
+    def results(self, start: int = 0, count: int | None = None, /) -> list[tuple[int, int | float]]:
+        """
+        :param start: number of results to skip
+        :param count: maximum number of results to return, or None for all
+        :return: list of (address, value) tuples in ascending address order, \
+            with the values as of the last search
+        """
+
+    @property
+    def type(self) -> ValueType:
+        """The type of the searched values."""
+
+    @property
+    def aligned(self) -> bool:
+        """Whether only aligned addresses are searched."""
+
+    def __len__(self) -> int:
+        """Number of results."""
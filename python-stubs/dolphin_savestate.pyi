@@ -1,4 +1,5 @@
 """Module for creating and loading savestates."""
+from typing_extensions import Buffer
 
 
 def save_to_slot(slot: int, /) -> None:
@@ -13,7 +14,10 @@ def save_to_file(filename: str, /) -> None:
 
 
 def save_to_bytes() -> bytes:
-    """Saves a savestate and returns it as bytes."""
+    """
+    Saves a savestate and returns it as bytes.
+    If savestates are saved and loaded often, consider using a SavestateBuffer instead.
+    """
 
 
 def load_from_slot(slot: int, /) -> None:
@@ -27,5 +31,65 @@ def load_from_file(filename: str, /) -> None:
     """Loads a savestate from the given file."""
 
 
-def load_from_bytes(state_bytes: bytes, /) -> None:
-    """Loads a savestate from the given bytes."""
+def load_from_bytes(state_bytes: Buffer, /) -> None:
+    """
+    Loads a savestate from the given bytes.
+    Any object supporting the buffer protocol can be used, including SavestateBuffer.
+    """
+
+
+class RamSnapshot:
+    """
+    A copy of the emulated RAM (MEM1 and MEM2), taken when it is created.
+    Savestate buffers created with a snapshot as their base only store
+    the pages of RAM that differ from it, see SavestateBuffer.
+    """
+
+    def __len__(self) -> int:
+        """Size of the snapshot in bytes."""
+
+
+class SavestateBuffer:
+    """
+    A savestate kept in a native buffer that gets reused by every save.
+    This is much faster than save_to_bytes and load_from_bytes if savestates
+    are saved and loaded often, e.g. when brute-forcing, because neither the buffer
+    nor a python bytes object needs to be allocated, and the savestate's size
+    doesn't need to be measured as long as it still fits into the buffer.
+
+    Supports the buffer protocol for read-only access to the savestate's contents,
+    e.g. bytes(state_buffer) to persist it. Saving fails while buffers are exported.
+    """
+
+    def __init__(self, size_hint: int = 0, *, base: RamSnapshot | None = None) -> None:
+        """
+        :param size_hint: initial size of the buffer in bytes. \
+            The buffer automatically grows as needed.
+        :param base: if given, saves are delta savestates that only store the pages \
+            of emulated RAM that differ from this snapshot, and loading only writes \
+            the pages that differ from the current RAM. This saves a lot of memory \
+            if many savestates are kept close to the same point, e.g. for rewinding \
+            or tree searches. The buffer's contents can only be loaded into this buffer then, \
+            or into another buffer with the same base. Loading them anywhere else fails, \
+            just like loading a full savestate into a buffer with a base.
+        """
+
+    @property
+    def base(self) -> RamSnapshot | None:
+        """The RamSnapshot this buffer's savestates are relative to, if any."""
+
+    @property
+    def capacity(self) -> int:
+        """Size of the buffer in bytes, which may be larger than the savestate."""
+
+    def save(self) -> None:
+        """Saves a savestate into this buffer, replacing the previous one."""
+
+    def load(self) -> None:
+        """Loads the savestate from this buffer."""
+
+    def __len__(self) -> int:
+        """Size of the savestate in bytes, 0 if nothing was saved yet."""
+
+    def __buffer__(self, flags: int, /) -> memoryview:
+        """Exports the savestate as a read-only buffer."""
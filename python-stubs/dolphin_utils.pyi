@@ -1,5 +1,7 @@
 """Module for various utilities."""
 
+from typing import Any
+
 
 def get_script_dir() -> str:
     """
@@ -97,4 +99,91 @@ def get_script_name() -> str:
 	"""Return the filepath of the current script"""
 	
 def get_script_id() -> int:
-	"""Return the id of the current script"""
\ No newline at end of file
+	"""Return the id of the current script"""
+
+def get_script_stats() -> dict[str, dict[str, dict[str, float]]]:
+    """
+    Returns how much time scripts spent handling events since they started,
+    or since the stats were last reset.
+    The result maps each script's filepath to the events it did python work for.
+    Each event maps to a dict of:
+
+    - callbacks: how often the script's python listeners ran
+    - total_time: seconds spent in the listeners
+    - p99_time: 99th percentile of a listener's duration in seconds, overestimated by up to 25%
+    - gil_wait_time: seconds spent waiting to enter the script's interpreter
+    - coroutine_resumes: how often coroutines awaiting something were resumed
+
+    Without subinterpreters all scripts are listed as one entry called "<all scripts>".
+    """
+
+
+def reset_script_stats() -> None:
+    """Resets the stats of all scripts."""
+
+
+def show_script_stats(show: bool) -> None:
+    """Shows or hides the script stats in the performance overlay."""
+
+
+class Worker:
+    """
+    Runs a script in its own interpreter on its own thread, for work that would otherwise
+    stall emulation. The worker and the script that started it exchange messages,
+    which can be anything picklable.
+    Workers have access to the same modules, but should leave interacting with
+    the emulator to the script that started them.
+    Requires python subinterpreters.
+    """
+
+    def __init__(self, filename: str) -> None:
+        """
+        Starts running the given script as a worker.
+        Relative paths are relative to the directory of the current script.
+        """
+
+    @property
+    def filename(self) -> str:
+        """The path of the worker's script."""
+
+    @property
+    def finished(self) -> bool:
+        """Whether the worker's script has ended."""
+
+    def send(self, message: Any) -> None:
+        """Sends a message to the worker without waiting for it to be received."""
+
+    def poll(self) -> list[Any]:
+        """Returns all messages the worker sent since the last poll, without waiting."""
+
+    def stop(self) -> None:
+        """
+        Asks the worker to stop: Once it has received all pending messages,
+        `worker_receive` raises EOFError and `worker_stop_requested` returns True.
+        Workers are also asked to stop when the script that started them ends,
+        which then waits for them to finish.
+        """
+
+    def join(self, timeout: float | None = None) -> bool:
+        """
+        Waits for the worker's script to end, for at most timeout seconds if given.
+        This blocks emulation if called from an event callback or the main script.
+
+        :return: whether the worker's script has ended
+        """
+
+
+def worker_send(message: Any) -> None:
+    """Sends a message to the script that started this worker. Only available in workers."""
+
+
+def worker_receive(timeout: float | None = None) -> Any:
+    """
+    Waits for a message from the script that started this worker. Only available in workers.
+    Raises EOFError if the worker was asked to stop and all messages have been received,
+    or TimeoutError if no message arrived within timeout seconds.
+    """
+
+
+def worker_stop_requested() -> bool:
+    """Returns whether this worker was asked to stop. Only available in workers."""